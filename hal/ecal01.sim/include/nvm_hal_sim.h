@@ -0,0 +1,180 @@
+//**********************************************************************************************************************
+//
+//                                                  nvm_hal_sim.h
+//
+//**********************************************************************************************************************
+//
+//                                        Copyrights(c) by KNORR-BREMSE,
+//                                         Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date    2026-10-19
+//! @author  agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file    nvm_hal_sim.h
+//! @brief   Host (Linux) simulation of the NVM back ends used by nvm_hal_adp.c.
+//!
+//!          The simulator replaces the FRAM HAL (s16FRAM_HAL_xxx) and the program flash HAL (s16FLSH_HAL_xxx) by
+//!          memory mapped image files and keeps the content of the POFF buffer (au32NVM_HAL_PoffHwBuffer) across
+//!          simulated resets. Each device has a latency / bandwidth timing model, and faults (write interruption,
+//!          bit flips, driver errors) can be injected for robustness tests of the NVM persistence layers.
+//!
+//!          The simulator is only part of host builds, it is not linked into the target library. The host test
+//!          test/nvm_hal_sim_test.c runs it together with the log store of NVM_DEVICE_ID2 and gives the build.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+// 2026-10-19   agent          Busy time counted in 64 bit, 32 bit wrapped after 71 minutes of device time
+//
+//**********************************************************************************************************************
+
+#ifndef NVM_HAL_SIM_H
+#define NVM_HAL_SIM_H
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "kb_types.h"                                           // Standard definitions
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Return value of the status check interfaces while a simulated transfer is still in progress
+#define NVM_HAL_SIM_RET_BUSY                ((S16) 1)
+
+//**************************************** Type definitions ( typedef ) ************************************************
+//! Simulated NVM devices
+typedef enum
+{
+    eNVM_HAL_SIM_DEV_POFF = 0,                                  //!< Retained RAM of the POFF buffer
+    eNVM_HAL_SIM_DEV_FRAM,                                      //!< SPI FRAM (POFF save area and NVM_DEVICE_ID1)
+    eNVM_HAL_SIM_DEV_FLASH,                                     //!< Program flash (NVM_DEVICE_ID2)
+    eNVM_HAL_SIM_DEV_MAX                                        //!< Number of simulated devices
+} E_NVM_HAL_SIM_DEVICE;
+
+//! Faults which can be injected into a simulated device
+typedef enum
+{
+    eNVM_HAL_SIM_FAULT_NONE = 0,                                //!< No fault armed
+    eNVM_HAL_SIM_FAULT_WRITE_INTERRUPT,                         //!< Power loss during the next write (one-shot)
+    eNVM_HAL_SIM_FAULT_BIT_FLIP,                                //!< Flip one bit in the image (immediate)
+    eNVM_HAL_SIM_FAULT_DRIVER_ERROR                             //!< Next operation reports a driver error (one-shot)
+} E_NVM_HAL_SIM_FAULT;
+
+//! Configuration of one simulated device
+typedef struct
+{
+    const char* pcImageFile;                                    //!< Path of the backing image file
+    U32 u32BaseAddress;                                         //!< Device address of the first image byte
+    U32 u32Size;                                                //!< Image size in bytes
+    U8  u8ErasedValue;                                          //!< Content of a new image / of an erased sector
+    U32 u32LatencyUs;                                           //!< Fixed command latency in microseconds
+    U32 u32ReadBytesPerMs;                                      //!< Read bandwidth, 0 = unlimited
+    U32 u32WriteBytesPerMs;                                     //!< Write / program bandwidth, 0 = unlimited
+    U32 u32EraseTimeUs;                                         //!< Sector erase time in microseconds
+} C_NVM_HAL_SIM_DEVICE_CFG;
+
+//! Sector of the simulated program flash, addressed by bank and sector number as used by s16FLSH_HAL_Erase
+typedef struct
+{
+    U8  u8Bank;                                                 //!< Flash bank
+    U8  u8Sector;                                               //!< Sector number (block mask from 55xflsh.h)
+    U32 u32Address;                                             //!< Start address of the sector
+    U32 u32Size;                                                //!< Size of the sector in bytes
+} C_NVM_HAL_SIM_FLASH_SECTOR;
+
+//! Statistics of one simulated device
+typedef struct
+{
+    U32 u32ReadCnt;                                             //!< Number of read operations
+    U32 u32WriteCnt;                                            //!< Number of write / program operations
+    U32 u32EraseCnt;                                            //!< Number of sector erase operations
+    U32 u32ReadBytes;                                           //!< Number of bytes read
+    U32 u32WriteBytes;                                          //!< Number of bytes written
+    U64 u64BusyTimeUs;                                          //!< Accumulated simulated device busy time
+    U32 u32FaultCnt;                                            //!< Number of injected faults which became active
+} C_NVM_HAL_SIM_STATS;
+
+//**************************************** Global data declarations ( extern ) *****************************************
+
+//**************************************** External parameter / constant declarations ( extern const )	****************
+//! Configuration of the simulated devices, indexed by E_NVM_HAL_SIM_DEVICE
+extern const C_NVM_HAL_SIM_DEVICE_CFG acNVM_HAL_SimDeviceCfg[eNVM_HAL_SIM_DEV_MAX];
+
+//! Sector table of the simulated program flash
+extern const C_NVM_HAL_SIM_FLASH_SECTOR acNVM_HAL_SimFlashSector[];
+
+//! Number of entries in acNVM_HAL_SimFlashSector
+extern const U8 u8NVM_HAL_SimFlashSectorCnt;
+
+//! Time scale of the timing model in percent: 100 = device timing in real time, 0 = no delay (time is only counted)
+extern const U32 u32NVM_HAL_SimTimeScalePct;
+
+//**************************************** Global func/proc prototypes *************************************************
+
+//* Function s16NVM_HAL_SimInit ****************************************************************************************
+//!
+//! @brief      Maps the image files of all simulated devices and restores the POFF buffer from its image.
+//!             New image files are created and filled with the erased value of the device.
+//!
+//! @return     KB_RET_OK on success, KB_RET_ERR_DRIVER if an image can not be mapped.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_HAL_SimInit (void);
+
+//* Function s16NVM_HAL_SimExit ****************************************************************************************
+//!
+//! @brief      Saves the POFF buffer to its image, flushes and unmaps all image files.
+//!
+//! @return     KB_RET_OK on success, KB_RET_ERR_DRIVER if an image can not be written back.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_HAL_SimExit (void);
+
+//* Function s16NVM_HAL_SimPowerCycle **********************************************************************************
+//!
+//! @brief      Simulates a power cycle: pending transfers are dropped, the POFF buffer is retained in its image and
+//!             a device left powered down by an interrupted write is usable again.
+//!
+//! @param[in]  boClearPoffBuffer : TRUE to simulate loss of the RAM content (cold start)
+//!
+//! @return     KB_RET_OK on success, KB_RET_ERR_DRIVER if the simulator is not initialized.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_HAL_SimPowerCycle (BOOLEAN boClearPoffBuffer);
+
+//* Function s16NVM_HAL_SimInjectFault *********************************************************************************
+//!
+//! @brief      Arms or applies a fault on a simulated device.
+//!
+//! @param[in]  eDevice    : Simulated device
+//! @param[in]  eFault     : Fault to inject
+//! @param[in]  u32Address : BIT_FLIP: device address of the byte to corrupt, otherwise unused
+//! @param[in]  u32Param   : WRITE_INTERRUPT: number of bytes of the next write which reach the device
+//!                          BIT_FLIP: bit number (0..7) to flip
+//!
+//! @return     KB_RET_OK on success, KB_RET_ERR_ARG for invalid arguments.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_HAL_SimInjectFault (E_NVM_HAL_SIM_DEVICE eDevice,
+                                      E_NVM_HAL_SIM_FAULT eFault,
+                                      U32 u32Address,
+                                      U32 u32Param);
+
+//* Function s16NVM_HAL_SimGetStats ************************************************************************************
+//!
+//! @brief      Returns the statistics of a simulated device.
+//!
+//! @param[in]  eDevice  : Simulated device
+//! @param[out] pcStats  : Statistics of the device
+//! @param[in]  boReset  : TRUE to reset the statistics after reading
+//!
+//! @return     KB_RET_OK on success, KB_RET_ERR_ARG / KB_RET_ERR_INST_PTR for invalid arguments.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_HAL_SimGetStats (E_NVM_HAL_SIM_DEVICE eDevice, C_NVM_HAL_SIM_STATS* pcStats, BOOLEAN boReset);
+
+#endif // NVM_HAL_SIM_H
+
+// EndOfFile nvm_hal_sim.h *********************************************************************************************
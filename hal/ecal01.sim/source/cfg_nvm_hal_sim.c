@@ -0,0 +1,84 @@
+//**********************************************************************************************************************
+//
+//                                                  cfg_nvm_hal_sim.c
+//
+//**********************************************************************************************************************
+//
+//                                        Copyrights(c) by KNORR-BREMSE,
+//                                         Rail Vehicle Systems, Munich
+//
+//! @project  IBC
+//! @date     2026-10-19
+//! @author   agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file cfg_nvm_hal_sim.c
+//! @brief Configuration of the host NVM simulator: image files, address ranges and timing of the devices.
+//!
+//!        Timing values are taken from the data sheets of the FM25V10 FRAM (SPI clock of the board) and of the
+//!        MPC5534 program flash.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author      Changes
+// 2026-10-19   agent       Start
+// 2026-10-19   agent       Second program flash sector of the NVM_DEVICE_ID2 log store
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "kb_types.h"                               // Standard definitions
+#include "nvm_hal_bs_i.h"                           // NVM_HAL board specific dependencies (flash bank / sector)
+#include "cfg_nvm_hal_poff_i.h"                     // POFF buffer size
+#include "nvm_hal_sim.h"                            // Simulator configuration types
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! FRAM-FM25V10: 128 kBytes, the POFF buffer is saved at address 0, NVM_DEVICE_ID1 follows
+#define NVM_HAL_SIM_FRAM_BASE_ADDR          ((U32) 0x00000000)
+#define NVM_HAL_SIM_FRAM_SIZE               ((U32) 131072)
+
+//! Program flash blocks used by the NVM_DEVICE_ID2 log store (nvm_hal_bs_i.h), image covers both sectors
+#define NVM_HAL_SIM_FLASH_BASE_ADDR         NVM_PFLASH_SECTOR_0_ADDR
+#define NVM_HAL_SIM_FLASH_SIZE              ((NVM_PFLASH_SECTOR_1_ADDR + NVM_PFLASH_SECTOR_SIZE) - NVM_PFLASH_SECTOR_0_ADDR)
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+//! Simulated devices
+const C_NVM_HAL_SIM_DEVICE_CFG acNVM_HAL_SimDeviceCfg[eNVM_HAL_SIM_DEV_MAX] =
+{
+    // Image file,          Base address,                Size,                    Erased,  Latency, Read B/ms, Write B/ms, Erase us
+    { "nvm_sim_poff.img",   (U32) 0,                     NVM_HAL_POFF_BUFF_SIZE,  0x00U,   0U,      0U,        0U,         0U      },
+    { "nvm_sim_fram.img",   NVM_HAL_SIM_FRAM_BASE_ADDR,  NVM_HAL_SIM_FRAM_SIZE,   0x00U,   5U,      1250U,     1250U,      0U      },
+    { "nvm_sim_flash.img",  NVM_HAL_SIM_FLASH_BASE_ADDR, NVM_HAL_SIM_FLASH_SIZE,  0xFFU,   1U,      100000U,   100U,       700000U }
+};
+
+//! Erase sectors of the simulated program flash
+const C_NVM_HAL_SIM_FLASH_SECTOR acNVM_HAL_SimFlashSector[] =
+{
+    // Bank,               Sector,                    Address,                     Size
+    { NVM_PFLASH_BANK_0,   (U8)NVM_PFLASH_SECTOR_0,   NVM_PFLASH_SECTOR_0_ADDR,    NVM_PFLASH_SECTOR_SIZE },
+    { NVM_PFLASH_BANK_0,   (U8)NVM_PFLASH_SECTOR_1,   NVM_PFLASH_SECTOR_1_ADDR,    NVM_PFLASH_SECTOR_SIZE }
+};
+
+//! Number of simulated flash sectors
+const U8 u8NVM_HAL_SimFlashSectorCnt = (U8)(sizeof(acNVM_HAL_SimFlashSector) / sizeof(C_NVM_HAL_SIM_FLASH_SECTOR));
+
+//! Device timing in real time
+const U32 u32NVM_HAL_SimTimeScalePct = 100U;
+
+//**************************************** Module global data segment ( static ) ***************************************
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+
+// EndOfHeader *********************************************************************************************************
+
+// EndOfFile cfg_nvm_hal_sim.c *****************************************************************************************
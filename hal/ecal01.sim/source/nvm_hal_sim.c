@@ -0,0 +1,965 @@
+//**********************************************************************************************************************
+//
+//                                                  nvm_hal_sim.c
+//
+//**********************************************************************************************************************
+//
+//                                        Copyrights(c) by KNORR-BREMSE
+//                                         Rail Vehicle Systems, Munich
+//
+//! @project   IBC
+//! @date      2026-10-19
+//! @author    agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file      nvm_hal_sim.c
+//! @brief     Host (Linux) implementation of the FRAM HAL and program flash HAL interfaces used by nvm_hal_adp.c.
+//!
+//!            Every device is backed by a memory mapped image file. Transfers are copied at the time they are
+//!            started, the status check interfaces report "busy" until the time given by the timing model of the
+//!            device has elapsed. Flash writes can only clear bits (like the real device), erased sectors read
+//!            back the configured erased value.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date            Author              Changes
+// 2026-10-19      agent               Start
+// 2026-10-19      agent               Busy time counted in 64 bit
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma )	************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include <string.h>                                             // String related interfaces
+#include <time.h>                                               // clock_gettime, nanosleep
+#include <fcntl.h>                                              // open
+#include <unistd.h>                                             // close, ftruncate
+#include <sys/mman.h>                                           // mmap, msync, munmap
+#include <sys/stat.h>                                           // fstat
+#include "kb_types.h"                                           // Standard definitions
+#include "kb_ret.h"                                             // Global Knorr-Bremse return value definitions
+#include "fram_hal.h"                                           // FRAM HAL interfaces implemented here
+#include "flsh_hal.h"                                           // Flash HAL interfaces implemented here
+#include "nvm_hal_i.h"                                          // NVM_HAL internal interfaces (POFF buffer)
+#include "cfg_nvm_hal_poff_i.h"                                 // POFF buffer size
+#include "nvm_hal_sim.h"                                        // Simulator interfaces
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Microseconds per second
+#define NVM_HAL_SIM_US_PER_SEC              ((U32) 1000000)
+
+//! Nanoseconds per microsecond
+#define NVM_HAL_SIM_NS_PER_US               ((long) 1000)
+
+//! Nanoseconds per second
+#define NVM_HAL_SIM_NS_PER_SEC              ((long) 1000000000)
+
+//! Microseconds per millisecond, bandwidths are configured in bytes per millisecond
+#define NVM_HAL_SIM_US_PER_MS               ((U32) 1000)
+
+//! Mask of the bit number of a bit flip fault
+#define NVM_HAL_SIM_BIT_MASK                ((U32) 0x07)
+
+//**************************************** Type definitions ( typedef ) ************************************************
+//! Run time state of one simulated device
+typedef struct
+{
+    U8* pu8Image;                                               //!< Mapped image, KB_NULL_PTR if not mapped
+    int iFd;                                                    //!< File descriptor of the image
+    struct timespec cBusyUntil;                                 //!< End of the current transfer
+    BOOLEAN boTransferError;                                    //!< Current transfer ends with a driver error
+    BOOLEAN boPoweredDown;                                      //!< Device lost power during an interrupted write
+    E_NVM_HAL_SIM_FAULT eArmedFault;                            //!< One-shot fault armed for the next operation
+    U32 u32FaultParam;                                          //!< Parameter of the armed fault
+    C_NVM_HAL_SIM_STATS cStats;                                 //!< Statistics
+} C_NVM_HAL_SIM_DEVICE_STATE;
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+//! Run time state of the simulated devices
+static C_NVM_HAL_SIM_DEVICE_STATE acNVM_HAL_SimDevice[eNVM_HAL_SIM_DEV_MAX];
+
+//! Simulator initialized
+static BOOLEAN boNVM_HAL_SimInitDone = FALSE;
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+static S16 s16NVM_HAL_SimMapImage (E_NVM_HAL_SIM_DEVICE eDevice);
+
+static S16 s16NVM_HAL_SimCheckRange (E_NVM_HAL_SIM_DEVICE eDevice, U32 u32Address, U32 u32Length);
+
+static U32 u32NVM_HAL_SimTransferTime (U32 u32LatencyUs, U32 u32BytesPerMs, U32 u32Length);
+
+static void vNVM_HAL_SimStartTransfer (E_NVM_HAL_SIM_DEVICE eDevice, U32 u32DurationUs);
+
+static S16 s16NVM_HAL_SimChkTransfer (E_NVM_HAL_SIM_DEVICE eDevice);
+
+static void vNVM_HAL_SimWaitTransfer (E_NVM_HAL_SIM_DEVICE eDevice);
+
+static S16 s16NVM_HAL_SimWrite (E_NVM_HAL_SIM_DEVICE eDevice, U32 u32Address, const U8* pu8Src, U32 u32Length);
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_HAL_SimInit
+//**********************************************************************************************************************
+S16 s16NVM_HAL_SimInit (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    U8 u8Device;                                            // Loop index of devices
+
+//*************************************************** Function code ****************************************************
+    // Map the image of each device
+    for (u8Device = 0U; (u8Device < (U8)eNVM_HAL_SIM_DEV_MAX) && (s16Return == KB_RET_OK); u8Device++)
+    {
+        // Start with a clean run time state
+        memset(&acNVM_HAL_SimDevice[u8Device], 0, sizeof(C_NVM_HAL_SIM_DEVICE_STATE));
+        acNVM_HAL_SimDevice[u8Device].iFd = -1;
+
+        s16Return = s16NVM_HAL_SimMapImage((E_NVM_HAL_SIM_DEVICE)u8Device);
+    }
+
+    if (s16Return == KB_RET_OK)
+    {
+        // Retained RAM: restore the POFF buffer from its image
+        memcpy((void*)au32NVM_HAL_PoffHwBuffer,
+               acNVM_HAL_SimDevice[eNVM_HAL_SIM_DEV_POFF].pu8Image,
+               (size_t)NVM_HAL_POFF_BUFF_SIZE);
+
+        boNVM_HAL_SimInitDone = TRUE;
+    }
+    else
+    {
+        // Release what has been mapped so far
+        (void)s16NVM_HAL_SimExit();
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_SimInit **********************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_HAL_SimExit
+//**********************************************************************************************************************
+S16 s16NVM_HAL_SimExit (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    U8 u8Device;                                            // Loop index of devices
+    C_NVM_HAL_SIM_DEVICE_STATE* pcDev;                      // State of the current device
+
+//*************************************************** Function code ****************************************************
+    if (boNVM_HAL_SimInitDone == TRUE)
+    {
+        // Retained RAM: save the POFF buffer to its image
+        memcpy(acNVM_HAL_SimDevice[eNVM_HAL_SIM_DEV_POFF].pu8Image,
+               (const void*)au32NVM_HAL_PoffHwBuffer,
+               (size_t)NVM_HAL_POFF_BUFF_SIZE);
+    }
+
+    for (u8Device = 0U; u8Device < (U8)eNVM_HAL_SIM_DEV_MAX; u8Device++)
+    {
+        pcDev = &acNVM_HAL_SimDevice[u8Device];
+
+        if (pcDev->pu8Image != KB_NULL_PTR)
+        {
+            // Write back and release the image
+            if (msync(pcDev->pu8Image, (size_t)acNVM_HAL_SimDeviceCfg[u8Device].u32Size, MS_SYNC) != 0)
+            {
+                s16Return = KB_RET_ERR_DRIVER;
+            }
+            (void)munmap(pcDev->pu8Image, (size_t)acNVM_HAL_SimDeviceCfg[u8Device].u32Size);
+            pcDev->pu8Image = KB_NULL_PTR;
+        }
+
+        if (pcDev->iFd >= 0)
+        {
+            (void)close(pcDev->iFd);
+            pcDev->iFd = -1;
+        }
+    }
+
+    boNVM_HAL_SimInitDone = FALSE;
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_SimExit **********************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_HAL_SimPowerCycle
+//**********************************************************************************************************************
+S16 s16NVM_HAL_SimPowerCycle (BOOLEAN boClearPoffBuffer)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    U8 u8Device;                                            // Loop index of devices
+    C_NVM_HAL_SIM_DEVICE_STATE* pcDev;                      // State of the current device
+
+//*************************************************** Function code ****************************************************
+    if (boNVM_HAL_SimInitDone == TRUE)
+    {
+        // RAM content is lost on a cold start, retained otherwise
+        if (boClearPoffBuffer == TRUE)
+        {
+            memset((void*)au32NVM_HAL_PoffHwBuffer, 0, (size_t)NVM_HAL_POFF_BUFF_SIZE);
+        }
+        memcpy(acNVM_HAL_SimDevice[eNVM_HAL_SIM_DEV_POFF].pu8Image,
+               (const void*)au32NVM_HAL_PoffHwBuffer,
+               (size_t)NVM_HAL_POFF_BUFF_SIZE);
+
+        // Drop pending transfers and armed faults, power up all devices again
+        for (u8Device = 0U; u8Device < (U8)eNVM_HAL_SIM_DEV_MAX; u8Device++)
+        {
+            pcDev = &acNVM_HAL_SimDevice[u8Device];
+            pcDev->cBusyUntil.tv_sec = 0;
+            pcDev->cBusyUntil.tv_nsec = 0;
+            pcDev->boTransferError = FALSE;
+            pcDev->boPoweredDown = FALSE;
+            pcDev->eArmedFault = eNVM_HAL_SIM_FAULT_NONE;
+        }
+    }
+    else
+    {
+        // Simulator not initialized
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_SimPowerCycle ****************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_HAL_SimInjectFault
+//**********************************************************************************************************************
+S16 s16NVM_HAL_SimInjectFault (E_NVM_HAL_SIM_DEVICE eDevice,
+                               E_NVM_HAL_SIM_FAULT eFault,
+                               U32 u32Address,
+                               U32 u32Param)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    C_NVM_HAL_SIM_DEVICE_STATE* pcDev;                      // State of the selected device
+
+//*************************************************** Function code ****************************************************
+    if ((eDevice >= eNVM_HAL_SIM_DEV_MAX) || (boNVM_HAL_SimInitDone == FALSE))
+    {
+        // Invalid device or simulator not initialized
+        s16Return = KB_RET_ERR_ARG;
+    }
+    else
+    {
+        pcDev = &acNVM_HAL_SimDevice[eDevice];
+
+        switch (eFault)
+        {
+            case eNVM_HAL_SIM_FAULT_BIT_FLIP :
+            {
+                // Corrupt the stored data immediately
+                s16Return = s16NVM_HAL_SimCheckRange(eDevice, u32Address, 1U);
+                if (s16Return == KB_RET_OK)
+                {
+                    pcDev->pu8Image[u32Address - acNVM_HAL_SimDeviceCfg[eDevice].u32BaseAddress] ^=
+                        (U8)(1U << (u32Param & NVM_HAL_SIM_BIT_MASK));
+
+                    // The POFF buffer is RAM, corrupt the live copy as well
+                    if (eDevice == eNVM_HAL_SIM_DEV_POFF)
+                    {
+                        ((U8*)(void*)au32NVM_HAL_PoffHwBuffer)[u32Address] ^=
+                            (U8)(1U << (u32Param & NVM_HAL_SIM_BIT_MASK));
+                    }
+                    pcDev->cStats.u32FaultCnt++;
+                }
+                break;
+            }
+
+            case eNVM_HAL_SIM_FAULT_WRITE_INTERRUPT :
+            case eNVM_HAL_SIM_FAULT_DRIVER_ERROR :
+            case eNVM_HAL_SIM_FAULT_NONE :
+            {
+                // One-shot fault, becomes active with the next operation; NONE disarms
+                pcDev->eArmedFault = eFault;
+                pcDev->u32FaultParam = u32Param;
+                break;
+            }
+
+            default:
+            {
+                // Unknown fault
+                s16Return = KB_RET_ERR_ARG;
+                break;
+            }
+        }
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_SimInjectFault ***************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_HAL_SimGetStats
+//**********************************************************************************************************************
+S16 s16NVM_HAL_SimGetStats (E_NVM_HAL_SIM_DEVICE eDevice, C_NVM_HAL_SIM_STATS* pcStats, BOOLEAN boReset)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+
+//*************************************************** Function code ****************************************************
+    if (eDevice >= eNVM_HAL_SIM_DEV_MAX)
+    {
+        // Invalid device
+        s16Return = KB_RET_ERR_ARG;
+    }
+    else if (pcStats == KB_NULL_PTR)
+    {
+        // Invalid pointer
+        s16Return = KB_RET_ERR_INST_PTR;
+    }
+    else
+    {
+        *pcStats = acNVM_HAL_SimDevice[eDevice].cStats;
+
+        if (boReset == TRUE)
+        {
+            memset(&acNVM_HAL_SimDevice[eDevice].cStats, 0, sizeof(C_NVM_HAL_SIM_STATS));
+        }
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_SimGetStats ******************************************************************************
+
+//**********************************************************************************************************************
+// Function s16FRAM_HAL_Init
+//**********************************************************************************************************************
+S16 s16FRAM_HAL_Init (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+
+//*************************************************** Function code ****************************************************
+    // The images are mapped by s16NVM_HAL_SimInit before the NVM service is initialized
+    if (boNVM_HAL_SimInitDone == FALSE)
+    {
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16FRAM_HAL_Init ************************************************************************************
+
+//**********************************************************************************************************************
+// Function s16FRAM_HAL_Read
+//**********************************************************************************************************************
+S16 s16FRAM_HAL_Read (U8* pu8DstAddr, U32 u32SrcAddr, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                          // Function Return value
+    C_NVM_HAL_SIM_DEVICE_STATE* pcDev = &acNVM_HAL_SimDevice[eNVM_HAL_SIM_DEV_FRAM];
+    const C_NVM_HAL_SIM_DEVICE_CFG* pcCfg = &acNVM_HAL_SimDeviceCfg[eNVM_HAL_SIM_DEV_FRAM];
+
+//*************************************************** Function code ****************************************************
+    s16Return = s16NVM_HAL_SimCheckRange(eNVM_HAL_SIM_DEV_FRAM, u32SrcAddr, u32Length);
+
+    if ((s16Return == KB_RET_OK) && (pu8DstAddr == KB_NULL_PTR))
+    {
+        s16Return = KB_RET_ERR_INST_PTR;
+    }
+    else if ((s16Return == KB_RET_OK) &&
+             ((s16NVM_HAL_SimChkTransfer(eNVM_HAL_SIM_DEV_FRAM) == NVM_HAL_SIM_RET_BUSY) ||
+              (pcDev->boPoweredDown == TRUE)))
+    {
+        // Only one transfer at a time, no transfer after power loss
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+    else if (s16Return == KB_RET_OK)
+    {
+        pcDev->boTransferError = FALSE;
+
+        if (pcDev->eArmedFault == eNVM_HAL_SIM_FAULT_DRIVER_ERROR)
+        {
+            // Injected error: transfer fails, destination is not touched
+            pcDev->boTransferError = TRUE;
+            pcDev->eArmedFault = eNVM_HAL_SIM_FAULT_NONE;
+            pcDev->cStats.u32FaultCnt++;
+        }
+        else
+        {
+            memcpy(pu8DstAddr, &pcDev->pu8Image[u32SrcAddr - pcCfg->u32BaseAddress], (size_t)u32Length);
+        }
+
+        pcDev->cStats.u32ReadCnt++;
+        pcDev->cStats.u32ReadBytes += u32Length;
+        vNVM_HAL_SimStartTransfer(eNVM_HAL_SIM_DEV_FRAM,
+                                  u32NVM_HAL_SimTransferTime(pcCfg->u32LatencyUs, pcCfg->u32ReadBytesPerMs, u32Length));
+    }
+    else
+    {
+        ; // Range error is returned
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16FRAM_HAL_Read ************************************************************************************
+
+//**********************************************************************************************************************
+// Function s16FRAM_HAL_Write
+//**********************************************************************************************************************
+S16 s16FRAM_HAL_Write (U32 u32DstAddr, U8* pu8SrcAddr, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                          // Function Return value
+    const C_NVM_HAL_SIM_DEVICE_CFG* pcCfg = &acNVM_HAL_SimDeviceCfg[eNVM_HAL_SIM_DEV_FRAM];
+
+//*************************************************** Function code ****************************************************
+    if (s16NVM_HAL_SimChkTransfer(eNVM_HAL_SIM_DEV_FRAM) == NVM_HAL_SIM_RET_BUSY)
+    {
+        // Only one transfer at a time
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+    else
+    {
+        s16Return = s16NVM_HAL_SimWrite(eNVM_HAL_SIM_DEV_FRAM, u32DstAddr, pu8SrcAddr, u32Length);
+    }
+
+    if (s16Return == KB_RET_OK)
+    {
+        vNVM_HAL_SimStartTransfer(eNVM_HAL_SIM_DEV_FRAM,
+                                  u32NVM_HAL_SimTransferTime(pcCfg->u32LatencyUs, pcCfg->u32WriteBytesPerMs, u32Length));
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16FRAM_HAL_Write ***********************************************************************************
+
+//**********************************************************************************************************************
+// Function s16FRAM_HAL_ChkReadStatus
+//**********************************************************************************************************************
+S16 s16FRAM_HAL_ChkReadStatus (void)
+{
+    // Read and write share the SPI transfer state of the device
+    return (s16NVM_HAL_SimChkTransfer(eNVM_HAL_SIM_DEV_FRAM));
+}
+//** EndOfFunction s16FRAM_HAL_ChkReadStatus ***************************************************************************
+
+//**********************************************************************************************************************
+// Function s16FRAM_HAL_ChkWriteStatus
+//**********************************************************************************************************************
+S16 s16FRAM_HAL_ChkWriteStatus (void)
+{
+    // Read and write share the SPI transfer state of the device
+    return (s16NVM_HAL_SimChkTransfer(eNVM_HAL_SIM_DEV_FRAM));
+}
+//** EndOfFunction s16FRAM_HAL_ChkWriteStatus **************************************************************************
+
+//**********************************************************************************************************************
+// Function s16FLSH_HAL_Init
+//**********************************************************************************************************************
+S16 s16FLSH_HAL_Init (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+
+//*************************************************** Function code ****************************************************
+    // The images are mapped by s16NVM_HAL_SimInit before the NVM service is initialized
+    if (boNVM_HAL_SimInitDone == FALSE)
+    {
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16FLSH_HAL_Init ************************************************************************************
+
+//**********************************************************************************************************************
+// Function s16FLSH_HAL_Read
+//**********************************************************************************************************************
+S16 s16FLSH_HAL_Read (E_FLSH_HAL_TYPE eFlashType, U32 u32Address, U8* pu8Buffer, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                          // Function Return value
+    C_NVM_HAL_SIM_DEVICE_STATE* pcDev = &acNVM_HAL_SimDevice[eNVM_HAL_SIM_DEV_FLASH];
+    const C_NVM_HAL_SIM_DEVICE_CFG* pcCfg = &acNVM_HAL_SimDeviceCfg[eNVM_HAL_SIM_DEV_FLASH];
+
+//*************************************************** Function code ****************************************************
+    // Only the program flash is simulated
+    (void)eFlashType;
+
+    s16Return = s16NVM_HAL_SimCheckRange(eNVM_HAL_SIM_DEV_FLASH, u32Address, u32Length);
+
+    if ((s16Return == KB_RET_OK) && (pu8Buffer == KB_NULL_PTR))
+    {
+        s16Return = KB_RET_ERR_INST_PTR;
+    }
+    else if ((s16Return == KB_RET_OK) &&
+             ((pcDev->boPoweredDown == TRUE) || (pcDev->eArmedFault == eNVM_HAL_SIM_FAULT_DRIVER_ERROR)))
+    {
+        // Injected error or no access after power loss
+        if (pcDev->eArmedFault == eNVM_HAL_SIM_FAULT_DRIVER_ERROR)
+        {
+            pcDev->eArmedFault = eNVM_HAL_SIM_FAULT_NONE;
+            pcDev->cStats.u32FaultCnt++;
+        }
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+    else if (s16Return == KB_RET_OK)
+    {
+        // Flash is memory mapped, read is blocking
+        memcpy(pu8Buffer, &pcDev->pu8Image[u32Address - pcCfg->u32BaseAddress], (size_t)u32Length);
+
+        pcDev->cStats.u32ReadCnt++;
+        pcDev->cStats.u32ReadBytes += u32Length;
+        vNVM_HAL_SimStartTransfer(eNVM_HAL_SIM_DEV_FLASH,
+                                  u32NVM_HAL_SimTransferTime(pcCfg->u32LatencyUs, pcCfg->u32ReadBytesPerMs, u32Length));
+        vNVM_HAL_SimWaitTransfer(eNVM_HAL_SIM_DEV_FLASH);
+    }
+    else
+    {
+        ; // Range error is returned
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16FLSH_HAL_Read ************************************************************************************
+
+//**********************************************************************************************************************
+// Function s16FLSH_HAL_Write
+//**********************************************************************************************************************
+S16 s16FLSH_HAL_Write (E_FLSH_HAL_TYPE eFlashType, U32 u32Address, U8* pu8Buffer, U32 u32Length, BOOLEAN boBlocking)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                          // Function Return value
+    const C_NVM_HAL_SIM_DEVICE_CFG* pcCfg = &acNVM_HAL_SimDeviceCfg[eNVM_HAL_SIM_DEV_FLASH];
+
+//*************************************************** Function code ****************************************************
+    // Only the program flash is simulated; programming always completes before return
+    (void)eFlashType;
+    (void)boBlocking;
+
+    s16Return = s16NVM_HAL_SimWrite(eNVM_HAL_SIM_DEV_FLASH, u32Address, pu8Buffer, u32Length);
+
+    if (s16Return == KB_RET_OK)
+    {
+        vNVM_HAL_SimStartTransfer(eNVM_HAL_SIM_DEV_FLASH,
+                                  u32NVM_HAL_SimTransferTime(pcCfg->u32LatencyUs, pcCfg->u32WriteBytesPerMs, u32Length));
+        vNVM_HAL_SimWaitTransfer(eNVM_HAL_SIM_DEV_FLASH);
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16FLSH_HAL_Write ***********************************************************************************
+
+//**********************************************************************************************************************
+// Function s16FLSH_HAL_Erase
+//**********************************************************************************************************************
+S16 s16FLSH_HAL_Erase (E_FLSH_HAL_TYPE eFlashType, U8 u8Bank, U8 u8Sector, BOOLEAN boBlocking)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_ERR_ARG;                         // Function Return value
+    U8 u8Idx;                                               // Loop index of sectors
+    const C_NVM_HAL_SIM_FLASH_SECTOR* pcSector;             // Sector to erase
+    C_NVM_HAL_SIM_DEVICE_STATE* pcDev = &acNVM_HAL_SimDevice[eNVM_HAL_SIM_DEV_FLASH];
+    const C_NVM_HAL_SIM_DEVICE_CFG* pcCfg = &acNVM_HAL_SimDeviceCfg[eNVM_HAL_SIM_DEV_FLASH];
+
+//*************************************************** Function code ****************************************************
+    // Only the program flash is simulated; erase always completes before return
+    (void)eFlashType;
+    (void)boBlocking;
+
+    for (u8Idx = 0U; u8Idx < u8NVM_HAL_SimFlashSectorCnt; u8Idx++)
+    {
+        pcSector = &acNVM_HAL_SimFlashSector[u8Idx];
+
+        if ((pcSector->u8Bank == u8Bank) && (pcSector->u8Sector == u8Sector))
+        {
+            s16Return = s16NVM_HAL_SimCheckRange(eNVM_HAL_SIM_DEV_FLASH, pcSector->u32Address, pcSector->u32Size);
+
+            if ((s16Return == KB_RET_OK) && (pcDev->boPoweredDown == TRUE))
+            {
+                // No access after power loss
+                s16Return = KB_RET_ERR_DRIVER;
+            }
+            else if ((s16Return == KB_RET_OK) && (pcDev->eArmedFault != eNVM_HAL_SIM_FAULT_NONE))
+            {
+                // Any armed fault interrupts the erase: the sector is left partially erased
+                memset(&pcDev->pu8Image[pcSector->u32Address - pcCfg->u32BaseAddress],
+                       (int)pcCfg->u8ErasedValue,
+                       (size_t)(pcSector->u32Size / 2U));
+                pcDev->boPoweredDown = (pcDev->eArmedFault == eNVM_HAL_SIM_FAULT_WRITE_INTERRUPT) ? TRUE : FALSE;
+                pcDev->eArmedFault = eNVM_HAL_SIM_FAULT_NONE;
+                pcDev->cStats.u32FaultCnt++;
+                s16Return = KB_RET_ERR_DRIVER;
+            }
+            else if (s16Return == KB_RET_OK)
+            {
+                memset(&pcDev->pu8Image[pcSector->u32Address - pcCfg->u32BaseAddress],
+                       (int)pcCfg->u8ErasedValue,
+                       (size_t)pcSector->u32Size);
+
+                pcDev->cStats.u32EraseCnt++;
+                vNVM_HAL_SimStartTransfer(eNVM_HAL_SIM_DEV_FLASH, pcCfg->u32EraseTimeUs);
+                vNVM_HAL_SimWaitTransfer(eNVM_HAL_SIM_DEV_FLASH);
+            }
+            else
+            {
+                ; // Range error is returned
+            }
+            break;
+        }
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16FLSH_HAL_Erase ***********************************************************************************
+
+// Function s16NVM_HAL_SimMapImage
+//**********************************************************************************************************************
+//! @brief          Opens (creates) and maps the image file of a device.
+//!
+//! @param[in]      eDevice : Simulated device
+//!
+//! @return         Return Code
+//!                  - KB_RET_OK : Successful execution
+//!                  - KB_RET_ERR_DRIVER : Image file can not be created or mapped
+//!
+//! @remarks        A new or too short image is extended and the new part is filled with the erased value.
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_SimMapImage (E_NVM_HAL_SIM_DEVICE eDevice)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    struct stat cFileStat;                                  // Current size of the image file
+    void* pvImage;                                          // Mapped image
+    U32 u32OldSize = 0U;                                    // Initialized part of the image
+    C_NVM_HAL_SIM_DEVICE_STATE* pcDev = &acNVM_HAL_SimDevice[eDevice];
+    const C_NVM_HAL_SIM_DEVICE_CFG* pcCfg = &acNVM_HAL_SimDeviceCfg[eDevice];
+
+//*************************************************** Function code ****************************************************
+    pcDev->iFd = open(pcCfg->pcImageFile, O_RDWR | O_CREAT, 0644);
+
+    if ((pcDev->iFd < 0) || (fstat(pcDev->iFd, &cFileStat) != 0))
+    {
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+    else
+    {
+        // Extend the image to the device size
+        if ((U32)cFileStat.st_size < pcCfg->u32Size)
+        {
+            u32OldSize = (U32)cFileStat.st_size;
+            if (ftruncate(pcDev->iFd, (off_t)pcCfg->u32Size) != 0)
+            {
+                s16Return = KB_RET_ERR_DRIVER;
+            }
+        }
+        else
+        {
+            u32OldSize = pcCfg->u32Size;
+        }
+    }
+
+    if (s16Return == KB_RET_OK)
+    {
+        pvImage = mmap(NULL, (size_t)pcCfg->u32Size, PROT_READ | PROT_WRITE, MAP_SHARED, pcDev->iFd, 0);
+
+        if (pvImage == MAP_FAILED)
+        {
+            s16Return = KB_RET_ERR_DRIVER;
+        }
+        else
+        {
+            pcDev->pu8Image = (U8*)pvImage;
+
+            // New part of the image gets the content of an erased device
+            memset(&pcDev->pu8Image[u32OldSize], (int)pcCfg->u8ErasedValue, (size_t)(pcCfg->u32Size - u32OldSize));
+        }
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_SimMapImage ******************************************************************************
+
+// Function s16NVM_HAL_SimCheckRange
+//**********************************************************************************************************************
+//! @brief          Checks that an access lies completely inside the image of a device.
+//!
+//! @param[in]      eDevice    : Simulated device
+//! @param[in]      u32Address : Device address of the first byte
+//! @param[in]      u32Length  : Number of bytes
+//!
+//! @return         Return Code
+//!                  - KB_RET_OK : Access inside the image
+//!                  - KB_RET_ERR_DRIVER : Simulator not initialized
+//!                  - KB_RET_ERR_ARG : Access outside the image
+//!
+//! @remarks        -
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_SimCheckRange (E_NVM_HAL_SIM_DEVICE eDevice, U32 u32Address, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    const C_NVM_HAL_SIM_DEVICE_CFG* pcCfg = &acNVM_HAL_SimDeviceCfg[eDevice];
+
+//*************************************************** Function code ****************************************************
+    if (boNVM_HAL_SimInitDone == FALSE)
+    {
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+    else if ((u32Address < pcCfg->u32BaseAddress) ||
+             ((u32Address - pcCfg->u32BaseAddress) > pcCfg->u32Size) ||
+             (u32Length > (pcCfg->u32Size - (u32Address - pcCfg->u32BaseAddress))))
+    {
+        s16Return = KB_RET_ERR_ARG;
+    }
+    else
+    {
+        ; // Access is valid
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_SimCheckRange ****************************************************************************
+
+// Function u32NVM_HAL_SimTransferTime
+//**********************************************************************************************************************
+//! @brief          Timing model: duration of a transfer.
+//!
+//! @param[in]      u32LatencyUs  : Fixed command latency in microseconds
+//! @param[in]      u32BytesPerMs : Bandwidth in bytes per millisecond, 0 = unlimited
+//! @param[in]      u32Length     : Number of bytes
+//!
+//! @return         Duration of the transfer in microseconds
+//!
+//! @remarks        -
+//**********************************************************************************************************************
+static U32 u32NVM_HAL_SimTransferTime (U32 u32LatencyUs, U32 u32BytesPerMs, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    U32 u32DurationUs = u32LatencyUs;                       // Duration of the transfer
+
+//*************************************************** Function code ****************************************************
+    if (u32BytesPerMs != 0U)
+    {
+        // Round up, a started microsecond counts
+        u32DurationUs += (U32)((((unsigned long long)u32Length * NVM_HAL_SIM_US_PER_MS) + (u32BytesPerMs - 1U)) /
+                               u32BytesPerMs);
+    }
+
+    // Return result
+    return (u32DurationUs);
+}
+//** EndOfFunction u32NVM_HAL_SimTransferTime **************************************************************************
+
+// Function vNVM_HAL_SimStartTransfer
+//**********************************************************************************************************************
+//! @brief          Marks a device busy for the (scaled) duration of a transfer.
+//!
+//! @param[in]      eDevice       : Simulated device
+//! @param[in]      u32DurationUs : Duration of the transfer in device time
+//!
+//! @return         -
+//!
+//! @remarks        The statistics always count the unscaled device time.
+//**********************************************************************************************************************
+static void vNVM_HAL_SimStartTransfer (E_NVM_HAL_SIM_DEVICE eDevice, U32 u32DurationUs)
+{
+//************************************************ Function scope data *************************************************
+    C_NVM_HAL_SIM_DEVICE_STATE* pcDev = &acNVM_HAL_SimDevice[eDevice];
+    unsigned long long u64ScaledUs;                         // Duration in host time
+
+//*************************************************** Function code ****************************************************
+    pcDev->cStats.u64BusyTimeUs += u32DurationUs;
+
+    u64ScaledUs = ((unsigned long long)u32DurationUs * u32NVM_HAL_SimTimeScalePct) / 100ULL;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &pcDev->cBusyUntil);
+    pcDev->cBusyUntil.tv_sec += (time_t)(u64ScaledUs / NVM_HAL_SIM_US_PER_SEC);
+    pcDev->cBusyUntil.tv_nsec += (long)(u64ScaledUs % NVM_HAL_SIM_US_PER_SEC) * NVM_HAL_SIM_NS_PER_US;
+    if (pcDev->cBusyUntil.tv_nsec >= NVM_HAL_SIM_NS_PER_SEC)
+    {
+        pcDev->cBusyUntil.tv_sec++;
+        pcDev->cBusyUntil.tv_nsec -= NVM_HAL_SIM_NS_PER_SEC;
+    }
+}
+//** EndOfFunction vNVM_HAL_SimStartTransfer ***************************************************************************
+
+// Function s16NVM_HAL_SimChkTransfer
+//**********************************************************************************************************************
+//! @brief          Status of the current transfer of a device.
+//!
+//! @param[in]      eDevice : Simulated device
+//!
+//! @return         Return Code
+//!                  - KB_RET_OK : Transfer finished
+//!                  - NVM_HAL_SIM_RET_BUSY : Transfer in progress
+//!                  - KB_RET_ERR_DRIVER : Transfer finished with an error
+//!
+//! @remarks        -
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_SimChkTransfer (E_NVM_HAL_SIM_DEVICE eDevice)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    struct timespec cNow;                                   // Current host time
+    C_NVM_HAL_SIM_DEVICE_STATE* pcDev = &acNVM_HAL_SimDevice[eDevice];
+
+//*************************************************** Function code ****************************************************
+    (void)clock_gettime(CLOCK_MONOTONIC, &cNow);
+
+    if ((cNow.tv_sec < pcDev->cBusyUntil.tv_sec) ||
+        ((cNow.tv_sec == pcDev->cBusyUntil.tv_sec) && (cNow.tv_nsec < pcDev->cBusyUntil.tv_nsec)))
+    {
+        s16Return = NVM_HAL_SIM_RET_BUSY;
+    }
+    else if (pcDev->boTransferError == TRUE)
+    {
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+    else
+    {
+        ; // Transfer finished
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_SimChkTransfer ***************************************************************************
+
+// Function vNVM_HAL_SimWaitTransfer
+//**********************************************************************************************************************
+//! @brief          Sleeps until the current transfer of a device has finished (blocking interfaces).
+//!
+//! @param[in]      eDevice : Simulated device
+//!
+//! @return         -
+//!
+//! @remarks        -
+//**********************************************************************************************************************
+static void vNVM_HAL_SimWaitTransfer (E_NVM_HAL_SIM_DEVICE eDevice)
+{
+//*************************************************** Function code ****************************************************
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &acNVM_HAL_SimDevice[eDevice].cBusyUntil, NULL) != 0)
+    {
+        ; // interrupted by a signal, sleep again
+    }
+}
+//** EndOfFunction vNVM_HAL_SimWaitTransfer ****************************************************************************
+
+// Function s16NVM_HAL_SimWrite
+//**********************************************************************************************************************
+//! @brief          Writes data into the image of a device, applying the armed one-shot fault.
+//!
+//! @param[in]      eDevice    : Simulated device (FRAM or FLASH)
+//! @param[in]      u32Address : Device address of the first byte
+//! @param[in]      pu8Src     : Data to write
+//! @param[in]      u32Length  : Number of bytes
+//!
+//! @return         Return Code
+//!                  - KB_RET_OK : Data written (FRAM: transfer started)
+//!                  - KB_RET_ERR_DRIVER : Device powered down or injected error (flash)
+//!                  - KB_RET_ERR_ARG / KB_RET_ERR_INST_PTR : Invalid arguments
+//!
+//! @remarks        Flash programming can only clear bits. An interrupted write stores the configured number of
+//!                 bytes and leaves the device powered down until the next simulated power cycle.
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_SimWrite (E_NVM_HAL_SIM_DEVICE eDevice, U32 u32Address, const U8* pu8Src, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                          // Function Return value
+    U32 u32Written = u32Length;                             // Number of bytes reaching the device
+    U32 u32Idx;                                             // Loop index of bytes
+    U8* pu8Dst;                                             // Destination in the image
+    C_NVM_HAL_SIM_DEVICE_STATE* pcDev = &acNVM_HAL_SimDevice[eDevice];
+
+//*************************************************** Function code ****************************************************
+    s16Return = s16NVM_HAL_SimCheckRange(eDevice, u32Address, u32Length);
+
+    if ((s16Return == KB_RET_OK) && (pu8Src == KB_NULL_PTR))
+    {
+        s16Return = KB_RET_ERR_INST_PTR;
+    }
+    else if ((s16Return == KB_RET_OK) && (pcDev->boPoweredDown == TRUE))
+    {
+        // No access after power loss
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+    else if (s16Return == KB_RET_OK)
+    {
+        pcDev->boTransferError = FALSE;
+
+        // Apply the armed fault
+        if (pcDev->eArmedFault == eNVM_HAL_SIM_FAULT_WRITE_INTERRUPT)
+        {
+            u32Written = (pcDev->u32FaultParam < u32Length) ? pcDev->u32FaultParam : u32Length;
+            pcDev->boPoweredDown = TRUE;
+            pcDev->boTransferError = TRUE;
+            pcDev->cStats.u32FaultCnt++;
+        }
+        else if (pcDev->eArmedFault == eNVM_HAL_SIM_FAULT_DRIVER_ERROR)
+        {
+            u32Written = 0U;
+            pcDev->boTransferError = TRUE;
+            pcDev->cStats.u32FaultCnt++;
+        }
+        else
+        {
+            ; // No fault
+        }
+        pcDev->eArmedFault = eNVM_HAL_SIM_FAULT_NONE;
+
+        pu8Dst = &pcDev->pu8Image[u32Address - acNVM_HAL_SimDeviceCfg[eDevice].u32BaseAddress];
+
+        if (eDevice == eNVM_HAL_SIM_DEV_FLASH)
+        {
+            // Programming can only clear bits
+            for (u32Idx = 0U; u32Idx < u32Written; u32Idx++)
+            {
+                pu8Dst[u32Idx] &= pu8Src[u32Idx];
+            }
+
+            // Flash interfaces are blocking, errors are returned directly
+            if (pcDev->boTransferError == TRUE)
+            {
+                s16Return = KB_RET_ERR_DRIVER;
+            }
+        }
+        else
+        {
+            memcpy(pu8Dst, pu8Src, (size_t)u32Written);
+        }
+
+        pcDev->cStats.u32WriteCnt++;
+        pcDev->cStats.u32WriteBytes += u32Written;
+    }
+    else
+    {
+        ; // Range error is returned
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_SimWrite *********************************************************************************
+
+//** EndOfFile nvm_hal_sim.c *******************************************************************************************
@@ -0,0 +1,421 @@
+//**********************************************************************************************************************
+//
+//                                                 nvm_hal_sim_test.c
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date 2026-10-19
+//! @author agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file nvm_hal_sim_test.c
+//! @brief NVM HAL - Host test of the NVM device simulator (nvm_hal_sim.c) and of the NVM_DEVICE_ID2 log store
+//!        (nvm_hal_flog.c) running on it.
+//!
+//!        Checks with the device configuration of cfg_nvm_hal_sim.c:
+//!        - FRAM HAL: no access before s16NVM_HAL_SimInit, erased content of new images, write and read back,
+//!          busy status for the time of the timing model, one transfer at a time, statistics,
+//!        - fault injection: driver error, bit flip, interrupted write with power down until the next power cycle,
+//!        - POFF buffer: retained by a warm power cycle and by s16NVM_HAL_SimExit / s16NVM_HAL_SimInit, cleared by
+//!          a cold power cycle; FRAM content kept in the image file,
+//!        - log store: write and read back, a record write interrupted by a power loss is ignored at the next
+//!          s16NVM_HAL_FlogInit, garbage collection into the spare sector, content after a restart.
+//!        The image files are created in a new directory below /tmp, which is removed at the end.
+//!        The devices run with real time timing, the test takes a few seconds.
+//!
+//!        Build on the host with the headers of the HAL libraries:
+//!            gcc -O2 -I<kb_types.h, kb_ret.h> -I<fram_hal.h, flsh_hal.h, nvm_hal_i.h> -I../include
+//!                -I../../ecal01/include -I../../ecal01.int/include
+//!                nvm_hal_sim_test.c ../source/nvm_hal_sim.c ../source/cfg_nvm_hal_sim.c
+//!                ../../ecal01/source/nvm_hal_flog.c ../../ecal01/source/cfg_nvm_hal_poff.c
+//!        Exit code 0 if all checks passed.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "kb_types.h"                                           // Standard definitions
+#include "kb_ret.h"                                             // Global Knorr-Bremse return value definitions
+#include "fram_hal.h"                                           // Simulated FRAM HAL
+#include "flsh_hal.h"                                           // Simulated flash HAL
+#include "nvm_hal_i.h"                                          // POFF buffer
+#include "cfg_nvm_hal_poff_i.h"                                 // POFF buffer size
+#include "nvm_hal_bs_i.h"                                       // Program flash sectors
+#include "nvm_hal_flog_i.h"                                     // Log store of NVM_DEVICE_ID2
+#include "nvm_hal_sim.h"                                        // Tested simulator
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! FRAM address and length of the transfers
+#define NVM_HAL_SIM_TEST_ADDR            ((U32) 0x1000)
+#define NVM_HAL_SIM_TEST_LEN             ((U32) 256)
+
+//! Duration of a FRAM transfer of NVM_HAL_SIM_TEST_LEN bytes: 5 us latency + 256 bytes at 1250 bytes per ms
+#define NVM_HAL_SIM_TEST_FRAM_US         ((U64) 210)
+
+//! Bytes of the interrupted FRAM write which reach the device
+#define NVM_HAL_SIM_TEST_REACHED         ((U32) 10)
+
+//! Bytes of the interrupted record write which reach the flash (inside the page data)
+#define NVM_HAL_SIM_TEST_FLASH_REACHED   ((U32) 60)
+
+//! Pages used by the log store test
+#define NVM_HAL_SIM_TEST_PAGES           8U
+
+//! Page updates of the garbage collection test, more records than fit into a sector
+#define NVM_HAL_SIM_TEST_UPDATES         400U
+
+//! Duration of a flash sector erase in us (cfg_nvm_hal_sim.c)
+#define NVM_HAL_SIM_TEST_ERASE_US        ((U64) 700000)
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+static U8 au8NVM_HAL_SimTestData[NVM_HAL_SIM_TEST_LEN];        // Data written
+static U8 au8NVM_HAL_SimTestRead[NVM_HAL_SIM_TEST_LEN];        // Data read
+static U8 au8NVM_HAL_SimTestSeed[NVM_HAL_SIM_TEST_PAGES];      // Seed of the last content of each page
+static U32 u32NVM_HAL_SimTestErrors = 0U;                       // Number of failed checks
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+static S16 s16NVM_HAL_SimTestWait (void);
+static void vNVM_HAL_SimTestFill (U8* pu8Buffer, U32 u32Length, U8 u8Seed);
+static BOOLEAN boNVM_HAL_SimTestPage (U32 u32Page, U8 u8Seed);
+static BOOLEAN boNVM_HAL_SimTestPages (void);
+static void vNVM_HAL_SimTestCheck (const char* pcName, BOOLEAN boOk);
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+// Function main
+//**********************************************************************************************************************
+int main (void)
+{
+//************************************************ Function scope data *************************************************
+    char acDir[] = "/tmp/nvm_hal_sim_XXXXXX";                   // Directory of the image files
+    C_NVM_HAL_SIM_STATS cStats;                                 // Statistics of a device
+    struct timespec cStart;                                     // Start of a transfer
+    struct timespec cEnd;                                       // End of a transfer
+    U64 u64ElapsedUs;                                           // Duration of a transfer
+    U32 u32Idx;                                                 // Loop index
+    U8 u8Device;                                                // Loop index of devices
+    BOOLEAN boOk;                                               // Result of a check
+
+//*************************************************** Function code ****************************************************
+    if ((mkdtemp(acDir) == NULL) || (chdir(acDir) != 0))
+    {
+        (void) printf("nvm_hal_sim: no directory for the image files\n");
+        return (EXIT_FAILURE);
+    }
+
+    // Initialisation and new images
+    vNVM_HAL_SimTestCheck("FRAM before init", s16FRAM_HAL_Init() == KB_RET_ERR_DRIVER);
+    vNVM_HAL_SimTestCheck("flash before init", s16FLSH_HAL_Init() == KB_RET_ERR_DRIVER);
+    vNVM_HAL_SimTestCheck("init", s16NVM_HAL_SimInit() == KB_RET_OK);
+    vNVM_HAL_SimTestCheck("HAL init", (s16FRAM_HAL_Init() == KB_RET_OK) && (s16FLSH_HAL_Init() == KB_RET_OK));
+    (void) memset(au8NVM_HAL_SimTestRead, 0xAA, sizeof(au8NVM_HAL_SimTestRead));
+    boOk = ((s16FRAM_HAL_Read(au8NVM_HAL_SimTestRead, NVM_HAL_SIM_TEST_ADDR, NVM_HAL_SIM_TEST_LEN) == KB_RET_OK) &&
+            (s16NVM_HAL_SimTestWait() == KB_RET_OK)) ? TRUE : FALSE;
+    for (u32Idx = 0U; u32Idx < NVM_HAL_SIM_TEST_LEN; u32Idx++)
+    {
+        boOk = ((boOk == TRUE) && (au8NVM_HAL_SimTestRead[u32Idx] == 0x00U)) ? TRUE : FALSE;
+    }
+    vNVM_HAL_SimTestCheck("new FRAM", boOk);
+    boOk = (s16FLSH_HAL_Read(eFLSH_HAL_TYPE_PFLASH, NVM_PFLASH_SECTOR_1_ADDR, au8NVM_HAL_SimTestRead,
+                             NVM_HAL_SIM_TEST_LEN) == KB_RET_OK) ? TRUE : FALSE;
+    for (u32Idx = 0U; u32Idx < NVM_HAL_SIM_TEST_LEN; u32Idx++)
+    {
+        boOk = ((boOk == TRUE) && (au8NVM_HAL_SimTestRead[u32Idx] == 0xFFU)) ? TRUE : FALSE;
+    }
+    vNVM_HAL_SimTestCheck("new flash", boOk);
+    vNVM_HAL_SimTestCheck("outside the FRAM", s16FRAM_HAL_Read(au8NVM_HAL_SimTestRead, 131072U - 16U,
+                                                               NVM_HAL_SIM_TEST_LEN) == KB_RET_ERR_ARG);
+    for (u8Device = 0U; u8Device < (U8) eNVM_HAL_SIM_DEV_MAX; u8Device++)
+    {
+        (void) s16NVM_HAL_SimGetStats((E_NVM_HAL_SIM_DEVICE) u8Device, &cStats, TRUE);
+    }
+
+    // FRAM write, busy status, read back and statistics
+    vNVM_HAL_SimTestFill(au8NVM_HAL_SimTestData, NVM_HAL_SIM_TEST_LEN, 1U);
+    (void) clock_gettime(CLOCK_MONOTONIC, &cStart);
+    vNVM_HAL_SimTestCheck("write", s16FRAM_HAL_Write(NVM_HAL_SIM_TEST_ADDR, au8NVM_HAL_SimTestData,
+                                                     NVM_HAL_SIM_TEST_LEN) == KB_RET_OK);
+    vNVM_HAL_SimTestCheck("busy", s16FRAM_HAL_ChkWriteStatus() == NVM_HAL_SIM_RET_BUSY);
+    vNVM_HAL_SimTestCheck("one transfer", s16FRAM_HAL_Write(NVM_HAL_SIM_TEST_ADDR, au8NVM_HAL_SimTestData,
+                                                            NVM_HAL_SIM_TEST_LEN) == KB_RET_ERR_DRIVER);
+    vNVM_HAL_SimTestCheck("written", s16NVM_HAL_SimTestWait() == KB_RET_OK);
+    (void) clock_gettime(CLOCK_MONOTONIC, &cEnd);
+    u64ElapsedUs = (((U64) (cEnd.tv_sec - cStart.tv_sec) * 1000000U) + (U64) (cEnd.tv_nsec / 1000)) -
+                   (U64) (cStart.tv_nsec / 1000);
+    vNVM_HAL_SimTestCheck("write time", u64ElapsedUs >= (NVM_HAL_SIM_TEST_FRAM_US - 1U));
+    vNVM_HAL_SimTestCheck("read back", (s16FRAM_HAL_Read(au8NVM_HAL_SimTestRead, NVM_HAL_SIM_TEST_ADDR,
+                                                         NVM_HAL_SIM_TEST_LEN) == KB_RET_OK) &&
+                                       (s16NVM_HAL_SimTestWait() == KB_RET_OK) &&
+                                       (memcmp(au8NVM_HAL_SimTestRead, au8NVM_HAL_SimTestData,
+                                               NVM_HAL_SIM_TEST_LEN) == 0));
+    vNVM_HAL_SimTestCheck("statistics", (s16NVM_HAL_SimGetStats(eNVM_HAL_SIM_DEV_FRAM, &cStats, TRUE) == KB_RET_OK) &&
+                                        (cStats.u32WriteCnt == 1U) && (cStats.u32ReadCnt == 1U) &&
+                                        (cStats.u32WriteBytes == NVM_HAL_SIM_TEST_LEN) &&
+                                        (cStats.u32ReadBytes == NVM_HAL_SIM_TEST_LEN) &&
+                                        (cStats.u64BusyTimeUs == (2U * NVM_HAL_SIM_TEST_FRAM_US)));
+
+    // Driver error: the read fails, the destination is not touched
+    vNVM_HAL_SimTestCheck("arm driver error", s16NVM_HAL_SimInjectFault(eNVM_HAL_SIM_DEV_FRAM,
+                                                                        eNVM_HAL_SIM_FAULT_DRIVER_ERROR,
+                                                                        0U, 0U) == KB_RET_OK);
+    (void) memset(au8NVM_HAL_SimTestRead, 0x5A, sizeof(au8NVM_HAL_SimTestRead));
+    vNVM_HAL_SimTestCheck("driver error", (s16FRAM_HAL_Read(au8NVM_HAL_SimTestRead, NVM_HAL_SIM_TEST_ADDR,
+                                                            NVM_HAL_SIM_TEST_LEN) == KB_RET_OK) &&
+                                          (s16NVM_HAL_SimTestWait() == KB_RET_ERR_DRIVER) &&
+                                          (au8NVM_HAL_SimTestRead[0] == 0x5AU));
+    vNVM_HAL_SimTestCheck("after driver error", (s16FRAM_HAL_Read(au8NVM_HAL_SimTestRead, NVM_HAL_SIM_TEST_ADDR,
+                                                                  NVM_HAL_SIM_TEST_LEN) == KB_RET_OK) &&
+                                                (s16NVM_HAL_SimTestWait() == KB_RET_OK) &&
+                                                (au8NVM_HAL_SimTestRead[0] == au8NVM_HAL_SimTestData[0]));
+
+    // Bit flip in the image
+    vNVM_HAL_SimTestCheck("bit flip", (s16NVM_HAL_SimInjectFault(eNVM_HAL_SIM_DEV_FRAM, eNVM_HAL_SIM_FAULT_BIT_FLIP,
+                                                                 NVM_HAL_SIM_TEST_ADDR + 20U, 3U) == KB_RET_OK) &&
+                                      (s16FRAM_HAL_Read(au8NVM_HAL_SimTestRead, NVM_HAL_SIM_TEST_ADDR,
+                                                        NVM_HAL_SIM_TEST_LEN) == KB_RET_OK) &&
+                                      (s16NVM_HAL_SimTestWait() == KB_RET_OK) &&
+                                      (au8NVM_HAL_SimTestRead[20] == (U8) (au8NVM_HAL_SimTestData[20] ^ 0x08U)));
+    au8NVM_HAL_SimTestData[20] ^= 0x08U;
+
+    // Interrupted write: part of the data reaches the device, no access until the next power cycle
+    vNVM_HAL_SimTestFill(au8NVM_HAL_SimTestRead, NVM_HAL_SIM_TEST_LEN, 2U);
+    vNVM_HAL_SimTestCheck("interrupted write", (s16NVM_HAL_SimInjectFault(eNVM_HAL_SIM_DEV_FRAM,
+                                                                          eNVM_HAL_SIM_FAULT_WRITE_INTERRUPT, 0U,
+                                                                          NVM_HAL_SIM_TEST_REACHED) == KB_RET_OK) &&
+                                               (s16FRAM_HAL_Write(NVM_HAL_SIM_TEST_ADDR, au8NVM_HAL_SimTestRead,
+                                                                  NVM_HAL_SIM_TEST_LEN) == KB_RET_OK) &&
+                                               (s16NVM_HAL_SimTestWait() == KB_RET_ERR_DRIVER));
+    (void) memcpy(au8NVM_HAL_SimTestData, au8NVM_HAL_SimTestRead, NVM_HAL_SIM_TEST_REACHED);
+    vNVM_HAL_SimTestCheck("powered down", s16FRAM_HAL_Read(au8NVM_HAL_SimTestRead, NVM_HAL_SIM_TEST_ADDR,
+                                                           NVM_HAL_SIM_TEST_LEN) == KB_RET_ERR_DRIVER);
+    vNVM_HAL_SimTestCheck("power cycle", s16NVM_HAL_SimPowerCycle(FALSE) == KB_RET_OK);
+    vNVM_HAL_SimTestCheck("reached part", (s16FRAM_HAL_Read(au8NVM_HAL_SimTestRead, NVM_HAL_SIM_TEST_ADDR,
+                                                            NVM_HAL_SIM_TEST_LEN) == KB_RET_OK) &&
+                                          (s16NVM_HAL_SimTestWait() == KB_RET_OK) &&
+                                          (memcmp(au8NVM_HAL_SimTestRead, au8NVM_HAL_SimTestData,
+                                                  NVM_HAL_SIM_TEST_LEN) == 0));
+
+    // POFF buffer and FRAM image across power cycles and restarts
+    au32NVM_HAL_PoffHwBuffer[0] = 0x12345678U;
+    au32NVM_HAL_PoffHwBuffer[(NVM_HAL_POFF_BUFF_SIZE / 4U) - 1U] = 0x9ABCDEF0U;
+    vNVM_HAL_SimTestCheck("warm power cycle", (s16NVM_HAL_SimPowerCycle(FALSE) == KB_RET_OK) &&
+                                              (au32NVM_HAL_PoffHwBuffer[0] == 0x12345678U));
+    vNVM_HAL_SimTestCheck("exit", s16NVM_HAL_SimExit() == KB_RET_OK);
+    vNVM_HAL_SimTestCheck("no access after exit", s16FRAM_HAL_Read(au8NVM_HAL_SimTestRead, NVM_HAL_SIM_TEST_ADDR,
+                                                                   NVM_HAL_SIM_TEST_LEN) == KB_RET_ERR_DRIVER);
+    (void) memset(au32NVM_HAL_PoffHwBuffer, 0, NVM_HAL_POFF_BUFF_SIZE);
+    vNVM_HAL_SimTestCheck("restart", s16NVM_HAL_SimInit() == KB_RET_OK);
+    vNVM_HAL_SimTestCheck("POFF buffer restored",
+                          (au32NVM_HAL_PoffHwBuffer[0] == 0x12345678U) &&
+                          (au32NVM_HAL_PoffHwBuffer[(NVM_HAL_POFF_BUFF_SIZE / 4U) - 1U] == 0x9ABCDEF0U));
+    vNVM_HAL_SimTestCheck("FRAM kept", (s16FRAM_HAL_Read(au8NVM_HAL_SimTestRead, NVM_HAL_SIM_TEST_ADDR,
+                                                         NVM_HAL_SIM_TEST_LEN) == KB_RET_OK) &&
+                                       (s16NVM_HAL_SimTestWait() == KB_RET_OK) &&
+                                       (memcmp(au8NVM_HAL_SimTestRead, au8NVM_HAL_SimTestData,
+                                               NVM_HAL_SIM_TEST_LEN) == 0));
+    vNVM_HAL_SimTestCheck("cold power cycle", (s16NVM_HAL_SimPowerCycle(TRUE) == KB_RET_OK) &&
+                                              (au32NVM_HAL_PoffHwBuffer[0] == 0U));
+
+    // Log store: write and read back
+    vNVM_HAL_SimTestCheck("log store init", s16NVM_HAL_FlogInit() == KB_RET_OK);
+    boOk = TRUE;
+    for (u32Idx = 0U; u32Idx < NVM_HAL_SIM_TEST_PAGES; u32Idx++)
+    {
+        au8NVM_HAL_SimTestSeed[u32Idx] = (U8) (10U + u32Idx);
+        vNVM_HAL_SimTestFill(au8NVM_HAL_SimTestData, NVM_HAL_FLOG_PAGE_SIZE, au8NVM_HAL_SimTestSeed[u32Idx]);
+        boOk = ((boOk == TRUE) && (s16NVM_HAL_FlogWrite(u32Idx * NVM_HAL_FLOG_PAGE_SIZE, au8NVM_HAL_SimTestData,
+                                                        NVM_HAL_FLOG_PAGE_SIZE) == KB_RET_OK)) ? TRUE : FALSE;
+    }
+    vNVM_HAL_SimTestCheck("log store write", (boOk == TRUE) && (boNVM_HAL_SimTestPages() == TRUE));
+    vNVM_HAL_SimTestCheck("log store unwritten", boNVM_HAL_SimTestPage(NVM_HAL_SIM_TEST_PAGES, 0U) == TRUE);
+
+    // Log store: power loss while a record is written, the old content is read after the restart
+    vNVM_HAL_SimTestFill(au8NVM_HAL_SimTestData, NVM_HAL_FLOG_PAGE_SIZE, 99U);
+    vNVM_HAL_SimTestCheck("log store interrupted", (s16NVM_HAL_SimInjectFault(eNVM_HAL_SIM_DEV_FLASH,
+                                                                              eNVM_HAL_SIM_FAULT_WRITE_INTERRUPT, 0U,
+                                                                              NVM_HAL_SIM_TEST_FLASH_REACHED) ==
+                                                    KB_RET_OK) &&
+                                                   (s16NVM_HAL_FlogWrite(NVM_HAL_FLOG_PAGE_SIZE,
+                                                                         au8NVM_HAL_SimTestData,
+                                                                         NVM_HAL_FLOG_PAGE_SIZE) != KB_RET_OK));
+    vNVM_HAL_SimTestCheck("log store restart", (s16NVM_HAL_SimPowerCycle(FALSE) == KB_RET_OK) &&
+                                               (s16NVM_HAL_FlogInit() == KB_RET_OK) &&
+                                               (boNVM_HAL_SimTestPages() == TRUE));
+    au8NVM_HAL_SimTestSeed[1] = 99U;
+    vNVM_HAL_SimTestCheck("log store after power loss", (s16NVM_HAL_FlogWrite(NVM_HAL_FLOG_PAGE_SIZE,
+                                                                              au8NVM_HAL_SimTestData,
+                                                                              NVM_HAL_FLOG_PAGE_SIZE) == KB_RET_OK) &&
+                                                        (boNVM_HAL_SimTestPages() == TRUE));
+
+    // Log store: more updates than fit into a sector, garbage collection into the spare sector
+    (void) s16NVM_HAL_SimGetStats(eNVM_HAL_SIM_DEV_FLASH, &cStats, TRUE);
+    boOk = TRUE;
+    for (u32Idx = 0U; (u32Idx < NVM_HAL_SIM_TEST_UPDATES) && (boOk == TRUE); u32Idx++)
+    {
+        au8NVM_HAL_SimTestSeed[u32Idx % NVM_HAL_SIM_TEST_PAGES] = (U8) (100U + u32Idx);
+        vNVM_HAL_SimTestFill(au8NVM_HAL_SimTestData, NVM_HAL_FLOG_PAGE_SIZE, (U8) (100U + u32Idx));
+        boOk = (s16NVM_HAL_FlogWrite((u32Idx % NVM_HAL_SIM_TEST_PAGES) * NVM_HAL_FLOG_PAGE_SIZE,
+                                     au8NVM_HAL_SimTestData, NVM_HAL_FLOG_PAGE_SIZE) == KB_RET_OK) ? TRUE : FALSE;
+    }
+    vNVM_HAL_SimTestCheck("log store updates", (boOk == TRUE) && (boNVM_HAL_SimTestPages() == TRUE));
+    vNVM_HAL_SimTestCheck("garbage collection", (s16NVM_HAL_SimGetStats(eNVM_HAL_SIM_DEV_FLASH, &cStats, FALSE) ==
+                                                 KB_RET_OK) && (cStats.u32EraseCnt >= 1U) &&
+                                                (cStats.u64BusyTimeUs >=
+                                                 ((U64) cStats.u32EraseCnt * NVM_HAL_SIM_TEST_ERASE_US)));
+    vNVM_HAL_SimTestCheck("log store restarted", (s16NVM_HAL_SimExit() == KB_RET_OK) &&
+                                                 (s16NVM_HAL_SimInit() == KB_RET_OK) &&
+                                                 (s16NVM_HAL_FlogInit() == KB_RET_OK) &&
+                                                 (boNVM_HAL_SimTestPages() == TRUE));
+
+    // Remove the image files
+    (void) s16NVM_HAL_SimExit();
+    for (u8Device = 0U; u8Device < (U8) eNVM_HAL_SIM_DEV_MAX; u8Device++)
+    {
+        (void) unlink(acNVM_HAL_SimDeviceCfg[u8Device].pcImageFile);
+    }
+    (void) chdir("/");
+    (void) rmdir(acDir);
+
+    (void) printf("nvm_hal_sim: %lu check(s) failed\n", (unsigned long) u32NVM_HAL_SimTestErrors);
+
+    return ((u32NVM_HAL_SimTestErrors == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+//** EndOfFunction main ************************************************************************************************
+
+// Function s16NVM_HAL_SimTestWait
+//**********************************************************************************************************************
+//! @brief          Waits for the end of the current FRAM transfer.
+//!
+//! @return         Status of the finished transfer
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_SimTestWait (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                              // Function return variable
+
+//*************************************************** Function code ****************************************************
+    do
+    {
+        s16Return = s16FRAM_HAL_ChkWriteStatus();
+    } while (s16Return == NVM_HAL_SIM_RET_BUSY);
+
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_SimTestWait ******************************************************************************
+
+// Function vNVM_HAL_SimTestFill
+//**********************************************************************************************************************
+//! @brief          Fills a buffer with a pattern.
+//!
+//! @param[out]     pu8Buffer : Buffer
+//! @param[in]      u32Length : Number of bytes
+//! @param[in]      u8Seed    : Seed of the pattern, 0 = erased flash
+//!
+//! @return         -
+//**********************************************************************************************************************
+static void vNVM_HAL_SimTestFill (U8* pu8Buffer, U32 u32Length, U8 u8Seed)
+{
+//************************************************ Function scope data *************************************************
+    U32 u32Idx;                                                 // Loop index
+
+//*************************************************** Function code ****************************************************
+    for (u32Idx = 0U; u32Idx < u32Length; u32Idx++)
+    {
+        pu8Buffer[u32Idx] = (u8Seed == 0U) ? 0xFFU : (U8) ((u8Seed * 31U) + (u32Idx * 7U));
+    }
+}
+//** EndOfFunction vNVM_HAL_SimTestFill ********************************************************************************
+
+// Function boNVM_HAL_SimTestPage
+//**********************************************************************************************************************
+//! @brief          Checks the content of a page of the log store.
+//!
+//! @param[in]      u32Page : Page
+//! @param[in]      u8Seed  : Seed of the expected content, 0 = erased flash
+//!
+//! @return         TRUE if the page holds the expected content
+//**********************************************************************************************************************
+static BOOLEAN boNVM_HAL_SimTestPage (U32 u32Page, U8 u8Seed)
+{
+//************************************************ Function scope data *************************************************
+    U8 au8Expected[NVM_HAL_FLOG_PAGE_SIZE];                     // Expected content
+
+//*************************************************** Function code ****************************************************
+    vNVM_HAL_SimTestFill(au8Expected, NVM_HAL_FLOG_PAGE_SIZE, u8Seed);
+    (void) memset(au8NVM_HAL_SimTestRead, 0, sizeof(au8NVM_HAL_SimTestRead));
+
+    return (((s16NVM_HAL_FlogRead(u32Page * NVM_HAL_FLOG_PAGE_SIZE, au8NVM_HAL_SimTestRead,
+                                  NVM_HAL_FLOG_PAGE_SIZE) == KB_RET_OK) &&
+             (memcmp(au8NVM_HAL_SimTestRead, au8Expected, NVM_HAL_FLOG_PAGE_SIZE) == 0)) ? TRUE : FALSE);
+}
+//** EndOfFunction boNVM_HAL_SimTestPage *******************************************************************************
+
+// Function boNVM_HAL_SimTestPages
+//**********************************************************************************************************************
+//! @brief          Checks the content of all pages used by the test.
+//!
+//! @return         TRUE if all pages hold their last written content
+//**********************************************************************************************************************
+static BOOLEAN boNVM_HAL_SimTestPages (void)
+{
+//************************************************ Function scope data *************************************************
+    BOOLEAN boOk = TRUE;                                        // Function return variable
+    U32 u32Page;                                                // Loop index of pages
+
+//*************************************************** Function code ****************************************************
+    for (u32Page = 0U; (u32Page < NVM_HAL_SIM_TEST_PAGES) && (boOk == TRUE); u32Page++)
+    {
+        boOk = boNVM_HAL_SimTestPage(u32Page, au8NVM_HAL_SimTestSeed[u32Page]);
+    }
+
+    return (boOk);
+}
+//** EndOfFunction boNVM_HAL_SimTestPages ******************************************************************************
+
+// Function vNVM_HAL_SimTestCheck
+//**********************************************************************************************************************
+//! @brief          Counts a failed check.
+//!
+//! @param[in]      pcName : Name of the check
+//! @param[in]      boOk   : Result of the check
+//!
+//! @return         -
+//**********************************************************************************************************************
+static void vNVM_HAL_SimTestCheck (const char* pcName, BOOLEAN boOk)
+{
+//*************************************************** Function code ****************************************************
+    if (boOk == FALSE)
+    {
+        (void) printf("FAIL %s\n", pcName);
+        u32NVM_HAL_SimTestErrors++;
+    }
+}
+//** EndOfFunction vNVM_HAL_SimTestCheck *******************************************************************************
+
+// EndOfFile nvm_hal_sim_test.c ****************************************************************************************
@@ -24,6 +24,7 @@
 //  2019-03-06	K. Gade        Start
 //  2022-11-21  J. Lulli       Coding guidelines alignment
 //  2023-12-07  C. Brancolini  Lint clean up
+//  2026-10-19  agent          Line size for the incremental POFF save, without generation counter (descoped)
 //**************************************************************************************************
 #ifndef CFG_NVM_HAL_POFF_I_H
 #define CFG_NVM_HAL_POFF_I_H
@@ -59,6 +60,12 @@
 #define NVM_HAL_POFF_BUFF_AREAS_STARTIDX_NONFWR_U32    (NVM_HAL_POFF_BUFF_AREAS_STARTIDX_U32 +   \
                                                        NVM_HAL_POFF_BUFF_AREAS_SIZE_FWR_U32)
 
+//! Granularity of the incremental POFF save (s16NVM_HAL_AdpPoffWrite): only lines which differ from the shadow of
+//! the FRAM save area are written. Descoped: there is no dirty marking by the POFF writers (no hook in the GenCA
+//! POFF HAL) and no generation counter of the save. The consistency of a restored save is left to the counters of
+//! the POFF HAL (CNT2 at u32NVM_HAL_CFG_PoffCnt2Idx), whose lines are written like any other changed line.
+#define NVM_HAL_POFF_LINE_SIZE                  ((U32) 32)
+
 //******************************** Type definitions ( typedef ) ************************************
 
 //**************************** Global data declarations ( extern ) *********************************
@@ -21,6 +21,11 @@
 // History
 // Date         Author         Changes
 // 2018-09-07   K. Gade        BC0025-59: Start
+// 2026-10-19   agent          Second flash sector (spare sector of the flash log store), sector addresses and size
+// 2026-10-19   agent          Shadow areas of NVM_DEVICE_ID1 (byte-diff writes)
+// 2026-10-19   agent          Write stamps of NVM_DEVICE_ID1 and NVM_DEVICE_ID2, s16NVM_HAL_AdpGetWriteStamp added
+// 2026-10-19   agent          Operation statistics per area (counters and service time histograms)
+// 2026-10-19   agent          s16NVM_HAL_AdpStatStart added (statistics time source only with running OS)
 //
 //**********************************************************************************************************************
 
@@ -41,17 +46,159 @@
 #define NVM_PFLASH_BANK_0                ((U8) 0)
 
 //! Flash sector numbers to be erased.(referred from '55xflsh.h')
-//#define NVM_PFLASH_SECTOR_0              BL2
+//! Both sectors are used by the log structured store of NVM_DEVICE_ID2 (nvm_hal_flog.c), one of them is the active
+//! sector, the other one is the spare sector for garbage collection.
 #define NVM_PFLASH_SECTOR_0              BL1
+#define NVM_PFLASH_SECTOR_1              BL2
+
+//! Start addresses of the flash sectors, must not be used by code (linker file)
+#define NVM_PFLASH_SECTOR_0_ADDR         ((U32) 0x00004000)
+#define NVM_PFLASH_SECTOR_1_ADDR         ((U32) 0x00010000)
+
+//! Size of each flash sector (L1 and L2 of MPC5534: 48 kBytes)
+#define NVM_PFLASH_SECTOR_SIZE           ((U32) 0xC000)
+
+//! Maximum number of shadow areas of NVM_DEVICE_ID1
+#define NVM_HAL_SHADOW_MAX_AREAS         ((U8) 4)
+
+//! Write stamps: every write increments the stamps of the blocks it touches (block size 1 << SHIFT bytes)
+#define NVM_HAL_WRITE_STAMP_BLOCK_SHIFT  ((U32) 10)
+#define NVM_HAL_WRITE_STAMP_BLOCKS       ((U32) 128)     //!< Blocks per device, covers 128 kBytes
+#define NVM_HAL_WRITE_STAMP_DEVICES      ((U8) 3)        //!< NVM_DEVICE_ID0 (not stamped) to NVM_DEVICE_ID2
+
+//! Operation statistics: maximum number of statistics areas
+#define NVM_HAL_STAT_MAX_AREAS           ((U8) 24)
+
+//! Service time histogram bins: bin 0 below 1 ms, bin n from 2^(n-1) to 2^n - 1 ms, the last bin all longer times
+#define NVM_HAL_STAT_HIST_BINS           ((U8) 8)
+
+//! Layer owning a statistics area
+#define NVM_HAL_STAT_LAYER_HAL           ((U8) 0)
+#define NVM_HAL_STAT_LAYER_SVL           ((U8) 1)
+#define NVM_HAL_STAT_LAYER_APP           ((U8) 2)
+
+//! Area identifier of statistics areas located by offset (NVM_DEVICE_ID1, NVM_DEVICE_ID2)
+#define NVM_HAL_STAT_AREA_ID_ANY         ((U8) 0xFF)
 
 //**************************************** Type definitions ( typedef ) ************************************************
+//! Shadow area of NVM_DEVICE_ID1: a RAM copy of the FRAM content, writes into the area transfer only changed bytes
+typedef struct
+{
+    U32 u32Offset;                                              //!< Offset in NVM_DEVICE_ID1
+    U32 u32Size;                                                //!< Size of the area in bytes
+    U8* pu8Shadow;                                              //!< RAM copy, u32Size bytes
+} C_NVM_HAL_SHADOW_AREA;
+
+//! Operations counted by the statistics
+typedef enum
+{
+    eNVM_HAL_STAT_OP_READ = 0,                                  //!< s16NVM_HAL_AdpRead
+    eNVM_HAL_STAT_OP_WRITE,                                     //!< s16NVM_HAL_AdpWrite
+    eNVM_HAL_STAT_OP_ERASE,                                     //!< s16NVM_HAL_AdpErase
+    eNVM_HAL_STAT_OP_NUM                                        //!< Number of operations
+} E_NVM_HAL_STAT_OP;
+
+//! Statistics area: NVM_DEVICE_ID0 operations are assigned by the POFF area identifier, the operations of the other
+//! devices by their offset. The first matching entry counts the operation.
+typedef struct
+{
+    U8  u8NvmID;                                                //!< Device identifier
+    U8  u8Layer;                                                //!< NVM_HAL_STAT_LAYER_xxx
+    U8  u8AreaID;                                               //!< POFF area identifier or NVM_HAL_STAT_AREA_ID_ANY
+    U32 u32Offset;                                              //!< Offset in the device (not NVM_DEVICE_ID0)
+    U32 u32Size;                                                //!< Size of the area in bytes
+} C_NVM_HAL_STAT_AREA;
+
+//! Statistics of one operation of one area, counters saturate
+typedef struct
+{
+    U32 u32OpCnt;                                               //!< Number of operations
+    U32 u32ByteCnt;                                             //!< Number of bytes transferred
+    U32 u32ErrCnt;                                              //!< Number of failed operations
+    U32 u32MaxTimeMs;                                           //!< Longest service time in ms
+    U32 au32Hist[NVM_HAL_STAT_HIST_BINS];                       //!< Service time histogram
+} C_NVM_HAL_STAT_CNT;
+
+//! Time source of the statistics: current time in ms
+typedef S16 (*T_NVM_HAL_S16FP_STAT_GETTIME)(U32* pu32TimeMs);
 
 //**************************************** Global data declarations ( extern ) *****************************************
 
 //**************************************** External parameter / constant declarations ( extern const )	****************
+//! Shadow areas of NVM_DEVICE_ID1, must not overlap
+extern const C_NVM_HAL_SHADOW_AREA acNVM_HAL_CFG_ShadowArea[];
+
+//! Number of shadow areas (at most NVM_HAL_SHADOW_MAX_AREAS)
+extern const U8 u8NVM_HAL_CFG_ShadowAreaCnt;
+
+//! Unchanged bytes between two changed byte runs up to which the runs are written as one transfer
+extern const U32 u32NVM_HAL_CFG_ShadowMergeGap;
+
+//! Maximum size of one FRAM transfer of a shadow area write (NVM_DEV_1_MX_TXFER_SIZE)
+extern const U32 u32NVM_HAL_CFG_ShadowMaxTxfer;
+
+//! Statistics areas (cfg_nvm_hal.c)
+extern const C_NVM_HAL_STAT_AREA acNVM_HAL_CFG_StatArea[];
+
+//! Number of statistics areas (at most NVM_HAL_STAT_MAX_AREAS)
+extern const U8 u8NVM_HAL_CFG_StatAreaCnt;
+
+//! Time source of the statistics, provided by the OS of the SVL (cfg_nvm.c). KB_NULL_PTR: no service times.
+//! Not called before s16NVM_HAL_AdpStatStart.
+extern const T_NVM_HAL_S16FP_STAT_GETTIME pfs16NVM_HAL_CFG_StatGetTimeMs;
 
 //**************************************** Global func/proc prototypes *************************************************
 
+//* Function s16NVM_HAL_AdpGetWriteStamp *******************************************************************************
+//!
+//! @brief      Returns the write stamp of a range of NVM_DEVICE_ID1 or NVM_DEVICE_ID2. The stamp changes whenever a
+//!             write or erase touches the range, so equal stamps taken before and after reading the range mean the
+//!             content was not changed by NVM in between.
+//!
+//! @param[in]  u8NvmID            : Device identifier
+//! @param[in]  u32LocalAreaOffset : Offset in the device
+//! @param[in]  u32Length          : Length of the range in bytes
+//! @param[out] pu32Stamp          : Write stamp of the range
+//!
+//! @return     KB_RET_OK on success, KB_RET_ERR_ARG for devices without stamps, KB_RET_ERR_INST_PTR for null pointers.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_HAL_AdpGetWriteStamp (U8 u8NvmID, U32 u32LocalAreaOffset, U32 u32Length, U32* pu32Stamp);
+
+//* Function s16NVM_HAL_AdpGetStat *************************************************************************************
+//!
+//! @brief      Returns the statistics of one operation of a statistics area (acNVM_HAL_CFG_StatArea). The copy is
+//!             not synchronised with the NVM task, counters of a running operation may be one apart.
+//!
+//! @param[in]  u8StatArea : Index of the statistics area
+//! @param[in]  eOp        : Operation
+//! @param[out] pcCnt      : Statistics
+//!
+//! @return     KB_RET_OK on success, KB_RET_ERR_ARG for an invalid area or operation, KB_RET_ERR_INST_PTR for null
+//!             pointers.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_HAL_AdpGetStat (U8 u8StatArea, E_NVM_HAL_STAT_OP eOp, C_NVM_HAL_STAT_CNT* pcCnt);
+
+//* Function vNVM_HAL_AdpResetStat *************************************************************************************
+//!
+//! @brief      Clears the statistics of all areas.
+//!
+//! @return     -
+//!
+//**********************************************************************************************************************
+extern void vNVM_HAL_AdpResetStat (void);
+
+//* Function s16NVM_HAL_AdpStatStart ***********************************************************************************
+//!
+//! @brief      Enables the time source of the statistics (pfs16NVM_HAL_CFG_StatGetTimeMs). Called by the SVL once the
+//!             OS is running (BCM startup), operations before are counted without service time (bin 0).
+//!
+//! @return     KB_RET_OK
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_HAL_AdpStatStart (void);
+
 #endif // NVM_HAL_BS_I_H
 
 // EndOfFile nvm_hal_bs_i.h ****************************************************************************************************
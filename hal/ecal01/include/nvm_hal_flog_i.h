@@ -0,0 +1,102 @@
+//**********************************************************************************************************************
+//
+//                                                 nvm_hal_flog_i.h
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date 2026-10-19
+//! @author agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file nvm_hal_flog_i.h
+//! @brief NVM HAL - Log structured store of NVM_DEVICE_ID2 (program flash).
+//!
+//!        The logical content of the device is split into pages. Every update of a page is appended as a record to
+//!        the active flash sector; a RAM index points to the newest record of each page. When the active sector is
+//!        full, the newest records are copied into the spare sector, which then becomes the active one.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+//
+//**********************************************************************************************************************
+
+#ifndef NVM_HAL_FLOG_I_H
+#define NVM_HAL_FLOG_I_H
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "kb_types.h"                                           // Standard definitions
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Size of a page in bytes, also the maximum transfer size of NVM_DEVICE_ID2
+#define NVM_HAL_FLOG_PAGE_SIZE           ((U32) 0x80)
+
+//! Logical size of NVM_DEVICE_ID2. At most half of a sector, so that garbage collection always frees space.
+#define NVM_HAL_FLOG_LOGICAL_SIZE        ((U32) 0x6000)
+
+//! Number of pages
+#define NVM_HAL_FLOG_MAX_PAGES           ((U32)(NVM_HAL_FLOG_LOGICAL_SIZE / NVM_HAL_FLOG_PAGE_SIZE))
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data declarations ( extern ) *****************************************
+
+//**************************************** External parameter / constant declarations ( extern const )	****************
+
+//**************************************** Global func/proc prototypes *************************************************
+
+//* Function s16NVM_HAL_FlogInit ***************************************************************************************
+//!
+//! @brief      Mounts the log store: selects the active sector, builds the RAM index and completes an interrupted
+//!             garbage collection. Content written without log structure (previous software) is imported once.
+//!
+//! @return     KB_RET_OK on success, KB_RET_ERR_DRIVER on flash errors.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_HAL_FlogInit (void);
+
+//* Function s16NVM_HAL_FlogRead ***************************************************************************************
+//!
+//! @brief      Reads logical content. Pages never written read as erased flash (0xFF).
+//!
+//! @param[in]  u32Offset : Logical offset
+//! @param[out] pu8Buffer : Destination buffer
+//! @param[in]  u32Length : Number of bytes to read
+//!
+//! @return     KB_RET_OK on success, KB_RET_ERR_ARG / KB_RET_ERR_DRIVER on errors.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_HAL_FlogRead (U32 u32Offset, U8* pu8Buffer, U32 u32Length);
+
+//* Function s16NVM_HAL_FlogWrite **************************************************************************************
+//!
+//! @brief      Writes logical content by appending one record per changed page.
+//!
+//! @param[in]  u32Offset : Logical offset
+//! @param[in]  pu8Buffer : Data to write
+//! @param[in]  u32Length : Number of bytes to write
+//!
+//! @return     KB_RET_OK on success, KB_RET_ERR_ARG / KB_RET_ERR_DRIVER on errors.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_HAL_FlogWrite (U32 u32Offset, const U8* pu8Buffer, U32 u32Length);
+
+//* Function s16NVM_HAL_FlogErase **************************************************************************************
+//!
+//! @brief      Erases the complete logical content by appending an erase record (no sector erase).
+//!
+//! @return     KB_RET_OK on success, KB_RET_ERR_DRIVER on errors.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_HAL_FlogErase (void);
+
+#endif // NVM_HAL_FLOG_I_H
+
+// EndOfFile nvm_hal_flog_i.h ******************************************************************************************
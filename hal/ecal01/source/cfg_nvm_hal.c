@@ -32,6 +32,12 @@
 // 2021-09-14   N. Jadhav   GenCA V07.00 adaptation changes.
 // 2022-11-26   S. Shinde   Adapted for GenCA 7.05
 // 2023-11-02   C. Brancolini Lint Plus cleanup
+// 2026-10-19   agent       Device-2 is the logical content of the log structured flash store (two sectors)
+// 2026-10-19   agent       Shadow areas of Device-1 for byte-diff writes
+// 2026-10-19   agent       Area offsets and tables generated from the NVM layout (nvm_layout_i.h)
+// 2026-10-19   agent       Statistics areas generated from the NVM layout
+// 2026-10-19   agent       Shadow RAM copy moved to the module global data segment
+// 2026-10-19   agent       Shadow RAM copy defined once, before acNVM_HAL_CFG_ShadowArea
 //
 //**********************************************************************************************************************
 
@@ -49,6 +55,8 @@
 #include "nvm_common.h"                             // NVM Common definitions
 #include "cfg_nvm_hal_poff_i.h"                     // POFF related definitions, configurable parameters of POFF
 #include "55xflsh.h"                                // For max transfer size of flash
+#include "nvm_hal_flog_i.h"                         // Logical size and page size of the flash log store
+#include "nvm_layout_i.h"                           // Layout of the NVM devices
 
 //**************************************** Constant / macro definitions ( #define ) ************************************
 //! Number of available devices
@@ -76,9 +84,6 @@
 //---New area id can be added before 'SPARE'
 #define NVM_HAL_POFF_AREA_ID_SPARE          ((U8) 0x04)                     //!< Device-0, Area-4
 
-//! POFF buffer size reserved for non FWR areas: 4KBytes
-#define NVM_HAL_POFF_BUFF_AREAS_SIZE_NONFWR ((U32) 4096)
-
 //! Area sizes of HAL for Device_0
 #define NVM_HAL_POFF_AREA_SIZE_FATAL        BCM_FWR_LOG_MAX_SIZE_FATAL            //!< Device-0, First area size
 #define NVM_HAL_POFF_AREA_SIZE_CRITICAL     (BCM_FWR_LOG_MAX_SIZE_CRITICAL + 2U)  //!< Device-0, Second area size
@@ -93,14 +98,7 @@
                                                        NVM_HAL_POFF_AREA_SIZE_ONN)                 -   \
                                                        NVM_HAL_POFF_AREA_SIZE_MAINTFLAG))
 
-//! Area offset of HAL for Device_0
-#define NVM_HAL_AREA_OFFSET0_0              ((U32) 0x0000)  //!< Device-0, First area offset
-#define NVM_HAL_AREA_OFFSET0_1              ((U32) (NVM_HAL_AREA_OFFSET0_0 + NVM_HAL_POFF_AREA_SIZE_FATAL))
-#define NVM_HAL_AREA_OFFSET0_2              ((U32) (NVM_HAL_AREA_OFFSET0_1 + NVM_HAL_POFF_AREA_SIZE_CRITICAL))
-#define NVM_HAL_AREA_OFFSET0_3              ((U32) (NVM_HAL_AREA_OFFSET0_2 + NVM_HAL_POFF_AREA_SIZE_ONN))
-#define NVM_HAL_AREA_OFFSET0_SPARE          ((U32) (NVM_HAL_AREA_OFFSET0_3 + NVM_HAL_POFF_AREA_SIZE_MAINTFLAG))
-//--Offset of new area shall be calculated by considering 'AreaOffsets' before 'SPARE' area
-#define NVM_HAL_AREA_OFFSET0_RES            ((U32) (NVM_HAL_AREA_OFFSET0_SPARE + NVM_HAL_POFF_AREA_SIZE_SPARE))
+//! Area offsets of HAL for Device_0: NVM_LAYOUT_DEV0_HAL (nvm_layout_i.h)
 
 // End of Device_0 definitions------------------------------------------------------------------------------------------
 
@@ -118,40 +116,81 @@
 #define NVM_HAL_AREA_ID1_SPARE              ((U8) 0x00)          //!< Device-1, Spare memory for HAL areas
 
 
-//! Area sizes of HAL for Device_1
-// Note: This is spare area size provided as an example, board owner can use this memory area
-#define NVM_HAL_AREA_SIZE1_SPARE            ((U32) 0x800)          //!< Device-1, Spare memory for HAL areas
-#define NVM_HAL_AREA_SIZE1_RES_SVL_APP      ((U32) 0x1D800)        //!< Device-1, Reserved [SVL+ APP] area size
+//! Area sizes and offsets of HAL for Device_1: NVM_LAYOUT_DEV1_HAL (nvm_layout_i.h)
 
+//! Shadow areas of Device_1: USR area 0 and FWK DataBackup area of APP
+#define NVM_HAL_SHADOW_OFFSET1_USR_DABA     ((U32)(NVM_LAYOUT_OFFSET(DEV1_HAL, RES)     +          \
+                                                   NVM_LAYOUT_OFFSET(DEV1_SVL, RES_APP) +          \
+                                                   NVM_LAYOUT_OFFSET(DEV1_APP, USR_0)))
+#define NVM_HAL_SHADOW_SIZE1_USR_DABA       ((U32)(NVM_LAYOUT_OFFSET(DEV1_APP, FWK_DFM) -          \
+                                                   NVM_LAYOUT_OFFSET(DEV1_APP, USR_0)))
 
-//! Area offset of HAL for Device_1
-#define NVM_HAL_AREA_OFFSET1_SPARE          ((U32) 0x0000)        //!< Device-1, First area offset
-#define NVM_HAL_AREA_OFFSET1_RES_SVL_APP    ((U32)(NVM_HAL_AREA_OFFSET1_SPARE + NVM_HAL_AREA_SIZE1_SPARE))
-                                                                  //!< Device-1, Second area offset
+//! Byte runs separated by less unchanged bytes are merged: one FRAM transfer costs about the time of 8 data bytes
+#define NVM_HAL_SHADOW_MERGE_GAP            ((U32) 8)
 // End of Device_1 definitions------------------------------------------------------------------------------------------
 
 //----------------------------------------------------------------------------------------------------------------------
 //! Definitions of Device_2, i.e. FLASH
 //----------------------------------------------------------------------------------------------------------------------
 //! Flash information is retrieved from '55xflsh'
-//#define NVM_DEV_2_START_ADDR                ((U32) 0x00010000)    //!< FLASH start address
-#define NVM_DEV_2_START_ADDR                ((U32) 0x00004000)    //!< FLASH start address
-#define NVM_DEV_2_MX_TXFER_SIZE             ((U32) 0x10)        //!< Value will be overwritten in Device info interface
-#define NVM_DEV_2_SIZE                      ((U32) 0xC000)        //!< FLASH block size in Bytes
+//! Device_2 is accessed through the log structured store (nvm_hal_flog.c) in the sectors NVM_PFLASH_SECTOR_0/1.
+//! Start address and size are logical, one transfer is one page of the store.
+#define NVM_DEV_2_START_ADDR                ((U32) 0x00000000)    //!< Logical start address
+#define NVM_DEV_2_MX_TXFER_SIZE             NVM_HAL_FLOG_PAGE_SIZE //!< One page of the log store
+#define NVM_DEV_2_SIZE                      NVM_HAL_FLOG_LOGICAL_SIZE //!< Logical size in Bytes
 
 //! Area identifiers of HAL for Device_2
 // Note: Define area identifiers for Device_2 here
 // There are no HAL areas for this device
 
-//! Area size of HAL for Device_2
-#define NVM_HAL_AREA_SIZE2_RES_SVL_APP      ((U32) 0xC000)        //!< Device-2, Reserved [SVL+ APP] area size
-
-//! Area offset of HAL for Device_2
-#define NVM_HAL_AREA_OFFSET2_RES            ((U32) 0x0000)        //!< Device-2, First area offset
+//! Area sizes and offsets of HAL for Device_2: NVM_LAYOUT_DEV2_HAL (nvm_layout_i.h)
 
 // End of Device_2 definitions------------------------------------------------------------------------------------------
 
+//! Table entry of a HAL area
+#define NVM_HAL_LAYOUT_ROW(L, Name, Id, Size, Align)    { (Id), NVM_LAYOUT_OFFSET(L, Name), (Size) },
+
+//! Device offsets of the SVL and APP layers of Device_1 and Device_2
+#define NVM_HAL_STAT_BASE1_SVL              NVM_LAYOUT_OFFSET(DEV1_HAL, RES)
+#define NVM_HAL_STAT_BASE1_APP              (NVM_HAL_STAT_BASE1_SVL + NVM_LAYOUT_OFFSET(DEV1_SVL, RES_APP))
+#define NVM_HAL_STAT_BASE2_SVL              NVM_LAYOUT_OFFSET(DEV2_HAL, RES)
+#define NVM_HAL_STAT_BASE2_APP              (NVM_HAL_STAT_BASE2_SVL + NVM_LAYOUT_OFFSET(DEV2_SVL, RES_APP))
+
+//! Table entries of the statistics areas, one generator per list
+#define NVM_HAL_STAT_ROW(Dev, Layer, AreaID, Base, L, Name, Size)                                      \
+            { (Dev), (Layer), (AreaID), (U32)((Base) + NVM_LAYOUT_OFFSET(L, Name)), (Size) },
+#define NVM_HAL_STAT_ROW_DEV0_HAL(L, Name, Id, Size, Align)                                            \
+            NVM_HAL_STAT_ROW(NVM_DEVICE_ID0, NVM_HAL_STAT_LAYER_HAL, (Id), 0U, L, Name, Size)
+#define NVM_HAL_STAT_ROW_DEV1_HAL(L, Name, Id, Size, Align)                                            \
+            NVM_HAL_STAT_ROW(NVM_DEVICE_ID1, NVM_HAL_STAT_LAYER_HAL, NVM_HAL_STAT_AREA_ID_ANY, 0U, L, Name, Size)
+#define NVM_HAL_STAT_ROW_DEV1_SVL(L, Name, Id, Size, Align)                                            \
+            NVM_HAL_STAT_ROW(NVM_DEVICE_ID1, NVM_HAL_STAT_LAYER_SVL, NVM_HAL_STAT_AREA_ID_ANY,                 \
+                             NVM_HAL_STAT_BASE1_SVL, L, Name, Size)
+#define NVM_HAL_STAT_ROW_DEV1_APP(L, Name, Id, Size, Align)                                            \
+            NVM_HAL_STAT_ROW(NVM_DEVICE_ID1, NVM_HAL_STAT_LAYER_APP, NVM_HAL_STAT_AREA_ID_ANY,                 \
+                             NVM_HAL_STAT_BASE1_APP, L, Name, Size)
+#define NVM_HAL_STAT_ROW_DEV2_HAL(L, Name, Id, Size, Align)                                            \
+            NVM_HAL_STAT_ROW(NVM_DEVICE_ID2, NVM_HAL_STAT_LAYER_HAL, NVM_HAL_STAT_AREA_ID_ANY, 0U, L, Name, Size)
+#define NVM_HAL_STAT_ROW_DEV2_SVL(L, Name, Id, Size, Align)                                            \
+            NVM_HAL_STAT_ROW(NVM_DEVICE_ID2, NVM_HAL_STAT_LAYER_SVL, NVM_HAL_STAT_AREA_ID_ANY,                 \
+                             NVM_HAL_STAT_BASE2_SVL, L, Name, Size)
+#define NVM_HAL_STAT_ROW_DEV2_APP(L, Name, Id, Size, Align)                                            \
+            NVM_HAL_STAT_ROW(NVM_DEVICE_ID2, NVM_HAL_STAT_LAYER_APP, NVM_HAL_STAT_AREA_ID_ANY,                 \
+                             NVM_HAL_STAT_BASE2_APP, L, Name, Size)
+
 //**************************************** Type definitions ( typedef ) ************************************************
+//! HAL areas, checked against the device sizes
+NVM_LAYOUT_DEFINE(DEV0_HAL)
+NVM_LAYOUT_DEFINE(DEV1_HAL)
+NVM_LAYOUT_DEFINE(DEV2_HAL)
+
+//! APP areas of Device_1 inside the HAL reserved area, for the shadow and statistics areas
+NVM_LAYOUT_TYPE(DEV1_SVL)
+NVM_LAYOUT_TYPE(DEV1_APP)
+
+//! SVL and APP areas of Device_2, for the statistics areas
+NVM_LAYOUT_TYPE(DEV2_SVL)
+NVM_LAYOUT_TYPE(DEV2_APP)
 
 //**************************************** Global data definitions *****************************************************
 
@@ -159,28 +198,19 @@
 //! HAL area configuration for POFF
 static const C_NVM_HAL_DEVICE_AREAS acNVM_HAL_Device_0[] =
 {
-    // Area ID,                       Area Offset,                  Area Size
-    { NVM_HAL_POFF_AREA_ID_FATAL,     NVM_HAL_AREA_OFFSET0_0,      NVM_HAL_POFF_AREA_SIZE_FATAL        },
-    { NVM_HAL_POFF_AREA_ID_CRITICAL,  NVM_HAL_AREA_OFFSET0_1,      NVM_HAL_POFF_AREA_SIZE_CRITICAL     },
-    { NVM_HAL_POFF_AREA_ID_ONN,       NVM_HAL_AREA_OFFSET0_2,      NVM_HAL_POFF_AREA_SIZE_ONN          },
-    { NVM_HAL_POFF_AREA_ID_MAINTFLAG, NVM_HAL_AREA_OFFSET0_3,      NVM_HAL_POFF_AREA_SIZE_MAINTFLAG    },
-    { NVM_HAL_POFF_AREA_ID_SPARE,     NVM_HAL_AREA_OFFSET0_SPARE,  NVM_HAL_POFF_AREA_SIZE_SPARE        },
-    { NVM_SVL_AREA_ID_RES,            NVM_HAL_AREA_OFFSET0_RES,    NVM_HAL_POFF_BUFF_AREAS_SIZE_NONFWR }
+    NVM_LAYOUT_DEV0_HAL(NVM_HAL_LAYOUT_ROW)
 };
 
 //! HAL area configuration for FRAM
 static const C_NVM_HAL_DEVICE_AREAS acNVM_HAL_Device_1[] =
 {
-    // Area ID,                       Area Offset,                  Area Size
-    { NVM_HAL_AREA_ID1_SPARE,  NVM_HAL_AREA_OFFSET1_SPARE,          NVM_HAL_AREA_SIZE1_SPARE          }, // Free Space
-    { NVM_SVL_AREA_ID_RES,     NVM_HAL_AREA_OFFSET1_RES_SVL_APP,    NVM_HAL_AREA_SIZE1_RES_SVL_APP    }
+    NVM_LAYOUT_DEV1_HAL(NVM_HAL_LAYOUT_ROW)
 };
 
 //! HAL area configuration for FLASH
 static const C_NVM_HAL_DEVICE_AREAS acNVM_HAL_Device_2[] =
 {
-    // Area ID,                       Area Offset,                  Area Size
-    { NVM_SVL_AREA_ID_RES,            NVM_HAL_AREA_OFFSET2_RES,     NVM_HAL_AREA_SIZE2_RES_SVL_APP    }
+    NVM_LAYOUT_DEV2_HAL(NVM_HAL_LAYOUT_ROW)
 };
 
 //! NVM devices configuration
@@ -213,7 +243,7 @@ const C_NVM_HAL_DEV_INFO acNVM_HAL_DeviceCfgInfo[NVM_HAL_NUM_OF_DEVICES] =
         "FLASH",
         ((U8) (sizeof(acNVM_HAL_Device_2) / sizeof(C_NVM_HAL_DEVICE_AREAS))),
         NVM_DEFAULT_VAL_DEV_2, // Default initial value
-        TRUE,                      // Device is memory mapped
+        FALSE,                     // Device is not memory mapped, content is located by the log store index
         NVM_DEV_2_START_ADDR,
         NVM_DEV_2_SIZE,
         NVM_DEV_2_MX_TXFER_SIZE,
@@ -227,6 +257,44 @@ const U8 u8NVM_HAL_NoOfDevicesConfigured = NVM_HAL_NUM_OF_DEVICES;
 //! First area id of SVL area
 const U8 u8NVM_HAL_SvlFirstAreaID = NVM_SVL_AREA_ID_RES;
 
+//! RAM copy of the USR and DataBackup areas of Device_1, defined before its use in acNVM_HAL_CFG_ShadowArea
+static U8 au8NVM_HAL_CFG_ShadowUsrDaba[NVM_HAL_SHADOW_SIZE1_USR_DABA];
+
+//! Shadow areas of Device_1
+const C_NVM_HAL_SHADOW_AREA acNVM_HAL_CFG_ShadowArea[] =
+{
+    // Offset,                        Size,                           Shadow
+    { NVM_HAL_SHADOW_OFFSET1_USR_DABA, NVM_HAL_SHADOW_SIZE1_USR_DABA, au8NVM_HAL_CFG_ShadowUsrDaba }
+};
+
+//! Number of shadow areas
+const U8 u8NVM_HAL_CFG_ShadowAreaCnt = (U8)(sizeof(acNVM_HAL_CFG_ShadowArea) / sizeof(C_NVM_HAL_SHADOW_AREA));
+
+//! Merge gap of changed byte runs
+const U32 u32NVM_HAL_CFG_ShadowMergeGap = NVM_HAL_SHADOW_MERGE_GAP;
+
+//! Maximum transfer size of shadow area writes
+const U32 u32NVM_HAL_CFG_ShadowMaxTxfer = NVM_DEV_1_MX_TXFER_SIZE;
+
+//! Statistics areas. Upper layers first: an operation is counted in a reserved area only if no area of the next
+//! layer contains it.
+const C_NVM_HAL_STAT_AREA acNVM_HAL_CFG_StatArea[] =
+{
+    NVM_LAYOUT_DEV0_HAL(NVM_HAL_STAT_ROW_DEV0_HAL)
+    NVM_LAYOUT_DEV1_APP(NVM_HAL_STAT_ROW_DEV1_APP)
+    NVM_LAYOUT_DEV1_SVL(NVM_HAL_STAT_ROW_DEV1_SVL)
+    NVM_LAYOUT_DEV1_HAL(NVM_HAL_STAT_ROW_DEV1_HAL)
+    NVM_LAYOUT_DEV2_APP(NVM_HAL_STAT_ROW_DEV2_APP)
+    NVM_LAYOUT_DEV2_SVL(NVM_HAL_STAT_ROW_DEV2_SVL)
+    NVM_LAYOUT_DEV2_HAL(NVM_HAL_STAT_ROW_DEV2_HAL)
+};
+
+//! Number of statistics areas
+const U8 u8NVM_HAL_CFG_StatAreaCnt = (U8)(sizeof(acNVM_HAL_CFG_StatArea) / sizeof(C_NVM_HAL_STAT_AREA));
+
+//! Statistics of all areas are kept
+NVM_LAYOUT_CHECK(STAT_AREAS, (sizeof(acNVM_HAL_CFG_StatArea) / sizeof(C_NVM_HAL_STAT_AREA)) <= NVM_HAL_STAT_MAX_AREAS)
+
 
 
 //----------------------------------------------------------------------------------------------------------------------
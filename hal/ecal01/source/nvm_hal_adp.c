@@ -31,6 +31,13 @@
 // 2021-09-22      N. Jadhav           BC0025-529: Workaround changes for area ID offset configuration issue.
 // 2021-12-15      N. Jadhav           BC0025-529: Workaround changes removed with integration of CA 07.01.
 // 2023-12-06      C. Brancolini       Lint Plus clean up
+// 2026-10-19      agent               Incremental POFF save: only lines changed since the last save are written.
+// 2026-10-19      agent               NVM_DEVICE_ID2 accessed through the log structured store (nvm_hal_flog.c).
+// 2026-10-19      agent               Writes into shadow areas of NVM_DEVICE_ID1 transfer only changed byte runs.
+// 2026-10-19      agent               Write stamps of NVM_DEVICE_ID1 and NVM_DEVICE_ID2 (background scrubbing).
+// 2026-10-19      agent               Operation statistics per area: counters and service time histograms.
+// 2026-10-19      agent               Statistics time source called only after s16NVM_HAL_AdpStatStart.
+// 2026-10-19      agent               Device status set to FREE by a shadow area write without changed bytes.
 //
 //**********************************************************************************************************************
 
@@ -51,6 +58,7 @@
 #include "cfg_nvm_hal_poff_i.h"                                 // CFG NVM HAL POFF interfaces
 #include "fram_hal.h"
 #include "bcl_mcal_s.h"                                         // for Cache block flush interface
+#include "nvm_hal_flog_i.h"                                     // Log structured store of device ID 2
 
 //**************************************** Constant / macro definitions ( #define ) ************************************
 
@@ -70,11 +78,51 @@ static S16 s16NVM_HAL_AdpReadDeviceID1 (U8 u8NvmID, U8* pu8UsrBuffer,
 
 static S16 s16NVM_HAL_AdpWriteDeviceID1 (U8 u8NvmID, U8* pu8UsrBuffer, U32 u32LocalAreaOffset, U32 u32Length);
 
+static S16 s16NVM_HAL_AdpWriteDiffDeviceID1 (U8 u8NvmID, U8* pu8UsrBuffer, U32 u32LocalAreaOffset, U32 u32Length);
+
+static S16 s16NVM_HAL_AdpShadowWrite (U8 u8NvmID, U8 u8Area, U8* pu8UsrBuffer, U32 u32LocalAreaOffset, U32 u32Length);
+
+static void vNVM_HAL_AdpShadowLoad (U8 u8NvmID, U8 u8Area);
+
+static S16 s16NVM_HAL_AdpFramWriteBlocking (U32 u32DstAddr, U8* pu8SrcAddr, U32 u32Length);
+
+static void vNVM_HAL_AdpPoffLoadShadow (void);
+
+static void vNVM_HAL_AdpWriteStampUpdate (U8 u8NvmID, U32 u32LocalAreaOffset, U32 u32Length);
+
+static U32 u32NVM_HAL_AdpStatTimeMs (void);
+
+static void vNVM_HAL_AdpStatRecord (U8 u8NvmID,
+                                    U8 u8AreaID,
+                                    U32 u32LocalAreaOffset,
+                                    U32 u32Length,
+                                    E_NVM_HAL_STAT_OP eOp,
+                                    S16 s16Result,
+                                    U32 u32StartMs);
+
 //**************************************** Module global constants ( static const ) ************************************
 
 //! Operation status for Device ID 1.
 static E_NVM_HAL_DEVICE_STATUS eDeviceOperationStatus = eNVM_HAL_DEVICE_STATUS_FREE;
 
+//! Copy of the POFF save area in FRAM, used to detect the lines changed since the last POFF save
+static U32 au32NVM_HAL_AdpPoffShadow[NVM_HAL_POFF_MAX_BUFF_U32];
+
+//! Shadow matches the POFF save area in FRAM, otherwise complete blocks are written
+static BOOLEAN boNVM_HAL_AdpPoffShadowValid = FALSE;
+
+//! Shadow area matches the FRAM content, otherwise writes into the area are complete transfers
+static BOOLEAN aboNVM_HAL_AdpShadowValid[NVM_HAL_SHADOW_MAX_AREAS];
+
+//! Write stamps per device and block, see s16NVM_HAL_AdpGetWriteStamp
+static U16 aau16NVM_HAL_AdpWriteStamp[NVM_HAL_WRITE_STAMP_DEVICES][NVM_HAL_WRITE_STAMP_BLOCKS];
+
+//! Operation statistics per statistics area and operation, see s16NVM_HAL_AdpGetStat
+static C_NVM_HAL_STAT_CNT aacNVM_HAL_AdpStat[NVM_HAL_STAT_MAX_AREAS][eNVM_HAL_STAT_OP_NUM];
+
+//! Time source of the statistics may be called, see s16NVM_HAL_AdpStatStart
+static BOOLEAN boNVM_HAL_AdpStatTimeStarted = FALSE;
+
 //**************************************** Local func/proc prototypes ( static ) ***************************************
 
 //** EndOfHeader *******************************************************************************************************
@@ -86,6 +134,7 @@ S16 s16NVM_HAL_AdpInit (U8 u8NvmID)
 {
 //************************************************ Function scope data *************************************************
     S16 s16Return;                                          // Function Return value
+    U8 u8Area;                                              // Loop index of shadow areas
 
 //*************************************************** Function code ****************************************************
     // Execution based upon device type.
@@ -107,6 +156,9 @@ S16 s16NVM_HAL_AdpInit (U8 u8NvmID)
 
             if (s16Return == KB_RET_OK)
             {
+                // Load the FRAM content of the last POFF save before POFF HAL writes anything
+                vNVM_HAL_AdpPoffLoadShadow();
+
                 // Initialize POFF HAL for NVM operations
                 s16Return = s16NVM_HAL_PoffInit();
             }
@@ -118,6 +170,11 @@ S16 s16NVM_HAL_AdpInit (U8 u8NvmID)
         {
             // Device ID 1
             // FRAM HAL initialization is already done in Device ID 0
+            // Load the RAM copies of the shadow areas
+            for (u8Area = 0U; (u8Area < u8NVM_HAL_CFG_ShadowAreaCnt) && (u8Area < NVM_HAL_SHADOW_MAX_AREAS); u8Area++)
+            {
+                vNVM_HAL_AdpShadowLoad(u8NvmID, u8Area);
+            }
             s16Return = KB_RET_OK;
             break;
         }
@@ -127,6 +184,12 @@ S16 s16NVM_HAL_AdpInit (U8 u8NvmID)
             // Device ID 2
             // Initialize Flash HAL
             s16Return = s16FLSH_HAL_Init();
+
+            // Mount the log structured store, builds the page index
+            if (s16Return >= KB_RET_OK)
+            {
+                s16Return = s16NVM_HAL_FlogInit();
+            }
             break;
         }
 
@@ -161,9 +224,11 @@ S16 s16NVM_HAL_AdpRead (U8 u8NvmID, U8 u8AreaID, U32 u32Offset, U8* pu8UsrBuffer
 {
 //************************************************ Function scope data *************************************************
     S16 s16Return;                                          // Function Return value
-    U32 u32DeviceAddress;                                   // Device address on NVM device
+    U32 u32StartMs;                                         // Start time of the operation (statistics)
 
 //*************************************************** Function code ****************************************************
+    u32StartMs = u32NVM_HAL_AdpStatTimeMs();
+
     // Note:
     // Exception is made for max allowed nesting (MaxND), this function has nesting 7, max allowed is 5
     // Separating code will reduce understandability and readability
@@ -189,18 +254,8 @@ S16 s16NVM_HAL_AdpRead (U8 u8NvmID, U8 u8AreaID, U32 u32Offset, U8* pu8UsrBuffer
         case NVM_DEVICE_ID2 :
         {
             // Device ID 2
-            // Calculation of absolute address
-            s16Return = s16NVM_HAL_AdpDeriveAbsoluteMemoryAddress(u8NvmID,
-                                                                  u32LocalAreaOffset,
-                                                                  &u32DeviceAddress);
-
-            // Pass the READ request to Flash HAL interface
-            if (s16Return >= KB_RET_OK)
-            {
-                // Call Flash interface for Read
-                // Data Flash is used for writing Configuration data
-                s16Return = s16FLSH_HAL_Read(eFLSH_HAL_TYPE_PFLASH, u32DeviceAddress, pu8UsrBuffer, u32Length);
-            }
+            // Logical content is read from the newest records of the log structured store
+            s16Return = s16NVM_HAL_FlogRead(u32LocalAreaOffset, pu8UsrBuffer, u32Length);
             break;
         }
         default:
@@ -224,6 +279,9 @@ S16 s16NVM_HAL_AdpRead (U8 u8NvmID, U8 u8AreaID, U32 u32Offset, U8* pu8UsrBuffer
         s16Return = KB_RET_OK;
     }
 
+    vNVM_HAL_AdpStatRecord(u8NvmID, u8AreaID, u32LocalAreaOffset, u32Length,
+                           eNVM_HAL_STAT_OP_READ, s16Return, u32StartMs);
+
     // Return result
     return (s16Return);
 }
@@ -241,9 +299,11 @@ S16 s16NVM_HAL_AdpWrite (U8 u8NvmID,
 {
 //************************************************ Function scope data *************************************************
     S16 s16Return;                                          // Function Return value
-    U32 u32DeviceAddress;                                   // Device address on NVM device
+    U32 u32StartMs;                                         // Start time of the operation (statistics)
 
 //*************************************************** Function code ****************************************************
+    u32StartMs = u32NVM_HAL_AdpStatTimeMs();
+
     // Note:
     // Exception is made for max allowed nesting (MaxND), this function has nesting 7, max allowed is 5
     // Separating code will reduce understandability and readability.
@@ -263,31 +323,21 @@ S16 s16NVM_HAL_AdpWrite (U8 u8NvmID,
         case NVM_DEVICE_ID1 :
         {
             // Device ID 1
-            s16Return = s16NVM_HAL_AdpWriteDeviceID1 ( u8NvmID, pu8UsrBuffer, u32LocalAreaOffset, u32Length);
+            // Stamp before writing, a reader comparing stamps around its read sees every overlapping write
+            vNVM_HAL_AdpWriteStampUpdate(u8NvmID, u32LocalAreaOffset, u32Length);
+
+            // Only changed bytes are transferred into shadow areas
+            s16Return = s16NVM_HAL_AdpWriteDiffDeviceID1 ( u8NvmID, pu8UsrBuffer, u32LocalAreaOffset, u32Length);
             break;
         }
 
         case NVM_DEVICE_ID2 :
         {
             // Device ID 2
-            // Calculation of absolute address
-            s16Return = s16NVM_HAL_AdpDeriveAbsoluteMemoryAddress(u8NvmID,
-                                                                  u32LocalAreaOffset,
-                                                                  &u32DeviceAddress);
-
-            // Data Flash is used for writing configuration data
-            // Pass the write request to Flash HAL interface
+            // Changed pages are appended to the log structured store, sectors are erased by its garbage collection
             // Blocking mode feature is available as a part of Flash Hal
-            // Pass the write request to Flash HAL interface
-            // Blocking mode feature is available as a part of Flash Hal
-            if (s16Return >= KB_RET_OK)
-            {
-                // Call Flash interface for Writing 'u32Length' on Data Flash
-                // Device address is calculated based upon 'Base Address' from configuration
-                // if there is any error, it will be returned to the caller
-                s16Return = s16FLSH_HAL_Write(eFLSH_HAL_TYPE_PFLASH, u32DeviceAddress,pu8UsrBuffer,u32Length,+ TRUE);
-            }
-
+            vNVM_HAL_AdpWriteStampUpdate(u8NvmID, u32LocalAreaOffset, u32Length);
+            s16Return = s16NVM_HAL_FlogWrite(u32LocalAreaOffset, pu8UsrBuffer, u32Length);
             break;
         }
 
@@ -312,6 +362,9 @@ S16 s16NVM_HAL_AdpWrite (U8 u8NvmID,
         s16Return = KB_RET_OK;
     }
 
+    vNVM_HAL_AdpStatRecord(u8NvmID, u8AreaID, u32LocalAreaOffset, u32Length,
+                           eNVM_HAL_STAT_OP_WRITE, s16Return, u32StartMs);
+
     // Return result
     return (s16Return);
 }
@@ -324,11 +377,10 @@ S16 s16NVM_HAL_AdpErase (U8 u8NvmID, U32 u32Offset, U32 u32Length)
 {
 //************************************************ Function scope data *************************************************
     S16 s16Return;                                 // Function Return value
+    U32 u32StartMs;                                // Start time of the operation (statistics)
 
 //*************************************************** Function code ****************************************************
-    // To remove warnings
-    (void) u32Length; // unused parameter
-    (void) u32Offset; // unused parameter
+    u32StartMs = u32NVM_HAL_AdpStatTimeMs();
 
     // Execution based upon device type
     switch (u8NvmID)
@@ -352,11 +404,9 @@ S16 s16NVM_HAL_AdpErase (U8 u8NvmID, U32 u32Offset, U32 u32Length)
         case NVM_DEVICE_ID2 :
         {
             // Device ID 2
-            // Flash area identified based upon BankID, SectorNumber
-            // Erase operation will be done based on sectors.
-            // Complete sector will be erased.
-            // Flash sector allocated for LAD CFG will be erased.
-            s16Return = s16FLSH_HAL_Erase(eFLSH_HAL_TYPE_PFLASH, NVM_PFLASH_BANK_0, (U8)NVM_PFLASH_SECTOR_0, TRUE);
+            // Complete logical content is erased by an erase record, no flash sector erase is needed
+            vNVM_HAL_AdpWriteStampUpdate(u8NvmID, (U32)0, NVM_HAL_FLOG_LOGICAL_SIZE);
+            s16Return = s16NVM_HAL_FlogErase();
 
             // Check whether ERASE operation is successful or not
             if (s16Return < KB_RET_OK)
@@ -392,6 +442,10 @@ S16 s16NVM_HAL_AdpErase (U8 u8NvmID, U32 u32Offset, U32 u32Length)
         s16Return = KB_RET_OK;
     }
 
+    // Erase has no area identifier, it is counted in the area of its start offset
+    vNVM_HAL_AdpStatRecord(u8NvmID, NVM_HAL_STAT_AREA_ID_ANY, u32Offset, u32Length,
+                           eNVM_HAL_STAT_OP_ERASE, s16Return, u32StartMs);
+
     // Return result
     return (s16Return);
 }
@@ -471,30 +525,88 @@ S16 s16NVM_HAL_AdpGetDeviceOpernStatus (U8 u8NvmID, E_NVM_HAL_DEVICE_STATUS* peD
 S16 s16NVM_HAL_AdpPoffWrite (U32 u32DstOffset, U8* pu8SrcAddr, U32 u32Length)
 {
 //************************************************ Function scope data *************************************************
-    S16 s16Return;                                          // Function Return value
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    U8* pu8Shadow;                                          // Shadow of the block
+    U32 u32Pos = 0U;                                        // Current position in the block
+    U32 u32LineLen;                                         // Length of the current line
+    U32 u32RunStart = 0U;                                   // Start of the current run of changed lines
+    U32 u32RunLen = 0U;                                     // Length of the current run of changed lines
 
 //*************************************************** Function code ****************************************************
     // Flush cache of the block
     vBCL_MCAL_CacheFlush(pu8SrcAddr, u32Length);
 
-    // Pass the WRITE request to driver interface
-    s16Return = s16FRAM_HAL_Write(u32DstOffset, pu8SrcAddr, u32Length);
-
-    // Check return
-    if (s16Return < 0)
+    if ((boNVM_HAL_AdpPoffShadowValid == FALSE) ||
+        (u32DstOffset >= NVM_HAL_POFF_BUFF_SIZE) ||
+        (u32Length > (NVM_HAL_POFF_BUFF_SIZE - u32DstOffset)))
     {
-        // return error
-        s16Return = KB_RET_ERR_DRIVER;
+        // FRAM content is not known: write the complete block
+        s16Return = s16NVM_HAL_AdpFramWriteBlocking(u32DstOffset, pu8SrcAddr, u32Length);
     }
     else
     {
-        // Check FRAM status for read command
-        while (s16FRAM_HAL_ChkWriteStatus() != KB_RET_OK)
+        // Write only the runs of lines which differ from the last saved content. The save has no generation
+        // counter of its own, the POFF HAL counters are part of the compared lines (cfg_nvm_hal_poff_i.h).
+        pu8Shadow = &((U8*)(void*)au32NVM_HAL_AdpPoffShadow)[u32DstOffset];
+
+        while ((u32Pos < u32Length) && (s16Return == KB_RET_OK))
         {
-            ; // do nothing
+            // Lines are aligned to the POFF save area, the first and last line of a block may be shorter
+            u32LineLen = NVM_HAL_POFF_LINE_SIZE - ((u32DstOffset + u32Pos) % NVM_HAL_POFF_LINE_SIZE);
+            if (u32LineLen > (u32Length - u32Pos))
+            {
+                u32LineLen = u32Length - u32Pos;
+            }
+
+            if (memcmp(&pu8SrcAddr[u32Pos], &pu8Shadow[u32Pos], (size_t)u32LineLen) != 0)
+            {
+                // Changed line: start or extend the run
+                if (u32RunLen == 0U)
+                {
+                    u32RunStart = u32Pos;
+                }
+                u32RunLen += u32LineLen;
+            }
+            else if (u32RunLen != 0U)
+            {
+                // Unchanged line ends the run: write it with one transfer
+                s16Return = s16NVM_HAL_AdpFramWriteBlocking(u32DstOffset + u32RunStart,
+                                                            &pu8SrcAddr[u32RunStart],
+                                                            u32RunLen);
+                if (s16Return == KB_RET_OK)
+                {
+                    memcpy(&pu8Shadow[u32RunStart], &pu8SrcAddr[u32RunStart], (size_t)u32RunLen);
+                }
+                u32RunLen = 0U;
+            }
+            else
+            {
+                ; // Unchanged line, nothing to write
+            }
+
+            u32Pos += u32LineLen;
+        }
+
+        // Run up to the end of the block
+        if ((s16Return == KB_RET_OK) && (u32RunLen != 0U))
+        {
+            s16Return = s16NVM_HAL_AdpFramWriteBlocking(u32DstOffset + u32RunStart,
+                                                        &pu8SrcAddr[u32RunStart],
+                                                        u32RunLen);
+            if (s16Return == KB_RET_OK)
+            {
+                memcpy(&pu8Shadow[u32RunStart], &pu8SrcAddr[u32RunStart], (size_t)u32RunLen);
+            }
         }
     }
 
+    // Check return
+    if (s16Return < 0)
+    {
+        // return error
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+
     // Return result
     return (s16Return);
 }
@@ -562,6 +674,110 @@ S16 s16NVM_HAL_AdpPoffStop (void)
 }
 //** EndOfFunction s16NVM_HAL_AdpPoffStop ******************************************************************************
 
+//**********************************************************************************************************************
+// Function s16NVM_HAL_AdpGetWriteStamp
+//**********************************************************************************************************************
+S16 s16NVM_HAL_AdpGetWriteStamp (U8 u8NvmID, U32 u32LocalAreaOffset, U32 u32Length, U32* pu32Stamp)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                    // Function Return value
+    U32 u32Block;                                 // Loop index of stamp blocks
+    U32 u32LastBlock;                             // Last stamp block of the range
+    U32 u32Stamp = 0U;                            // Sum of the stamps of the range
+
+//*************************************************** Function code ****************************************************
+    if (pu32Stamp == KB_NULL_PTR)
+    {
+        // null pointer, return error
+        s16Return = KB_RET_ERR_INST_PTR;
+    }
+    else if ((u8NvmID == NVM_DEVICE_ID0) || (u8NvmID >= NVM_HAL_WRITE_STAMP_DEVICES) || (u32Length == 0U))
+    {
+        // POFF device is written continuously, it has no stamps
+        s16Return = KB_RET_ERR_ARG;
+    }
+    else
+    {
+        // Ranges beyond the stamped size share the last block
+        u32Block = u32LocalAreaOffset >> NVM_HAL_WRITE_STAMP_BLOCK_SHIFT;
+        u32LastBlock = (u32LocalAreaOffset + u32Length - 1U) >> NVM_HAL_WRITE_STAMP_BLOCK_SHIFT;
+        if (u32LastBlock >= NVM_HAL_WRITE_STAMP_BLOCKS)
+        {
+            u32LastBlock = NVM_HAL_WRITE_STAMP_BLOCKS - 1U;
+        }
+        if (u32Block > u32LastBlock)
+        {
+            u32Block = u32LastBlock;
+        }
+
+        // Every write adds one to at least one block of the range, so the sum changes
+        for (; u32Block <= u32LastBlock; u32Block++)
+        {
+            u32Stamp += (U32)aau16NVM_HAL_AdpWriteStamp[u8NvmID][u32Block];
+        }
+        *pu32Stamp = u32Stamp;
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_AdpGetWriteStamp *************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_HAL_AdpGetStat
+//**********************************************************************************************************************
+S16 s16NVM_HAL_AdpGetStat (U8 u8StatArea, E_NVM_HAL_STAT_OP eOp, C_NVM_HAL_STAT_CNT* pcCnt)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                    // Function Return value
+
+//*************************************************** Function code ****************************************************
+    if (pcCnt == KB_NULL_PTR)
+    {
+        // null pointer, return error
+        s16Return = KB_RET_ERR_INST_PTR;
+    }
+    else if ((u8StatArea >= u8NVM_HAL_CFG_StatAreaCnt) || (eOp >= eNVM_HAL_STAT_OP_NUM))
+    {
+        s16Return = KB_RET_ERR_ARG;
+    }
+    else
+    {
+        *pcCnt = aacNVM_HAL_AdpStat[u8StatArea][eOp];
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_AdpGetStat *******************************************************************************
+
+//**********************************************************************************************************************
+// Function vNVM_HAL_AdpResetStat
+//**********************************************************************************************************************
+void vNVM_HAL_AdpResetStat (void)
+{
+//************************************************ Function scope data *************************************************
+
+//*************************************************** Function code ****************************************************
+    (void)memset(aacNVM_HAL_AdpStat, 0, sizeof(aacNVM_HAL_AdpStat));
+}
+//** EndOfFunction vNVM_HAL_AdpResetStat *******************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_HAL_AdpStatStart
+//**********************************************************************************************************************
+S16 s16NVM_HAL_AdpStatStart (void)
+{
+//************************************************ Function scope data *************************************************
+
+//*************************************************** Function code ****************************************************
+    // The OS is running from now on, service times are measured
+    boNVM_HAL_AdpStatTimeStarted = TRUE;
+
+    return (KB_RET_OK);
+}
+//** EndOfFunction s16NVM_HAL_AdpStatStart *****************************************************************************
+
 // Function s16NVM_HAL_AdpDeriveAbsoluteMemoryAddress
 //**********************************************************************************************************************
 //! @brief          NVM_HAL-> Get Absolute Address
@@ -757,4 +973,411 @@ static S16 s16NVM_HAL_AdpWriteDeviceID1 (U8 u8NvmID, U8* pu8UsrBuffer, U32 u32Lo
 }
 //** EndOfFunction s16NVM_HAL_AdpWriteDevID1 ***************************************************************************
 
+// Function s16NVM_HAL_AdpWriteDiffDeviceID1
+//**********************************************************************************************************************
+//! @brief          Writes Device ID1. Writes inside a valid shadow area transfer only the changed byte runs.
+//!
+//! @param[in]      u8NvmID            : Device identifier
+//! @param[in]      pu8UsrBuffer       : Data to be written into memory device
+//! @param[in]      u32LocalAreaOffset : Offset in device ID1
+//! @param[in]      u32Length          : Number of bytes to write
+//!
+//! @return         Return Code
+//!                  - KB_RET_OK : Successful execution
+//!                  - negative value : In case of error.
+//!
+//! @remarks        Other writes are complete transfers. A shadow area touched by such a write is loaded again from
+//!                 FRAM if the write lies inside the area, otherwise it is invalidated.
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_AdpWriteDiffDeviceID1 (U8 u8NvmID, U8* pu8UsrBuffer, U32 u32LocalAreaOffset, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                          // Function Return value
+    U8 u8Area;                                              // Loop index of shadow areas
+    U8 u8Inside = NVM_HAL_SHADOW_MAX_AREAS;                 // Shadow area containing the write
+    U32 u32AreaEnd;                                         // End offset of the shadow area
+    U32 u32WriteEnd = u32LocalAreaOffset + u32Length;       // End offset of the write
+
+//*************************************************** Function code ****************************************************
+    // Find the shadow area containing the write
+    for (u8Area = 0U; (u8Area < u8NVM_HAL_CFG_ShadowAreaCnt) && (u8Area < NVM_HAL_SHADOW_MAX_AREAS); u8Area++)
+    {
+        u32AreaEnd = acNVM_HAL_CFG_ShadowArea[u8Area].u32Offset + acNVM_HAL_CFG_ShadowArea[u8Area].u32Size;
+        if ((u32LocalAreaOffset >= acNVM_HAL_CFG_ShadowArea[u8Area].u32Offset) && (u32WriteEnd <= u32AreaEnd))
+        {
+            u8Inside = u8Area;
+        }
+    }
+
+    if ((u8Inside < NVM_HAL_SHADOW_MAX_AREAS) && (aboNVM_HAL_AdpShadowValid[u8Inside] == TRUE))
+    {
+        // Changed byte runs only
+        s16Return = s16NVM_HAL_AdpShadowWrite(u8NvmID, u8Inside, pu8UsrBuffer, u32LocalAreaOffset, u32Length);
+    }
+    else
+    {
+        // Complete transfer
+        s16Return = s16NVM_HAL_AdpWriteDeviceID1(u8NvmID, pu8UsrBuffer, u32LocalAreaOffset, u32Length);
+
+        // Shadow areas touched by the write do not match the FRAM content anymore
+        for (u8Area = 0U; (u8Area < u8NVM_HAL_CFG_ShadowAreaCnt) && (u8Area < NVM_HAL_SHADOW_MAX_AREAS); u8Area++)
+        {
+            u32AreaEnd = acNVM_HAL_CFG_ShadowArea[u8Area].u32Offset + acNVM_HAL_CFG_ShadowArea[u8Area].u32Size;
+            if ((u32LocalAreaOffset < u32AreaEnd) && (u32WriteEnd > acNVM_HAL_CFG_ShadowArea[u8Area].u32Offset))
+            {
+                aboNVM_HAL_AdpShadowValid[u8Area] = FALSE;
+            }
+        }
+
+        // Area containing the write is loaded again, so that the next write can use it
+        if ((u8Inside < NVM_HAL_SHADOW_MAX_AREAS) && (s16Return == KB_RET_OK))
+        {
+            vNVM_HAL_AdpShadowLoad(u8NvmID, u8Inside);
+        }
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_AdpWriteDiffDeviceID1 ********************************************************************
+
+// Function s16NVM_HAL_AdpShadowWrite
+//**********************************************************************************************************************
+//! @brief          Compares the data with the shadow area and writes only the changed byte runs to FRAM.
+//!
+//! @param[in]      u8NvmID            : Device identifier
+//! @param[in]      u8Area             : Index of the shadow area containing the write
+//! @param[in]      pu8UsrBuffer       : Data to be written into memory device
+//! @param[in]      u32LocalAreaOffset : Offset in device ID1
+//! @param[in]      u32Length          : Number of bytes to write
+//!
+//! @return         Return Code
+//!                  - KB_RET_OK : Successful execution
+//!                  - negative value : In case of error.
+//!
+//! @remarks        Runs separated by less than u32NVM_HAL_CFG_ShadowMergeGap unchanged bytes are merged, a transfer
+//!                 is at most u32NVM_HAL_CFG_ShadowMaxTxfer bytes. The shadow is updated after each successful
+//!                 transfer and invalidated if a transfer fails.
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_AdpShadowWrite (U8 u8NvmID, U8 u8Area, U8* pu8UsrBuffer, U32 u32LocalAreaOffset, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    U8* pu8Shadow;                                          // Shadow of the first byte of the write
+    U32 u32Pos = 0U;                                        // Current position in the write
+    U32 u32Start;                                           // Start of the current run
+    U32 u32End;                                             // End of the current run (exclusive)
+    U32 u32Equal;                                           // Unchanged bytes behind the current run
+
+//*************************************************** Function code ****************************************************
+    pu8Shadow = &acNVM_HAL_CFG_ShadowArea[u8Area].pu8Shadow[u32LocalAreaOffset -
+                                                             acNVM_HAL_CFG_ShadowArea[u8Area].u32Offset];
+
+    while ((u32Pos < u32Length) && (s16Return == KB_RET_OK))
+    {
+        // Skip unchanged bytes
+        while ((u32Pos < u32Length) && (pu8Shadow[u32Pos] == pu8UsrBuffer[u32Pos]))
+        {
+            u32Pos++;
+        }
+
+        if (u32Pos < u32Length)
+        {
+            // Extend the run over short unchanged gaps, up to the maximum transfer size
+            u32Start = u32Pos;
+            u32End = u32Pos + 1U;
+            u32Equal = 0U;
+            u32Pos++;
+            while ((u32Pos < u32Length) && ((u32Pos - u32Start) < u32NVM_HAL_CFG_ShadowMaxTxfer) &&
+                   (u32Equal < u32NVM_HAL_CFG_ShadowMergeGap))
+            {
+                if (pu8Shadow[u32Pos] == pu8UsrBuffer[u32Pos])
+                {
+                    u32Equal++;
+                }
+                else
+                {
+                    u32Equal = 0U;
+                    u32End = u32Pos + 1U;
+                }
+                u32Pos++;
+            }
+
+            // Write the run and take it over into the shadow
+            s16Return = s16NVM_HAL_AdpWriteDeviceID1(u8NvmID, &pu8UsrBuffer[u32Start],
+                                                     u32LocalAreaOffset + u32Start, u32End - u32Start);
+            if (s16Return == KB_RET_OK)
+            {
+                memcpy(&pu8Shadow[u32Start], &pu8UsrBuffer[u32Start], (size_t)(u32End - u32Start));
+            }
+            else
+            {
+                // FRAM content of the run is unknown
+                aboNVM_HAL_AdpShadowValid[u8Area] = FALSE;
+            }
+            u32Pos = u32End;
+        }
+    }
+
+    // Without changed bytes nothing was transferred, the write is complete as well
+    if (s16Return == KB_RET_OK)
+    {
+        eDeviceOperationStatus = eNVM_HAL_DEVICE_STATUS_FREE;
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_AdpShadowWrite ***************************************************************************
+
+// Function vNVM_HAL_AdpShadowLoad
+//**********************************************************************************************************************
+//! @brief          Loads a shadow area from FRAM.
+//!
+//! @param[in]      u8NvmID : Device identifier
+//! @param[in]      u8Area  : Index of the shadow area
+//!
+//! @return         -
+//!
+//! @remarks        The shadow area is valid only if the read is successful.
+//**********************************************************************************************************************
+static void vNVM_HAL_AdpShadowLoad (U8 u8NvmID, U8 u8Area)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                          // Result of the read
+
+//*************************************************** Function code ****************************************************
+    s16Return = s16NVM_HAL_AdpReadDeviceID1(u8NvmID, acNVM_HAL_CFG_ShadowArea[u8Area].pu8Shadow,
+                                            acNVM_HAL_CFG_ShadowArea[u8Area].u32Offset,
+                                            acNVM_HAL_CFG_ShadowArea[u8Area].u32Size);
+
+    aboNVM_HAL_AdpShadowValid[u8Area] = (s16Return == KB_RET_OK) ? TRUE : FALSE;
+}
+//** EndOfFunction vNVM_HAL_AdpShadowLoad ******************************************************************************
+
+// Function s16NVM_HAL_AdpFramWriteBlocking
+//**********************************************************************************************************************
+//! @brief          Writes data to FRAM and waits for the end of the transfer (POFF interfaces).
+//!
+//! @param[in]      u32DstAddr : FRAM address
+//! @param[in]      pu8SrcAddr : Data to write
+//! @param[in]      u32Length  : Number of bytes to write
+//!
+//! @return         Return Code
+//!                  - KB_RET_OK : Successful execution
+//!                  - KB_RET_ERR_DRIVER : Driver error
+//!
+//! @remarks        -
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_AdpFramWriteBlocking (U32 u32DstAddr, U8* pu8SrcAddr, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                          // Function Return value
+
+//*************************************************** Function code ****************************************************
+    // Pass the WRITE request to driver interface
+    s16Return = s16FRAM_HAL_Write(u32DstAddr, pu8SrcAddr, u32Length);
+
+    // Check return
+    if (s16Return < 0)
+    {
+        // return error
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+    else
+    {
+        // Check FRAM status for write command until it is finished or fails
+        do
+        {
+            s16Return = s16FRAM_HAL_ChkWriteStatus();
+        } while ((s16Return != KB_RET_OK) && (s16Return != KB_RET_ERR_DRIVER));
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_AdpFramWriteBlocking *********************************************************************
+
+// Function vNVM_HAL_AdpPoffLoadShadow
+//**********************************************************************************************************************
+//! @brief          Reads the POFF save area from FRAM at startup.
+//!
+//! @details        The shadow is the reference for the incremental POFF save: a line of a POFF block is only
+//!                 written to FRAM if it differs from the shadow. If FRAM can not be read, the shadow stays invalid
+//!                 and complete blocks are written.
+//!
+//! @return         -
+//!
+//! @remarks        The shadow is read back from FRAM (not taken from the retained POFF buffer), so it is also exact
+//!                 after an interrupted POFF save.
+//**********************************************************************************************************************
+static void vNVM_HAL_AdpPoffLoadShadow (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                          // Return value of the read interfaces
+
+//*************************************************** Function code ****************************************************
+    // Content of the POFF save area
+    s16Return = s16NVM_HAL_AdpPoffRead((U32)0, (U8*)(void*)au32NVM_HAL_AdpPoffShadow, NVM_HAL_POFF_BUFF_SIZE);
+
+    boNVM_HAL_AdpPoffShadowValid = (s16Return == KB_RET_OK) ? TRUE : FALSE;
+}
+//** EndOfFunction vNVM_HAL_AdpPoffLoadShadow **************************************************************************
+
+// Function vNVM_HAL_AdpWriteStampUpdate
+//**********************************************************************************************************************
+//! @brief          Increments the write stamps of all blocks touched by a write or erase.
+//!
+//! @param[in]      u8NvmID            : Device identifier
+//! @param[in]      u32LocalAreaOffset : Offset in the device
+//! @param[in]      u32Length          : Number of bytes written
+//!
+//! @return         -
+//!
+//! @remarks        Called before the device is written. Stamps wrap around, readers only compare them for equality.
+//**********************************************************************************************************************
+static void vNVM_HAL_AdpWriteStampUpdate (U8 u8NvmID, U32 u32LocalAreaOffset, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    U32 u32Block;                                           // Loop index of stamp blocks
+    U32 u32LastBlock;                                       // Last stamp block of the write
+
+//*************************************************** Function code ****************************************************
+    if ((u8NvmID < NVM_HAL_WRITE_STAMP_DEVICES) && (u32Length != 0U))
+    {
+        // Same block mapping as s16NVM_HAL_AdpGetWriteStamp
+        u32Block = u32LocalAreaOffset >> NVM_HAL_WRITE_STAMP_BLOCK_SHIFT;
+        u32LastBlock = (u32LocalAreaOffset + u32Length - 1U) >> NVM_HAL_WRITE_STAMP_BLOCK_SHIFT;
+        if (u32LastBlock >= NVM_HAL_WRITE_STAMP_BLOCKS)
+        {
+            u32LastBlock = NVM_HAL_WRITE_STAMP_BLOCKS - 1U;
+        }
+        if (u32Block > u32LastBlock)
+        {
+            u32Block = u32LastBlock;
+        }
+
+        for (; u32Block <= u32LastBlock; u32Block++)
+        {
+            aau16NVM_HAL_AdpWriteStamp[u8NvmID][u32Block]++;
+        }
+    }
+}
+//** EndOfFunction vNVM_HAL_AdpWriteStampUpdate ************************************************************************
+
+// Function u32NVM_HAL_AdpStatTimeMs
+//**********************************************************************************************************************
+//! @brief          Returns the current time of the statistics time source.
+//!
+//! @return         Time in ms, 0 without time source
+//!
+//! @remarks        The time source belongs to the OS, it is not called before s16NVM_HAL_AdpStatStart (NVM
+//!                 initialization runs before the OS is started).
+//**********************************************************************************************************************
+static U32 u32NVM_HAL_AdpStatTimeMs (void)
+{
+//************************************************ Function scope data *************************************************
+    U32 u32TimeMs = 0U;                                     // Current time
+
+//*************************************************** Function code ****************************************************
+    if ((boNVM_HAL_AdpStatTimeStarted == TRUE) && (pfs16NVM_HAL_CFG_StatGetTimeMs != KB_NULL_PTR))
+    {
+        if (pfs16NVM_HAL_CFG_StatGetTimeMs(&u32TimeMs) != KB_RET_OK)
+        {
+            u32TimeMs = 0U;
+        }
+    }
+
+    return (u32TimeMs);
+}
+//** EndOfFunction u32NVM_HAL_AdpStatTimeMs ****************************************************************************
+
+// Function vNVM_HAL_AdpStatRecord
+//**********************************************************************************************************************
+//! @brief          Counts a finished operation in its statistics area.
+//!
+//! @param[in]      u8NvmID            : Device identifier
+//! @param[in]      u8AreaID           : POFF area identifier (NVM_DEVICE_ID0)
+//! @param[in]      u32LocalAreaOffset : Offset in the device (NVM_DEVICE_ID1, NVM_DEVICE_ID2)
+//! @param[in]      u32Length          : Number of bytes
+//! @param[in]      eOp                : Operation
+//! @param[in]      s16Result          : Result of the operation
+//! @param[in]      u32StartMs         : Time at the start of the operation
+//!
+//! @return         -
+//!
+//! @remarks        Operations outside all statistics areas are not counted. Counters saturate.
+//**********************************************************************************************************************
+static void vNVM_HAL_AdpStatRecord (U8 u8NvmID,
+                                    U8 u8AreaID,
+                                    U32 u32LocalAreaOffset,
+                                    U32 u32Length,
+                                    E_NVM_HAL_STAT_OP eOp,
+                                    S16 s16Result,
+                                    U32 u32StartMs)
+{
+//************************************************ Function scope data *************************************************
+    const C_NVM_HAL_STAT_AREA* pcArea;                      // Statistics area
+    C_NVM_HAL_STAT_CNT* pcCnt;                              // Statistics of the operation
+    U8 u8StatArea = 0U;                                     // Index of the statistics area
+    BOOLEAN boFound = FALSE;                                // Statistics area found
+    U32 u32TimeMs;                                          // Service time
+    U32 u32Bin = 0U;                                        // Histogram bin
+
+//*************************************************** Function code ****************************************************
+    // First matching area, the areas of the upper layers are listed before the reserved areas containing them
+    while ((boFound == FALSE) && (u8StatArea < u8NVM_HAL_CFG_StatAreaCnt) && (u8StatArea < NVM_HAL_STAT_MAX_AREAS))
+    {
+        pcArea = &acNVM_HAL_CFG_StatArea[u8StatArea];
+        if (pcArea->u8NvmID == u8NvmID)
+        {
+            if (u8NvmID == NVM_DEVICE_ID0)
+            {
+                boFound = (pcArea->u8AreaID == u8AreaID) ? TRUE : FALSE;
+            }
+            else
+            {
+                boFound = ((u32LocalAreaOffset >= pcArea->u32Offset) &&
+                           ((u32LocalAreaOffset - pcArea->u32Offset) < pcArea->u32Size)) ? TRUE : FALSE;
+            }
+        }
+        if (boFound == FALSE)
+        {
+            u8StatArea++;
+        }
+    }
+
+    if ((boFound == TRUE) && (eOp < eNVM_HAL_STAT_OP_NUM))
+    {
+        pcCnt = &aacNVM_HAL_AdpStat[u8StatArea][eOp];
+
+        // Time source wraps around, unsigned difference is the elapsed time. Start time 0: no time source at the
+        // start of the operation, the service time is not known
+        u32TimeMs = (u32StartMs != 0U) ? (u32NVM_HAL_AdpStatTimeMs() - u32StartMs) : 0U;
+
+        // Bin n holds times with n significant bits
+        while ((u32Bin < ((U32)NVM_HAL_STAT_HIST_BINS - 1U)) && ((u32TimeMs >> u32Bin) != 0U))
+        {
+            u32Bin++;
+        }
+
+        if (pcCnt->u32OpCnt != 0xFFFFFFFFUL)
+        {
+            pcCnt->u32OpCnt++;
+            pcCnt->au32Hist[u32Bin]++;
+        }
+        pcCnt->u32ByteCnt = ((0xFFFFFFFFUL - pcCnt->u32ByteCnt) > u32Length) ?
+                            (pcCnt->u32ByteCnt + u32Length) : 0xFFFFFFFFUL;
+        if ((s16Result != KB_RET_OK) && (pcCnt->u32ErrCnt != 0xFFFFFFFFUL))
+        {
+            pcCnt->u32ErrCnt++;
+        }
+        if (u32TimeMs > pcCnt->u32MaxTimeMs)
+        {
+            pcCnt->u32MaxTimeMs = u32TimeMs;
+        }
+    }
+}
+//** EndOfFunction vNVM_HAL_AdpStatRecord ******************************************************************************
+
 //** EndOfFile nvm_hal_adp.c *******************************************************************************************
@@ -0,0 +1,975 @@
+//**********************************************************************************************************************
+//
+//                                                  nvm_hal_flog.c
+//
+//**********************************************************************************************************************
+//
+//                                        Copyrights(c) by KNORR-BREMSE
+//                                         Rail Vehicle Systems, Munich
+//
+//! @project   IBC
+//! @date      2026-10-19
+//! @author    agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file      nvm_hal_flog.c
+//! @brief     Log structured, wear levelled store of NVM_DEVICE_ID2 (program flash).
+//!
+//!            Sector layout (all items aligned to flash double words, a double word is programmed only once):
+//!             - sector header      : magic, generation and inverted generation (written after the sector
+//!                                    content is complete)
+//!             - records            : record header (magic, page, checksum), page data, commit marker
+//!             - erased flash       : free space
+//!
+//!            A record is valid only if its commit marker is programmed. The commit marker is programmed after
+//!            header and data, so a record interrupted by a power loss is ignored at the next startup.
+//!            An erase record (page NVM_HAL_FLOG_ERASE_PAGE, no data) invalidates all older records.
+//!
+//!            Garbage collection copies the newest record of every page into the spare sector, writes the sector
+//!            header with the next generation and erases the old sector. If both sectors have a valid header at
+//!            startup, the one with the higher generation is used and the other one is erased. Erasing sets bits,
+//!            so the inverted generation rejects the header of a sector whose erase was interrupted.
+//!
+//!            The spare sector is only erased when the log store is created if it is blank or holds an
+//!            interrupted creation of the log store: other content of the flash sector is never destroyed.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date            Author              Changes
+// 2026-10-19      agent               Start
+// 2026-10-19      agent               Inverted generation in the sector header, spare sector checked before import
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma )	************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "string.h"                                             // String related interfaces
+#include "kb_types.h"                                           // Standard definitions
+#include "kb_ret.h"                                             // Global Knorr-Bremse return value definitions
+#include "nvm_hal_bs_i.h"                                       // NVM-HAL device specific definitions
+#include "flsh_hal.h"                                           // Flash HAL interfaces
+#include "nvm_hal_flog_i.h"                                     // Log store interfaces
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Number of flash sectors used by the log store
+#define NVM_HAL_FLOG_SECTOR_CNT          ((U8) 2)
+
+//! Size of a flash double word, smallest unit which can be programmed
+#define NVM_HAL_FLOG_DWORD_SIZE          ((U32) 8)
+
+//! Magic number of a valid sector header ("FLOG")
+#define NVM_HAL_FLOG_SECTOR_MAGIC        ((U32) 0x464C4F47)
+
+//! Magic number of a record header
+#define NVM_HAL_FLOG_RECORD_MAGIC        ((U16) 0x5AA5)
+
+//! Page number of an erase record
+#define NVM_HAL_FLOG_ERASE_PAGE          ((U16) 0xFFFE)
+
+//! Magic number of a commit marker ("CMIT")
+#define NVM_HAL_FLOG_COMMIT_MAGIC        ((U32) 0x434D4954)
+
+//! Erased flash word
+#define NVM_HAL_FLOG_ERASED_U32          ((U32) 0xFFFFFFFF)
+
+//! Erased flash byte
+#define NVM_HAL_FLOG_ERASED_U8           ((U8) 0xFF)
+
+//! Index value of a page without record
+#define NVM_HAL_FLOG_UNMAPPED            ((U16) 0xFFFF)
+
+//! Sizes of the items in a sector
+#define NVM_HAL_FLOG_SECTOR_HDR_SIZE     ((U32)(2U * NVM_HAL_FLOG_DWORD_SIZE))
+#define NVM_HAL_FLOG_RECORD_HDR_SIZE     NVM_HAL_FLOG_DWORD_SIZE
+#define NVM_HAL_FLOG_COMMIT_SIZE         NVM_HAL_FLOG_DWORD_SIZE
+#define NVM_HAL_FLOG_PAGE_RECORD_SIZE    (NVM_HAL_FLOG_RECORD_HDR_SIZE + NVM_HAL_FLOG_PAGE_SIZE + \
+                                          NVM_HAL_FLOG_COMMIT_SIZE)
+#define NVM_HAL_FLOG_ERASE_RECORD_SIZE   (NVM_HAL_FLOG_RECORD_HDR_SIZE + NVM_HAL_FLOG_COMMIT_SIZE)
+
+//! Index of the other sector
+#define NVM_HAL_FLOG_OTHER_SECTOR(x)     ((U8)(1U - (x)))
+
+//**************************************** Type definitions ( typedef ) ************************************************
+//! Flash sector used by the log store
+typedef struct
+{
+    U8  u8Bank;                                                 //!< Flash bank
+    U8  u8Sector;                                               //!< Sector number (55xflsh.h)
+    U32 u32Address;                                             //!< Start address
+} C_NVM_HAL_FLOG_SECTOR;
+
+//! Sector header
+typedef struct
+{
+    U32 u32Magic;                                               //!< NVM_HAL_FLOG_SECTOR_MAGIC if valid
+    U32 u32Generation;                                          //!< Incremented with every garbage collection
+    U32 u32GenerationInv;                                       //!< Inverted generation
+    U32 u32Reserved;                                            //!< Fills the double word
+} C_NVM_HAL_FLOG_SECTOR_HDR;
+
+//! Record header and page data, programmed with one flash write
+typedef struct
+{
+    U16 u16Magic;                                               //!< NVM_HAL_FLOG_RECORD_MAGIC
+    U16 u16Page;                                                //!< Page number or NVM_HAL_FLOG_ERASE_PAGE
+    U32 u32Checksum;                                            //!< Checksum of page number and page data
+    U8  au8Data[NVM_HAL_FLOG_PAGE_SIZE];                        //!< Page data
+} C_NVM_HAL_FLOG_RECORD;
+
+//! Commit marker
+typedef struct
+{
+    U32 u32Magic;                                               //!< NVM_HAL_FLOG_COMMIT_MAGIC
+    U32 u32Reserved;                                            //!< Fills the double word
+} C_NVM_HAL_FLOG_COMMIT;
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+//! Offset of the newest record of each page in the active sector
+static U16 au16NVM_HAL_FlogIndex[NVM_HAL_FLOG_MAX_PAGES];
+
+//! Active sector
+static U8 u8NVM_HAL_FlogActive = 0U;
+
+//! Generation of the active sector
+static U32 u32NVM_HAL_FlogGeneration = 0U;
+
+//! Offset of the next record in the active sector
+static U32 u32NVM_HAL_FlogWritePos = NVM_HAL_FLOG_SECTOR_HDR_SIZE;
+
+//! Log store is mounted
+static BOOLEAN boNVM_HAL_FlogMounted = FALSE;
+
+//! Record buffer
+static C_NVM_HAL_FLOG_RECORD cNVM_HAL_FlogRecord;
+
+//**************************************** Module global constants ( static const ) ************************************
+//! Sectors of the log store
+static const C_NVM_HAL_FLOG_SECTOR acNVM_HAL_FlogSector[NVM_HAL_FLOG_SECTOR_CNT] =
+{
+    // Bank,              Sector,                    Address
+    { NVM_PFLASH_BANK_0,  (U8)NVM_PFLASH_SECTOR_0,   NVM_PFLASH_SECTOR_0_ADDR },
+    { NVM_PFLASH_BANK_0,  (U8)NVM_PFLASH_SECTOR_1,   NVM_PFLASH_SECTOR_1_ADDR }
+};
+
+//! Commit marker
+static const C_NVM_HAL_FLOG_COMMIT cNVM_HAL_FlogCommit = { NVM_HAL_FLOG_COMMIT_MAGIC, 0U };
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+static S16 s16NVM_HAL_FlogScan (void);
+
+static S16 s16NVM_HAL_FlogAppend (U16 u16Page);
+
+static S16 s16NVM_HAL_FlogCollect (void);
+
+static S16 s16NVM_HAL_FlogImport (void);
+
+static S16 s16NVM_HAL_FlogEraseSector (U8 u8Sector);
+
+static S16 s16NVM_HAL_FlogCheckSpare (U8 u8Sector);
+
+static BOOLEAN boNVM_HAL_FlogSectorHdrValid (const C_NVM_HAL_FLOG_SECTOR_HDR* pcHdr);
+
+static S16 s16NVM_HAL_FlogWriteSectorHdr (U8 u8Sector, U32 u32Generation);
+
+static S16 s16NVM_HAL_FlogReadPage (U16 u16Page, U8* pu8Data);
+
+static U32 u32NVM_HAL_FlogChecksum (U16 u16Page, const U8* pu8Data);
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_HAL_FlogInit
+//**********************************************************************************************************************
+S16 s16NVM_HAL_FlogInit (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    C_NVM_HAL_FLOG_SECTOR_HDR acHdr[NVM_HAL_FLOG_SECTOR_CNT]; // Sector headers
+    BOOLEAN aboValid[NVM_HAL_FLOG_SECTOR_CNT];              // Sector header valid
+    U8 u8Idx;                                               // Loop index of sectors
+
+//*************************************************** Function code ****************************************************
+    boNVM_HAL_FlogMounted = FALSE;
+
+    // Read both sector headers
+    for (u8Idx = 0U; (u8Idx < NVM_HAL_FLOG_SECTOR_CNT) && (s16Return >= KB_RET_OK); u8Idx++)
+    {
+        s16Return = s16FLSH_HAL_Read(eFLSH_HAL_TYPE_PFLASH, acNVM_HAL_FlogSector[u8Idx].u32Address,
+                                     (U8*)(void*)&acHdr[u8Idx], (U32)sizeof(C_NVM_HAL_FLOG_SECTOR_HDR));
+        aboValid[u8Idx] = boNVM_HAL_FlogSectorHdrValid(&acHdr[u8Idx]);
+    }
+
+    if (s16Return < KB_RET_OK)
+    {
+        ; // Flash can not be read, error is returned
+    }
+    else if ((aboValid[0] == TRUE) && (aboValid[1] == TRUE))
+    {
+        // Garbage collection was interrupted after the new sector was completed: newer generation wins
+        u8NVM_HAL_FlogActive = (acHdr[1].u32Generation > acHdr[0].u32Generation) ? (U8)1U : (U8)0U;
+        u32NVM_HAL_FlogGeneration = acHdr[u8NVM_HAL_FlogActive].u32Generation;
+        s16Return = s16NVM_HAL_FlogEraseSector(NVM_HAL_FLOG_OTHER_SECTOR(u8NVM_HAL_FlogActive));
+    }
+    else if ((aboValid[0] == TRUE) || (aboValid[1] == TRUE))
+    {
+        // Normal case: one active sector
+        u8NVM_HAL_FlogActive = (aboValid[1] == TRUE) ? (U8)1U : (U8)0U;
+        u32NVM_HAL_FlogGeneration = acHdr[u8NVM_HAL_FlogActive].u32Generation;
+    }
+    else
+    {
+        // No log store yet: take over the content written in place by the previous software
+        s16Return = s16NVM_HAL_FlogImport();
+    }
+
+    // Build the RAM index
+    if (s16Return >= KB_RET_OK)
+    {
+        s16Return = s16NVM_HAL_FlogScan();
+    }
+
+    if (s16Return >= KB_RET_OK)
+    {
+        boNVM_HAL_FlogMounted = TRUE;
+        s16Return = KB_RET_OK;
+    }
+    else
+    {
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_FlogInit *********************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_HAL_FlogRead
+//**********************************************************************************************************************
+S16 s16NVM_HAL_FlogRead (U32 u32Offset, U8* pu8Buffer, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    U32 u32Pos = 0U;                                        // Number of bytes read
+    U32 u32InPage;                                          // Offset inside the current page
+    U32 u32Chunk;                                           // Number of bytes of the current page
+    U16 u16Page;                                            // Current page
+    U16 u16RecordPos;                                       // Record of the current page
+
+//*************************************************** Function code ****************************************************
+    if ((boNVM_HAL_FlogMounted == FALSE) || (pu8Buffer == KB_NULL_PTR))
+    {
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+    else if ((u32Offset > NVM_HAL_FLOG_LOGICAL_SIZE) || (u32Length > (NVM_HAL_FLOG_LOGICAL_SIZE - u32Offset)))
+    {
+        s16Return = KB_RET_ERR_ARG;
+    }
+    else
+    {
+        while ((u32Pos < u32Length) && (s16Return >= KB_RET_OK))
+        {
+            u16Page = (U16)((u32Offset + u32Pos) / NVM_HAL_FLOG_PAGE_SIZE);
+            u32InPage = (u32Offset + u32Pos) % NVM_HAL_FLOG_PAGE_SIZE;
+            u32Chunk = NVM_HAL_FLOG_PAGE_SIZE - u32InPage;
+            if (u32Chunk > (u32Length - u32Pos))
+            {
+                u32Chunk = u32Length - u32Pos;
+            }
+
+            u16RecordPos = au16NVM_HAL_FlogIndex[u16Page];
+
+            if (u16RecordPos == NVM_HAL_FLOG_UNMAPPED)
+            {
+                // Page never written: erased flash
+                memset(&pu8Buffer[u32Pos], (int)NVM_HAL_FLOG_ERASED_U8, (size_t)u32Chunk);
+            }
+            else
+            {
+                // Data of the newest record
+                s16Return = s16FLSH_HAL_Read(eFLSH_HAL_TYPE_PFLASH,
+                                             acNVM_HAL_FlogSector[u8NVM_HAL_FlogActive].u32Address +
+                                             (U32)u16RecordPos + NVM_HAL_FLOG_RECORD_HDR_SIZE + u32InPage,
+                                             &pu8Buffer[u32Pos],
+                                             u32Chunk);
+            }
+
+            u32Pos += u32Chunk;
+        }
+
+        if (s16Return < KB_RET_OK)
+        {
+            s16Return = KB_RET_ERR_DRIVER;
+        }
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_FlogRead *********************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_HAL_FlogWrite
+//**********************************************************************************************************************
+S16 s16NVM_HAL_FlogWrite (U32 u32Offset, const U8* pu8Buffer, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    U32 u32Pos = 0U;                                        // Number of bytes written
+    U32 u32InPage;                                          // Offset inside the current page
+    U32 u32Chunk;                                           // Number of bytes of the current page
+    U16 u16Page;                                            // Current page
+
+//*************************************************** Function code ****************************************************
+    if ((boNVM_HAL_FlogMounted == FALSE) || (pu8Buffer == KB_NULL_PTR))
+    {
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+    else if ((u32Offset > NVM_HAL_FLOG_LOGICAL_SIZE) || (u32Length > (NVM_HAL_FLOG_LOGICAL_SIZE - u32Offset)))
+    {
+        s16Return = KB_RET_ERR_ARG;
+    }
+    else
+    {
+        while ((u32Pos < u32Length) && (s16Return == KB_RET_OK))
+        {
+            u16Page = (U16)((u32Offset + u32Pos) / NVM_HAL_FLOG_PAGE_SIZE);
+            u32InPage = (u32Offset + u32Pos) % NVM_HAL_FLOG_PAGE_SIZE;
+            u32Chunk = NVM_HAL_FLOG_PAGE_SIZE - u32InPage;
+            if (u32Chunk > (u32Length - u32Pos))
+            {
+                u32Chunk = u32Length - u32Pos;
+            }
+
+            // Merge the new data into the current page content
+            s16Return = s16NVM_HAL_FlogReadPage(u16Page, cNVM_HAL_FlogRecord.au8Data);
+
+            if ((s16Return == KB_RET_OK) &&
+                (memcmp(&cNVM_HAL_FlogRecord.au8Data[u32InPage], &pu8Buffer[u32Pos], (size_t)u32Chunk) != 0))
+            {
+                // Page content changes: append a new record
+                memcpy(&cNVM_HAL_FlogRecord.au8Data[u32InPage], &pu8Buffer[u32Pos], (size_t)u32Chunk);
+                s16Return = s16NVM_HAL_FlogAppend(u16Page);
+            }
+
+            u32Pos += u32Chunk;
+        }
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_FlogWrite ********************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_HAL_FlogErase
+//**********************************************************************************************************************
+S16 s16NVM_HAL_FlogErase (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    U16 u16Page;                                            // Loop index of pages
+    BOOLEAN boMapped = FALSE;                               // At least one page has a record
+
+//*************************************************** Function code ****************************************************
+    if (boNVM_HAL_FlogMounted == FALSE)
+    {
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+    else
+    {
+        for (u16Page = 0U; u16Page < (U16)NVM_HAL_FLOG_MAX_PAGES; u16Page++)
+        {
+            if (au16NVM_HAL_FlogIndex[u16Page] != NVM_HAL_FLOG_UNMAPPED)
+            {
+                boMapped = TRUE;
+            }
+        }
+
+        // Nothing to do if the logical content is already erased
+        if (boMapped == TRUE)
+        {
+            s16Return = s16NVM_HAL_FlogAppend(NVM_HAL_FLOG_ERASE_PAGE);
+        }
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_FlogErase ********************************************************************************
+
+// Function s16NVM_HAL_FlogScan
+//**********************************************************************************************************************
+//! @brief          Builds the RAM index from the records of the active sector.
+//!
+//! @return         Return Code
+//!                  - KB_RET_OK : Successful execution
+//!                  - negative value : Flash error
+//!
+//! @remarks        Records without commit marker or with wrong checksum are skipped. If the end of the log can not
+//!                 be identified (damaged record header), the valid records are compacted into the spare sector.
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_FlogScan (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    U32 u32Pos = NVM_HAL_FLOG_SECTOR_HDR_SIZE;              // Offset of the current record
+    U32 u32RecordSize;                                      // Size of the current record
+    U32 u32Address = acNVM_HAL_FlogSector[u8NVM_HAL_FlogActive].u32Address;
+    C_NVM_HAL_FLOG_COMMIT cCommit;                          // Commit marker of the current record
+    BOOLEAN boEnd = FALSE;                                  // End of log found
+    BOOLEAN boDamaged = FALSE;                              // Damaged record header found
+
+//*************************************************** Function code ****************************************************
+    memset(au16NVM_HAL_FlogIndex, (int)NVM_HAL_FLOG_ERASED_U8, sizeof(au16NVM_HAL_FlogIndex));
+
+    while ((boEnd == FALSE) && (s16Return >= KB_RET_OK) &&
+           ((u32Pos + NVM_HAL_FLOG_ERASE_RECORD_SIZE) <= NVM_PFLASH_SECTOR_SIZE))
+    {
+        s16Return = s16FLSH_HAL_Read(eFLSH_HAL_TYPE_PFLASH, u32Address + u32Pos,
+                                     (U8*)(void*)&cNVM_HAL_FlogRecord, NVM_HAL_FLOG_RECORD_HDR_SIZE);
+
+        if (s16Return < KB_RET_OK)
+        {
+            ; // Flash error, returned
+        }
+        else if ((((U32*)(void*)&cNVM_HAL_FlogRecord)[0] == NVM_HAL_FLOG_ERASED_U32) &&
+                 (cNVM_HAL_FlogRecord.u32Checksum == NVM_HAL_FLOG_ERASED_U32))
+        {
+            // Erased flash: end of the log
+            boEnd = TRUE;
+        }
+        else if ((cNVM_HAL_FlogRecord.u16Magic != NVM_HAL_FLOG_RECORD_MAGIC) ||
+                 ((cNVM_HAL_FlogRecord.u16Page != NVM_HAL_FLOG_ERASE_PAGE) &&
+                  ((U32)cNVM_HAL_FlogRecord.u16Page >= NVM_HAL_FLOG_MAX_PAGES)))
+        {
+            // Record header damaged by a power loss while programming: size of the record is unknown
+            boDamaged = TRUE;
+            boEnd = TRUE;
+        }
+        else
+        {
+            u32RecordSize = (cNVM_HAL_FlogRecord.u16Page == NVM_HAL_FLOG_ERASE_PAGE) ?
+                            NVM_HAL_FLOG_ERASE_RECORD_SIZE : NVM_HAL_FLOG_PAGE_RECORD_SIZE;
+
+            if ((u32Pos + u32RecordSize) > NVM_PFLASH_SECTOR_SIZE)
+            {
+                // Record does not fit into the sector
+                boDamaged = TRUE;
+                boEnd = TRUE;
+            }
+            else
+            {
+                s16Return = s16FLSH_HAL_Read(eFLSH_HAL_TYPE_PFLASH,
+                                             (u32Address + u32Pos + u32RecordSize) - NVM_HAL_FLOG_COMMIT_SIZE,
+                                             (U8*)(void*)&cCommit, NVM_HAL_FLOG_COMMIT_SIZE);
+
+                if ((s16Return < KB_RET_OK) || (cCommit.u32Magic != NVM_HAL_FLOG_COMMIT_MAGIC))
+                {
+                    ; // Not committed: record is ignored
+                }
+                else if (cNVM_HAL_FlogRecord.u16Page == NVM_HAL_FLOG_ERASE_PAGE)
+                {
+                    // Erase record invalidates all older records
+                    memset(au16NVM_HAL_FlogIndex, (int)NVM_HAL_FLOG_ERASED_U8, sizeof(au16NVM_HAL_FlogIndex));
+                }
+                else
+                {
+                    // Verify the page data before the record is used
+                    s16Return = s16FLSH_HAL_Read(eFLSH_HAL_TYPE_PFLASH,
+                                                 u32Address + u32Pos + NVM_HAL_FLOG_RECORD_HDR_SIZE,
+                                                 cNVM_HAL_FlogRecord.au8Data, NVM_HAL_FLOG_PAGE_SIZE);
+
+                    if ((s16Return >= KB_RET_OK) &&
+                        (u32NVM_HAL_FlogChecksum(cNVM_HAL_FlogRecord.u16Page, cNVM_HAL_FlogRecord.au8Data) ==
+                         cNVM_HAL_FlogRecord.u32Checksum))
+                    {
+                        au16NVM_HAL_FlogIndex[cNVM_HAL_FlogRecord.u16Page] = (U16)u32Pos;
+                    }
+                }
+
+                u32Pos += u32RecordSize;
+            }
+        }
+    }
+
+    u32NVM_HAL_FlogWritePos = u32Pos;
+
+    // No further record can be appended behind a damaged one
+    if ((s16Return >= KB_RET_OK) && (boDamaged == TRUE))
+    {
+        s16Return = s16NVM_HAL_FlogCollect();
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_FlogScan *********************************************************************************
+
+// Function s16NVM_HAL_FlogAppend
+//**********************************************************************************************************************
+//! @brief          Appends a record to the active sector and updates the RAM index.
+//!
+//! @param[in]      u16Page : Page of the record, NVM_HAL_FLOG_ERASE_PAGE for an erase record.
+//!                           The page data is taken from cNVM_HAL_FlogRecord.au8Data.
+//!
+//! @return         Return Code
+//!                  - KB_RET_OK : Successful execution
+//!                  - KB_RET_ERR_DRIVER : Flash error or no space left
+//!
+//! @remarks        Runs the garbage collection if the active sector is full.
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_FlogAppend (U16 u16Page)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+    U32 u32RecordSize;                                      // Size of the record
+    U32 u32Address;                                         // Flash address of the record
+
+//*************************************************** Function code ****************************************************
+    u32RecordSize = (u16Page == NVM_HAL_FLOG_ERASE_PAGE) ?
+                    NVM_HAL_FLOG_ERASE_RECORD_SIZE : NVM_HAL_FLOG_PAGE_RECORD_SIZE;
+
+    // Make space: garbage collection keeps only the newest record of each page
+    if ((u32NVM_HAL_FlogWritePos + u32RecordSize) > NVM_PFLASH_SECTOR_SIZE)
+    {
+        s16Return = s16NVM_HAL_FlogCollect();
+    }
+
+    if ((s16Return >= KB_RET_OK) && ((u32NVM_HAL_FlogWritePos + u32RecordSize) > NVM_PFLASH_SECTOR_SIZE))
+    {
+        // Can not happen with the configured logical size
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+
+    if (s16Return >= KB_RET_OK)
+    {
+        u32Address = acNVM_HAL_FlogSector[u8NVM_HAL_FlogActive].u32Address + u32NVM_HAL_FlogWritePos;
+
+        // Header and data first
+        cNVM_HAL_FlogRecord.u16Magic = NVM_HAL_FLOG_RECORD_MAGIC;
+        cNVM_HAL_FlogRecord.u16Page = u16Page;
+        cNVM_HAL_FlogRecord.u32Checksum = (u16Page == NVM_HAL_FLOG_ERASE_PAGE) ?
+                                          (U32)0U : u32NVM_HAL_FlogChecksum(u16Page, cNVM_HAL_FlogRecord.au8Data);
+
+        s16Return = s16FLSH_HAL_Write(eFLSH_HAL_TYPE_PFLASH, u32Address, (U8*)(void*)&cNVM_HAL_FlogRecord,
+                                      u32RecordSize - NVM_HAL_FLOG_COMMIT_SIZE, TRUE);
+
+        // Commit marker last: the record is valid from now on
+        if (s16Return >= KB_RET_OK)
+        {
+            s16Return = s16FLSH_HAL_Write(eFLSH_HAL_TYPE_PFLASH,
+                                          (u32Address + u32RecordSize) - NVM_HAL_FLOG_COMMIT_SIZE,
+                                          (U8*)(void*)&cNVM_HAL_FlogCommit, NVM_HAL_FLOG_COMMIT_SIZE, TRUE);
+        }
+
+        if (s16Return >= KB_RET_OK)
+        {
+            if (u16Page == NVM_HAL_FLOG_ERASE_PAGE)
+            {
+                memset(au16NVM_HAL_FlogIndex, (int)NVM_HAL_FLOG_ERASED_U8, sizeof(au16NVM_HAL_FlogIndex));
+            }
+            else
+            {
+                au16NVM_HAL_FlogIndex[u16Page] = (U16)u32NVM_HAL_FlogWritePos;
+            }
+            s16Return = KB_RET_OK;
+        }
+        else
+        {
+            s16Return = KB_RET_ERR_DRIVER;
+        }
+
+        // Space of a failed record is not reused
+        u32NVM_HAL_FlogWritePos += u32RecordSize;
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_FlogAppend *******************************************************************************
+
+// Function s16NVM_HAL_FlogCollect
+//**********************************************************************************************************************
+//! @brief          Garbage collection: copies the newest record of each page into the spare sector, which becomes
+//!                 the active sector.
+//!
+//! @return         Return Code
+//!                  - KB_RET_OK : Successful execution
+//!                  - negative value : Flash error, the active sector is kept
+//!
+//! @remarks        The page data of the record buffer is preserved. The sector header of the new sector is written
+//!                 after all records are copied, the old sector is erased last.
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_FlogCollect (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                          // Function Return value
+    U8 u8Target = NVM_HAL_FLOG_OTHER_SECTOR(u8NVM_HAL_FlogActive); // Spare sector
+    U32 u32Pos = NVM_HAL_FLOG_SECTOR_HDR_SIZE;              // Offset of the next record in the spare sector
+    U32 u32Address;                                         // Flash address of the current record
+    U16 u16Page;                                            // Loop index of pages
+    U16 au16NewIndex[NVM_HAL_FLOG_MAX_PAGES];               // Index of the spare sector
+    U8 au8Pending[NVM_HAL_FLOG_PAGE_SIZE];                  // Page data of the record buffer
+
+//*************************************************** Function code ****************************************************
+    memcpy(au8Pending, cNVM_HAL_FlogRecord.au8Data, sizeof(au8Pending));
+    memset(au16NewIndex, (int)NVM_HAL_FLOG_ERASED_U8, sizeof(au16NewIndex));
+
+    s16Return = s16NVM_HAL_FlogEraseSector(u8Target);
+
+    for (u16Page = 0U; (u16Page < (U16)NVM_HAL_FLOG_MAX_PAGES) && (s16Return >= KB_RET_OK); u16Page++)
+    {
+        if (au16NVM_HAL_FlogIndex[u16Page] != NVM_HAL_FLOG_UNMAPPED)
+        {
+            // Copy header and data of the newest record, then its commit marker
+            u32Address = acNVM_HAL_FlogSector[u8Target].u32Address + u32Pos;
+
+            s16Return = s16FLSH_HAL_Read(eFLSH_HAL_TYPE_PFLASH,
+                                         acNVM_HAL_FlogSector[u8NVM_HAL_FlogActive].u32Address +
+                                         (U32)au16NVM_HAL_FlogIndex[u16Page],
+                                         (U8*)(void*)&cNVM_HAL_FlogRecord,
+                                         NVM_HAL_FLOG_PAGE_RECORD_SIZE - NVM_HAL_FLOG_COMMIT_SIZE);
+
+            if (s16Return >= KB_RET_OK)
+            {
+                s16Return = s16FLSH_HAL_Write(eFLSH_HAL_TYPE_PFLASH, u32Address, (U8*)(void*)&cNVM_HAL_FlogRecord,
+                                              NVM_HAL_FLOG_PAGE_RECORD_SIZE - NVM_HAL_FLOG_COMMIT_SIZE, TRUE);
+            }
+
+            if (s16Return >= KB_RET_OK)
+            {
+                s16Return = s16FLSH_HAL_Write(eFLSH_HAL_TYPE_PFLASH,
+                                              (u32Address + NVM_HAL_FLOG_PAGE_RECORD_SIZE) - NVM_HAL_FLOG_COMMIT_SIZE,
+                                              (U8*)(void*)&cNVM_HAL_FlogCommit, NVM_HAL_FLOG_COMMIT_SIZE, TRUE);
+            }
+
+            au16NewIndex[u16Page] = (U16)u32Pos;
+            u32Pos += NVM_HAL_FLOG_PAGE_RECORD_SIZE;
+        }
+    }
+
+    // Spare sector is complete: make it the active one, then release the old sector
+    if (s16Return >= KB_RET_OK)
+    {
+        s16Return = s16NVM_HAL_FlogWriteSectorHdr(u8Target, u32NVM_HAL_FlogGeneration + 1U);
+    }
+
+    if (s16Return >= KB_RET_OK)
+    {
+        u32NVM_HAL_FlogGeneration++;
+        u8NVM_HAL_FlogActive = u8Target;
+        u32NVM_HAL_FlogWritePos = u32Pos;
+        memcpy(au16NVM_HAL_FlogIndex, au16NewIndex, sizeof(au16NVM_HAL_FlogIndex));
+
+        s16Return = s16NVM_HAL_FlogEraseSector(NVM_HAL_FLOG_OTHER_SECTOR(u8Target));
+    }
+
+    memcpy(cNVM_HAL_FlogRecord.au8Data, au8Pending, sizeof(au8Pending));
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_FlogCollect ******************************************************************************
+
+// Function s16NVM_HAL_FlogImport
+//**********************************************************************************************************************
+//! @brief          Creates the log store. Content stored in place in sector 0 by the previous software is copied
+//!                 page by page into sector 1, which becomes the active sector.
+//!
+//! @return         Return Code
+//!                  - KB_RET_OK : Successful execution
+//!                  - negative value : Flash error
+//!
+//! @remarks        Only the logical size of the log store is taken over. Sector 0 is erased after the sector header
+//!                 of sector 1 is written, so an interrupted import is repeated at the next startup.
+//!                 Sector 1 is only erased if s16NVM_HAL_FlogCheckSpare accepts it.
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_FlogImport (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                          // Function Return value
+    U32 u32Pos = NVM_HAL_FLOG_SECTOR_HDR_SIZE;              // Offset of the next record in sector 1
+    U32 u32Address;                                         // Flash address of the current record
+    U32 u32Idx;                                             // Loop index of bytes
+    U16 u16Page;                                            // Loop index of pages
+    BOOLEAN boErased;                                       // Page is erased
+
+//*************************************************** Function code ****************************************************
+    s16Return = s16NVM_HAL_FlogCheckSpare(1U);
+
+    if (s16Return >= KB_RET_OK)
+    {
+        s16Return = s16NVM_HAL_FlogEraseSector(1U);
+    }
+
+    for (u16Page = 0U; (u16Page < (U16)NVM_HAL_FLOG_MAX_PAGES) && (s16Return >= KB_RET_OK); u16Page++)
+    {
+        s16Return = s16FLSH_HAL_Read(eFLSH_HAL_TYPE_PFLASH,
+                                     acNVM_HAL_FlogSector[0].u32Address + ((U32)u16Page * NVM_HAL_FLOG_PAGE_SIZE),
+                                     cNVM_HAL_FlogRecord.au8Data, NVM_HAL_FLOG_PAGE_SIZE);
+
+        boErased = TRUE;
+        for (u32Idx = 0U; u32Idx < NVM_HAL_FLOG_PAGE_SIZE; u32Idx++)
+        {
+            if (cNVM_HAL_FlogRecord.au8Data[u32Idx] != NVM_HAL_FLOG_ERASED_U8)
+            {
+                boErased = FALSE;
+            }
+        }
+
+        // Erased pages need no record
+        if ((s16Return >= KB_RET_OK) && (boErased == FALSE))
+        {
+            u32Address = acNVM_HAL_FlogSector[1].u32Address + u32Pos;
+            cNVM_HAL_FlogRecord.u16Magic = NVM_HAL_FLOG_RECORD_MAGIC;
+            cNVM_HAL_FlogRecord.u16Page = u16Page;
+            cNVM_HAL_FlogRecord.u32Checksum = u32NVM_HAL_FlogChecksum(u16Page, cNVM_HAL_FlogRecord.au8Data);
+
+            s16Return = s16FLSH_HAL_Write(eFLSH_HAL_TYPE_PFLASH, u32Address, (U8*)(void*)&cNVM_HAL_FlogRecord,
+                                          NVM_HAL_FLOG_PAGE_RECORD_SIZE - NVM_HAL_FLOG_COMMIT_SIZE, TRUE);
+
+            if (s16Return >= KB_RET_OK)
+            {
+                s16Return = s16FLSH_HAL_Write(eFLSH_HAL_TYPE_PFLASH,
+                                              (u32Address + NVM_HAL_FLOG_PAGE_RECORD_SIZE) - NVM_HAL_FLOG_COMMIT_SIZE,
+                                              (U8*)(void*)&cNVM_HAL_FlogCommit, NVM_HAL_FLOG_COMMIT_SIZE, TRUE);
+            }
+
+            u32Pos += NVM_HAL_FLOG_PAGE_RECORD_SIZE;
+        }
+    }
+
+    if (s16Return >= KB_RET_OK)
+    {
+        s16Return = s16NVM_HAL_FlogWriteSectorHdr(1U, 1U);
+    }
+
+    if (s16Return >= KB_RET_OK)
+    {
+        u8NVM_HAL_FlogActive = 1U;
+        u32NVM_HAL_FlogGeneration = 1U;
+        s16Return = s16NVM_HAL_FlogEraseSector(0U);
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_FlogImport *******************************************************************************
+
+// Function s16NVM_HAL_FlogEraseSector
+//**********************************************************************************************************************
+//! @brief          Erases a sector of the log store.
+//!
+//! @param[in]      u8Sector : Index of the sector (0, 1)
+//!
+//! @return         Return value of s16FLSH_HAL_Erase
+//!
+//! @remarks        -
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_FlogEraseSector (U8 u8Sector)
+{
+    // Complete sector is erased
+    return (s16FLSH_HAL_Erase(eFLSH_HAL_TYPE_PFLASH, acNVM_HAL_FlogSector[u8Sector].u8Bank,
+                              acNVM_HAL_FlogSector[u8Sector].u8Sector, TRUE));
+}
+//** EndOfFunction s16NVM_HAL_FlogEraseSector **************************************************************************
+
+// Function s16NVM_HAL_FlogCheckSpare
+//**********************************************************************************************************************
+//! @brief          Checks that a sector without valid sector header may be erased to create the log store.
+//!
+//! @param[in]      u8Sector : Index of the sector (0, 1)
+//!
+//! @return         Return Code
+//!                  - KB_RET_OK : Sector is blank or holds the records of an interrupted import
+//!                  - KB_RET_ERR_CONFIG : Sector holds other content, it is not erased
+//!                  - negative value : Flash error
+//!
+//! @remarks        An interrupted import has an erased sector header followed by a page record. Any other sector
+//!                 must be completely erased.
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_FlogCheckSpare (U8 u8Sector)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                          // Function Return value
+    U32 u32Address = acNVM_HAL_FlogSector[u8Sector].u32Address;
+    U32 u32Pos;                                             // Offset of the current chunk
+    U32 u32Idx;                                             // Loop index of bytes
+    C_NVM_HAL_FLOG_SECTOR_HDR cHdr;                         // Sector header
+    BOOLEAN boBlank = TRUE;                                 // No programmed byte found
+
+//*************************************************** Function code ****************************************************
+    // Sector header and first record header
+    s16Return = s16FLSH_HAL_Read(eFLSH_HAL_TYPE_PFLASH, u32Address, (U8*)(void*)&cHdr, NVM_HAL_FLOG_SECTOR_HDR_SIZE);
+
+    if (s16Return >= KB_RET_OK)
+    {
+        s16Return = s16FLSH_HAL_Read(eFLSH_HAL_TYPE_PFLASH, u32Address + NVM_HAL_FLOG_SECTOR_HDR_SIZE,
+                                     (U8*)(void*)&cNVM_HAL_FlogRecord, NVM_HAL_FLOG_RECORD_HDR_SIZE);
+    }
+
+    if ((cHdr.u32Magic != NVM_HAL_FLOG_ERASED_U32) || (cHdr.u32Generation != NVM_HAL_FLOG_ERASED_U32) ||
+        (cHdr.u32GenerationInv != NVM_HAL_FLOG_ERASED_U32) || (cHdr.u32Reserved != NVM_HAL_FLOG_ERASED_U32))
+    {
+        boBlank = FALSE;
+    }
+
+    if ((s16Return < KB_RET_OK) || (boBlank == FALSE))
+    {
+        ; // Flash error or programmed sector header
+    }
+    else if ((cNVM_HAL_FlogRecord.u16Magic == NVM_HAL_FLOG_RECORD_MAGIC) &&
+             ((U32)cNVM_HAL_FlogRecord.u16Page < NVM_HAL_FLOG_MAX_PAGES))
+    {
+        ; // Record written by an interrupted import
+    }
+    else
+    {
+        // All bytes of the sector must be erased
+        for (u32Pos = 0U; (u32Pos < NVM_PFLASH_SECTOR_SIZE) && (s16Return >= KB_RET_OK) && (boBlank == TRUE);
+             u32Pos += NVM_HAL_FLOG_PAGE_SIZE)
+        {
+            s16Return = s16FLSH_HAL_Read(eFLSH_HAL_TYPE_PFLASH, u32Address + u32Pos, cNVM_HAL_FlogRecord.au8Data,
+                                         NVM_HAL_FLOG_PAGE_SIZE);
+
+            for (u32Idx = 0U; (u32Idx < NVM_HAL_FLOG_PAGE_SIZE) && (s16Return >= KB_RET_OK); u32Idx++)
+            {
+                if (cNVM_HAL_FlogRecord.au8Data[u32Idx] != NVM_HAL_FLOG_ERASED_U8)
+                {
+                    boBlank = FALSE;
+                }
+            }
+        }
+    }
+
+    if ((s16Return >= KB_RET_OK) && (boBlank == FALSE))
+    {
+        // Sector is not reserved for the log store
+        s16Return = KB_RET_ERR_CONFIG;
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_FlogCheckSpare ***************************************************************************
+
+// Function boNVM_HAL_FlogSectorHdrValid
+//**********************************************************************************************************************
+//! @brief          Checks a sector header.
+//!
+//! @param[in]      pcHdr : Sector header read from flash
+//!
+//! @return         TRUE if magic number and inverted generation match
+//!
+//! @remarks        An interrupted erase sets bits of generation and inverted generation, which no longer match.
+//**********************************************************************************************************************
+static BOOLEAN boNVM_HAL_FlogSectorHdrValid (const C_NVM_HAL_FLOG_SECTOR_HDR* pcHdr)
+{
+    return (((pcHdr->u32Magic == NVM_HAL_FLOG_SECTOR_MAGIC) &&
+             ((pcHdr->u32Generation ^ pcHdr->u32GenerationInv) == NVM_HAL_FLOG_ERASED_U32)) ? TRUE : FALSE);
+}
+//** EndOfFunction boNVM_HAL_FlogSectorHdrValid ************************************************************************
+
+// Function s16NVM_HAL_FlogWriteSectorHdr
+//**********************************************************************************************************************
+//! @brief          Writes the header of a sector, which makes the sector valid.
+//!
+//! @param[in]      u8Sector      : Index of the sector (0, 1)
+//! @param[in]      u32Generation : Generation of the sector
+//!
+//! @return         Return value of s16FLSH_HAL_Write
+//!
+//! @remarks        -
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_FlogWriteSectorHdr (U8 u8Sector, U32 u32Generation)
+{
+//************************************************ Function scope data *************************************************
+    C_NVM_HAL_FLOG_SECTOR_HDR cHdr;                         // Sector header
+
+//*************************************************** Function code ****************************************************
+    cHdr.u32Magic = NVM_HAL_FLOG_SECTOR_MAGIC;
+    cHdr.u32Generation = u32Generation;
+    cHdr.u32GenerationInv = ~u32Generation;
+    cHdr.u32Reserved = 0U;
+
+    return (s16FLSH_HAL_Write(eFLSH_HAL_TYPE_PFLASH, acNVM_HAL_FlogSector[u8Sector].u32Address,
+                              (U8*)(void*)&cHdr, NVM_HAL_FLOG_SECTOR_HDR_SIZE, TRUE));
+}
+//** EndOfFunction s16NVM_HAL_FlogWriteSectorHdr ***********************************************************************
+
+// Function s16NVM_HAL_FlogReadPage
+//**********************************************************************************************************************
+//! @brief          Reads the complete content of a page.
+//!
+//! @param[in]      u16Page : Page number
+//! @param[out]     pu8Data : Page content (NVM_HAL_FLOG_PAGE_SIZE bytes)
+//!
+//! @return         Return Code
+//!                  - KB_RET_OK : Successful execution
+//!                  - KB_RET_ERR_DRIVER : Flash error
+//!
+//! @remarks        -
+//**********************************************************************************************************************
+static S16 s16NVM_HAL_FlogReadPage (U16 u16Page, U8* pu8Data)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                              // Function Return value
+
+//*************************************************** Function code ****************************************************
+    if (au16NVM_HAL_FlogIndex[u16Page] == NVM_HAL_FLOG_UNMAPPED)
+    {
+        // Page never written: erased flash
+        memset(pu8Data, (int)NVM_HAL_FLOG_ERASED_U8, (size_t)NVM_HAL_FLOG_PAGE_SIZE);
+    }
+    else
+    {
+        s16Return = s16FLSH_HAL_Read(eFLSH_HAL_TYPE_PFLASH,
+                                     acNVM_HAL_FlogSector[u8NVM_HAL_FlogActive].u32Address +
+                                     (U32)au16NVM_HAL_FlogIndex[u16Page] + NVM_HAL_FLOG_RECORD_HDR_SIZE,
+                                     pu8Data, NVM_HAL_FLOG_PAGE_SIZE);
+
+        s16Return = (s16Return < KB_RET_OK) ? KB_RET_ERR_DRIVER : KB_RET_OK;
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_HAL_FlogReadPage *****************************************************************************
+
+// Function u32NVM_HAL_FlogChecksum
+//**********************************************************************************************************************
+//! @brief          Checksum of a page record (page number and data).
+//!
+//! @param[in]      u16Page : Page number
+//! @param[in]      pu8Data : Page data (NVM_HAL_FLOG_PAGE_SIZE bytes)
+//!
+//! @return         Checksum
+//!
+//! @remarks        Rotate and add, the commit marker already protects against interrupted programming.
+//**********************************************************************************************************************
+static U32 u32NVM_HAL_FlogChecksum (U16 u16Page, const U8* pu8Data)
+{
+//************************************************ Function scope data *************************************************
+    U32 u32Sum = (U32)u16Page;                              // Checksum
+    U32 u32Idx;                                             // Loop index of bytes
+
+//*************************************************** Function code ****************************************************
+    for (u32Idx = 0U; u32Idx < NVM_HAL_FLOG_PAGE_SIZE; u32Idx++)
+    {
+        u32Sum = ((u32Sum << 5) | (u32Sum >> 27)) + (U32)pu8Data[u32Idx];
+    }
+
+    // Return result
+    return (u32Sum);
+}
+//** EndOfFunction u32NVM_HAL_FlogChecksum *****************************************************************************
+
+//** EndOfFile nvm_hal_flog.c ******************************************************************************************
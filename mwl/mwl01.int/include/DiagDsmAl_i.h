@@ -0,0 +1,75 @@
+//**********************************************************************************************************************
+//
+//                                                    DiagDsmAl_i.h
+//
+//**********************************************************************************************************************
+//
+//                                          Copyright (C) 2026 by KNORR-BREMSE,
+//                                     Systeme fuer Schienenfahrzeuge GmbH, Muenchen
+//
+//! @project   IBC
+//! @date      2026-10-19
+//! @author    agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file
+//! @brief Adaption layer for DSM - Interfaces in addition to the FWK interface DiagDsmAlNvMem.h
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date          Author         Changes
+// 2026-10-19    agent          Start, bulk read of the state object states
+//
+//**********************************************************************************************************************
+
+#ifndef DIAGDSMAL_I_H
+#define DIAGDSMAL_I_H
+
+//******************************************* Header / include files ( #include ) **************************************
+#include "kb_types.h"                                           // Standard definitions
+
+//******************************************* Constant / macro definitions ( #define ) *********************************
+//! Packed state of a state object returned by s16DiagDsmAlNvMem_GetBulk:
+//! bit 0 simple state, bit 1 degradation state, bits 2..6 simple root cause, bit 7 zero
+#define DIAG_DSM_AL_BULK_SIMPLE_SHIFT   0U
+#define DIAG_DSM_AL_BULK_DEGR_SHIFT     1U
+#define DIAG_DSM_AL_BULK_RC_SHIFT       2U
+
+//*************************************************** Type definitions ( typedef ) *************************************
+
+//***************************************************** Global data declarations ( extern ) ****************************
+
+//*************************************** External parameter / constant declarations ( extern const ) ******************
+
+//************************************************* Global func/proc prototypes ****************************************
+
+//* Function s16DiagDsmAlNvMem_GetBulk *********************************************************************************
+//!
+//! @brief      Copies simple state, degradation state and simple root cause of many state objects in one call, one
+//!             packed byte per state object (DIAG_DSM_AL_BULK_xxx_SHIFT), in the order of the state object index.
+//!             A range larger than the output buffer is read in pages: the next call starts at *pu16Next.
+//!
+//! @param[in]  u16First   : First state object
+//! @param[in]  u16Count   : Number of state objects of the range
+//! @param[in]  pu8Select  : Bitmap of the selected state objects, bit (i % 8) of byte (i / 8) for state object i,
+//!                          covering the range. KB_NULL_PTR selects all state objects of the range.
+//! @param[out] pu8Out     : Packed states of the selected state objects
+//! @param[in]  u16OutSize : Size of pu8Out
+//! @param[out] pu16Next   : First state object not copied, u16First + u16Count if the range is complete
+//! @param[out] pu16OutLen : Number of bytes written to pu8Out
+//!
+//! @return     CO_ERROR_NONE on success,
+//!             CO_ERROR_ARG if the range exceeds C_DIAG_DSM_MAX_NR_STATEOBJECTS or for null pointers.
+//!
+//! @remark     The states are read from the RAM copy of the DSM data without locking. An update of the DSM running
+//!             at the same time may be seen for some state objects only.
+//!
+//**********************************************************************************************************************
+extern S16 s16DiagDsmAlNvMem_GetBulk(const U16 u16First, const U16 u16Count, const U8* const pu8Select,
+    U8* const pu8Out, const U16 u16OutSize, U16* const pu16Next, U16* const pu16OutLen);
+
+#endif // DIAGDSMAL_I_H
+
+// EndOfFile DiagDsmAl_i.h *********************************************************************************************
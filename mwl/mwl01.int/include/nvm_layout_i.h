@@ -0,0 +1,164 @@
+//**********************************************************************************************************************
+//
+//                                                  nvm_layout_i.h
+//
+//**********************************************************************************************************************
+//
+//                                        Copyrights(c) by KNORR-BREMSE,
+//                                         Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date    2026-10-19
+//! @author  agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file    nvm_layout_i.h
+//! @brief   Layout of the NVM devices: single description of the HAL (cfg_nvm_hal.c), SVL (cfg_nvm.c) and
+//!          APP (c_nvm.c) areas.
+//!
+//!          Each layer of each device is one list NVM_LAYOUT_<DEVx>_<LAYER>(X) of entries
+//!              X(Layer, Name, AreaID, Size, Align)
+//!          in memory order. The last area of the HAL and SVL lists is the reserved area of the next layer.
+//!
+//!          The area offsets are not written by hand: NVM_LAYOUT_TYPE() builds a structure with one member per
+//!          area, NVM_LAYOUT_OFFSET() is the offset of the member. Areas can not overlap and have no gaps.
+//!          NVM_LAYOUT_DEFINE() additionally checks at compile time
+//!           - the offset of each area is a multiple of its Align value (transfer boundaries of hot areas)
+//!           - the sum of the area sizes does not exceed NVM_LAYOUT_<DEVx>_<LAYER>_CAPACITY
+//!          A failing check stops the compilation with a negative array size error in NVM_LAYOUT_CHECK_<name>.
+//!
+//!          Each configuration file defines (with checks) the lists of its own layer. AreaID and the capacities of
+//!          the HAL lists are evaluated in the owning configuration file only.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+// 2026-10-19   agent          Added the journal of the NVM transactions (nvm_txn.c) to the SVL areas of Device_1
+//
+//**********************************************************************************************************************
+
+#ifndef NVM_LAYOUT_I_H
+#define NVM_LAYOUT_I_H
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "stddef.h"                                             // offsetof
+#include "kb_types.h"                                           // Standard definitions
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//----------------------------------------------------------------------------------------------------------------------
+//! Generators
+//----------------------------------------------------------------------------------------------------------------------
+//! Structure with one member per area of a list
+#define NVM_LAYOUT_MEMBER(L, Name, Id, Size, Align)     U8 au8##Name[(Size)];
+#define NVM_LAYOUT_TYPE(L)                              typedef struct { NVM_LAYOUT_##L(NVM_LAYOUT_MEMBER) } \
+                                                        C_NVM_LAYOUT_##L;
+
+//! Offset of an area, relative to the start of its layer
+#define NVM_LAYOUT_OFFSET(L, Name)                      ((U32) offsetof(C_NVM_LAYOUT_##L, au8##Name))
+
+//! Sum of the area sizes of a layer
+#define NVM_LAYOUT_SIZE(L)                              ((U32) sizeof(C_NVM_LAYOUT_##L))
+
+//! Compile time check
+#define NVM_LAYOUT_CHECK(Name, Cond)                    typedef U8 NVM_LAYOUT_CHECK_##Name[(Cond) ? 1 : -1];
+#define NVM_LAYOUT_CHECK_ALIGN(L, Name, Id, Size, Align) \
+                                                        NVM_LAYOUT_CHECK(L##_##Name, \
+                                                                         (NVM_LAYOUT_OFFSET(L, Name) % (Align)) == 0U)
+
+//! Structure and checks of a layer
+#define NVM_LAYOUT_DEFINE(L)                            NVM_LAYOUT_TYPE(L) \
+                                                        NVM_LAYOUT_##L(NVM_LAYOUT_CHECK_ALIGN) \
+                                                        NVM_LAYOUT_CHECK(L##_CAPACITY, \
+                                                                         NVM_LAYOUT_SIZE(L) <= NVM_LAYOUT_##L##_CAPACITY)
+
+//----------------------------------------------------------------------------------------------------------------------
+//! Reserved areas, size of the part of a device handed over to the next layer
+//----------------------------------------------------------------------------------------------------------------------
+#define NVM_LAYOUT_DEV0_HAL_RES_SIZE        ((U32) 4096)        //!< POFF buffer part of the non FWR areas
+#define NVM_LAYOUT_DEV0_SVL_RES_SIZE        ((U32) 0x0C00)      //!< 3kB, APP
+#define NVM_LAYOUT_DEV1_HAL_RES_SIZE        ((U32) 0x1D800)     //!< SVL + APP
+#define NVM_LAYOUT_DEV1_SVL_RES_SIZE        ((U32) 0x14000)     //!< APP
+#define NVM_LAYOUT_DEV2_HAL_RES_SIZE        ((U32) 0x6000)      //!< SVL + APP, logical size of the flash log store
+#define NVM_LAYOUT_DEV2_SVL_RES_SIZE        ((U32) 0x6000)      //!< APP
+
+//! Capacity of the layers
+#define NVM_LAYOUT_DEV0_HAL_CAPACITY        ((U32)(NVM_HAL_POFF_BUFF_AREAS_SIZE_U32 * 4U)) //!< cfg_nvm_hal.c only
+#define NVM_LAYOUT_DEV0_SVL_CAPACITY        NVM_LAYOUT_DEV0_HAL_RES_SIZE
+#define NVM_LAYOUT_DEV0_APP_CAPACITY        NVM_LAYOUT_DEV0_SVL_RES_SIZE
+#define NVM_LAYOUT_DEV1_HAL_CAPACITY        NVM_DEV_1_SIZE                                 //!< cfg_nvm_hal.c only
+#define NVM_LAYOUT_DEV1_SVL_CAPACITY        NVM_LAYOUT_DEV1_HAL_RES_SIZE
+#define NVM_LAYOUT_DEV1_APP_CAPACITY        NVM_LAYOUT_DEV1_SVL_RES_SIZE
+#define NVM_LAYOUT_DEV2_HAL_CAPACITY        NVM_DEV_2_SIZE                                 //!< cfg_nvm_hal.c only
+#define NVM_LAYOUT_DEV2_SVL_CAPACITY        NVM_LAYOUT_DEV2_HAL_RES_SIZE
+#define NVM_LAYOUT_DEV2_APP_CAPACITY        NVM_LAYOUT_DEV2_SVL_RES_SIZE
+
+//----------------------------------------------------------------------------------------------------------------------
+//! Device_0, i.e. POFF device. Sizes of the HAL and SVL areas are given by the FWR/GenCA data (byte aligned),
+//! APP areas are accessed in U32 units.
+//----------------------------------------------------------------------------------------------------------------------
+#define NVM_LAYOUT_DEV0_HAL(X) \
+    X(DEV0_HAL, FATAL,     NVM_HAL_POFF_AREA_ID_FATAL,      NVM_HAL_POFF_AREA_SIZE_FATAL,       1U) \
+    X(DEV0_HAL, CRITICAL,  NVM_HAL_POFF_AREA_ID_CRITICAL,   NVM_HAL_POFF_AREA_SIZE_CRITICAL,    1U) \
+    X(DEV0_HAL, ONN,       NVM_HAL_POFF_AREA_ID_ONN,        NVM_HAL_POFF_AREA_SIZE_ONN,         1U) \
+    X(DEV0_HAL, MAINTFLAG, NVM_HAL_POFF_AREA_ID_MAINTFLAG,  NVM_HAL_POFF_AREA_SIZE_MAINTFLAG,   1U) \
+    X(DEV0_HAL, SPARE,     NVM_HAL_POFF_AREA_ID_SPARE,      NVM_HAL_POFF_AREA_SIZE_SPARE,       1U) \
+    X(DEV0_HAL, RES,       NVM_SVL_AREA_ID_RES,             NVM_LAYOUT_DEV0_HAL_RES_SIZE,       1U)
+
+#define NVM_LAYOUT_DEV0_SVL(X) \
+    X(DEV0_SVL, BD_LMTD,   NVM_POFF_SVL_AREA_ID_BD_LMTD,    NVM_POFF_SVL_AREA_SIZE_BD_LMTD,     1U) \
+    X(DEV0_SVL, NVM,       NVM_POFF_SVL_AREA_ID_NVM,        NVM_POFF_SVL_AREA_SIZE_NVM,         1U) \
+    X(DEV0_SVL, BCM_COMO,  NVM_POFF_SVL_AREA_ID_BCM_COMO,   NVM_POFF_SVL_AREA_SIZE_BCM_COMO,    1U) \
+    X(DEV0_SVL, RES_APP,   NVM_APP_AREA_ID_RES,             NVM_LAYOUT_DEV0_SVL_RES_SIZE,       1U)
+
+#define NVM_LAYOUT_DEV0_APP(X) \
+    X(DEV0_APP, DSM,       NVM_POFF_FWK_AREA_ID_DSM,        NVM_POFF_FWK_AREA_SIZE_DSM,         4U) \
+    X(DEV0_APP, MAMO,      NVM_POFF_FWK_AREA_ID_MAMO,       NVM_POFF_FWK_AREA_SIZE_MAMO,        4U) \
+    X(DEV0_APP, RTC,       NVM_POFF_FWK_AREA_ID_RTC,        NVM_POFF_FWK_AREA_SIZE_RTC,         4U) \
+    X(DEV0_APP, DFM,       NVM_POFF_FWK_AREA_ID_DFM,        NVM_POFF_FWK_AREA_SIZE_DFM,         4U) \
+    X(DEV0_APP, DRC,       NVM_POFF_FWK_AREA_ID_DRC,        NVM_POFF_FWK_AREA_SIZE_DRC,         4U)
+
+//----------------------------------------------------------------------------------------------------------------------
+//! Device_1, i.e. FRAM. Areas U32 aligned (DFM transfers are U32 aligned, see DiagDfmAl.c).
+//----------------------------------------------------------------------------------------------------------------------
+#define NVM_LAYOUT_DEV1_HAL(X) \
+    X(DEV1_HAL, SPARE,     NVM_HAL_AREA_ID1_SPARE,          ((U32) 0x0800),                     4U) \
+    X(DEV1_HAL, RES,       NVM_SVL_AREA_ID_RES,             NVM_LAYOUT_DEV1_HAL_RES_SIZE,       4U)
+
+#define NVM_LAYOUT_DEV1_SVL(X) \
+    X(DEV1_SVL, SPARE,     NVM_SVL_AREA_ID1_SPARE,          ((U32) 0x9000),                     4U) \
+    X(DEV1_SVL, TXN_JRNL,  NVM_SVL_AREA_ID1_TXN_JRNL,       ((U32) 0x0800),                     4U) \
+    X(DEV1_SVL, RES_APP,   NVM_APP_AREA_ID_RES,             NVM_LAYOUT_DEV1_SVL_RES_SIZE,       4U)
+
+#define NVM_LAYOUT_DEV1_APP(X) \
+    X(DEV1_APP, USR_0,     NVM_USR_AREA_ID1_0,              ((U32) 0x0020),                     4U) \
+    X(DEV1_APP, FWK_DABA,  NVM_FWK_AREA_ID1_1,              ((U32) 0x0200),                     4U) \
+    X(DEV1_APP, FWK_DFM,   NVM_FWK_AREA_ID1_2,              ((U32) 0xA080),                     4U) \
+    X(DEV1_APP, SPARE,     NVM_USR_AREA_ID1_SPARE,          ((U32) 0x00C0),                     4U)
+
+//----------------------------------------------------------------------------------------------------------------------
+//! Device_2, i.e. FLASH (log structured store). Areas aligned to the pages of the store (0x80).
+//----------------------------------------------------------------------------------------------------------------------
+#define NVM_LAYOUT_DEV2_HAL(X) \
+    X(DEV2_HAL, RES,       NVM_SVL_AREA_ID_RES,             NVM_LAYOUT_DEV2_HAL_RES_SIZE,       0x80U)
+
+#define NVM_LAYOUT_DEV2_SVL(X) \
+    X(DEV2_SVL, RES_APP,   NVM_APP_AREA_ID_RES,             NVM_LAYOUT_DEV2_SVL_RES_SIZE,       0x80U)
+
+#define NVM_LAYOUT_DEV2_APP(X) \
+    X(DEV2_APP, LADC,      NVM_USR_AREA_ID2_0,              ((U32) 0x4000),                     0x80U) \
+    X(DEV2_APP, SPARE,     NVM_USR_AREA_ID2_SPARE,          ((U32) 0x2000),                     0x80U)
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data declarations ( extern ) *****************************************
+
+//**************************************** External parameter / constant declarations ( extern const )	****************
+
+//**************************************** Global func/proc prototypes *************************************************
+
+#endif // NVM_LAYOUT_I_H
+
+// EndOfFile nvm_layout_i.h ********************************************************************************************
@@ -37,6 +37,11 @@
 //  2020-12-09   A. Gatare    Adapted for GenCA 6.11
 // 2023-01-09    J. Lulli     Coding guidelines alignment
 // 2023-11-30   C. Brancolini Lint Plus clean up
+// 2026-10-19    agent        Simple and detailed root cause data written in one NVM transaction (nvm_txn.h)
+// 2026-10-19    agent        Only changed Simple Root cause entries written, nothing if nothing changed; the CRC is
+//                            calculated completely (resuming it from the last unchanged block was descoped)
+// 2026-10-19    agent        s16DiagDsmAlNvMem_GetBulk added (states of many state objects in one call)
+// 2026-10-19    agent        NVM transaction only for Simple and Detail Root cause data written together
 //
 //**********************************************************************************************************************
 
@@ -55,8 +60,11 @@
 #include "sse_crc.h"
 #include "bcm.h"
 #include <string.h>
+#include <stddef.h>                 // offsetof
 #include "nvm.h"                    // NVM interfaces
 #include "nvm_common.h"             // NVM Common definitions
+#include "nvm_txn.h"                // NVM transactions
+#include "DiagDsmAl_i.h"             // Own interface in addition to DiagDsmAlNvMem.h
 
 //**************************************** Constant / macro definitions ( #define ) ************************************
 // DsmNvMemFormatVer and Simple Root cause length for CRC calculation
@@ -68,12 +76,24 @@
 // Detail Root cause buffer length for CRC calculation
 #define DIAG_DSM_DETAIL_RC_BUFF_LEN     ( sizeof(cDiagDsmAlData.au32DsmAlDetailRC) ) // @suppress("No upper case suffix for integer constants")
 
+// Length of the simple root cause data with CRC in the non volatile memory, offset 0
+#define DIAG_DSM_SIMPLE_RC_WRITE_LEN    ( DIAG_DSM_SIMPLE_RC_BUFF_LEN + sizeof(cDiagDsmAlData.u32DsmAlSimpleRCDataCRC) )
+
+// Length of the detail root cause data with CRC in the non volatile memory, follows the simple root cause data
+#define DIAG_DSM_DETAIL_RC_WRITE_LEN    ( DIAG_DSM_DETAIL_RC_BUFF_LEN + sizeof(cDiagDsmAlData.u32DsmAlDetailRCDataCRC) )
+
 // NV Memory is 4 byte aligned
 #define DIAG_DSM_DETAIL_RC_SIZE_BYTE    ( C_DIAG_DSM_SIZE_DTLD_RC_TABLE_IN_BYTES + \
                                          (C_DIAG_DSM_SIZE_DTLD_RC_TABLE_IN_BYTES % 4) )
 
 #define DIAG_DSM_DETAIL_RC_SIZE_U32     ( DIAG_DSM_DETAIL_RC_SIZE_BYTE / 4 )
 
+// Offset of the Simple Root cause CRC in the non volatile memory
+#define DIAG_DSM_SIMPLE_RC_CRC_OFFSET   ( (U32) offsetof(C_DIAG_DSMAL_DATA, u32DsmAlSimpleRCDataCRC) )
+
+// Transfers of the POFF device are U32 aligned
+#define DIAG_DSM_NVMEM_ALIGN            4U
+
 //************************************************ Type definitions ( typedef ) ****************************************
 //! Structure for FRAM DSM State ID and Simple Root cause
 typedef struct
@@ -106,11 +126,19 @@ typedef struct
 //********************************************** Module scope data segment ( static ) **********************************
 static U32 u32DiagDsmAlPrevDsmFormatVer = 0; // Prev Diag DMS format version
 static C_DIAG_DSMAL_DATA cDiagDsmAlData;     // Diag DSM NV memory data copy
+static BOOLEAN boDiagDsmAlUpdateActive = FALSE;     // Between s16DiagDsmAlNvMem_StartUpdate and _FinishUpdate
+static BOOLEAN boDiagDsmAlDetailRCChanged = FALSE;  // Detail Root cause table changed during the update
+static BOOLEAN boDiagDsmAlSimpleRCAllDirty = TRUE;  // Complete Simple Root cause data to be written (format version)
+static U16 u16DiagDsmAlDirtyFirst = C_DIAG_DSM_MAX_NR_STATEOBJECTS; // First changed entry, none if > last
+static U16 u16DiagDsmAlDirtyLast = 0;               // Last changed entry
 
 
 //*************************************** Module scope read only variables ( static const ) ****************************
 
 //****************************************** Module scope func/proc prototypes ( static )*******************************
+static S16 s16DiagDsmAlNvMem_Write(const BOOLEAN boSimpleRC, const BOOLEAN boDetailRC);
+static S16 s16DiagDsmAlNvMem_WritePart(const BOOLEAN boTxn, const U32 u32Offset, U8* const pu8Data,
+                                       const U32 u32Len);
 
 //** EndOfHeader *******************************************************************************************************
 
@@ -142,6 +170,8 @@ S16 s16DiagDsmAlNvMem_init(const U32 u32DiagDsmNvMemFormatVersion)
         u32DiagDsmAlPrevDsmFormatVer = cDiagDsmAlData.u32DsmNvMemFormatVer;
         // Write the version passed as parameter in cDiagDsmAlData struct
         cDiagDsmAlData.u32DsmNvMemFormatVer = u32DiagDsmNvMemFormatVersion;
+        // Version is written with the complete Simple Root cause data by the first update
+        boDiagDsmAlSimpleRCAllDirty = TRUE;
         s16Ret = CO_ERROR_NONE;
     }
     else
@@ -164,6 +194,10 @@ S16 s16DiagDsmAlNvMem_StartUpdate(void)
 //************************************************ Function scope data *************************************************
 
 //*************************************************** Function code ****************************************************
+    // Detail Root cause table changes are written together with the Simple Root cause data at the end of the update
+    boDiagDsmAlUpdateActive = TRUE;
+    boDiagDsmAlDetailRCChanged = FALSE;
+
     return( CO_ERROR_NONE ); // Return ok
 }
 //** EndOfFunction s16DiagDsmAlNvMem_StartUpdate ***********************************************************************
@@ -174,43 +208,44 @@ S16 s16DiagDsmAlNvMem_StartUpdate(void)
 S16 s16DiagDsmAlNvMem_FinishUpdate(void)
 {
 //************************************************ Function scope data *************************************************
-    S16 s16Ret;                     // Function return variable
+    S16 s16Ret = CO_ERROR_NONE;     // Function return variable
+    BOOLEAN boSimpleRCChanged;      // Simple Root cause data changed since the last write
     U32 u32CalculatedCRC;           // Variable for CRC
-    U32 u32BuffLength;              // Variable for buffer len
-    E_NVM_OPERATION_STATUS eStatus = eNVM_STATUS_OPERATION_INIT;    // Local variable for operation status
 
 //*************************************************** Function code ****************************************************
-    // Calculate CRC over Diag DSM DsmNvMemFormatVer and Simple Root cause data
-    u32CalculatedCRC = u32SSE_Crc32Dir((U8 *) &cDiagDsmAlData,
-        (U32) DIAG_DSM_SIMPLE_RC_BUFF_LEN,
-        (U32) 0,
-        SSE_CRC32_CCITT_POLY);
-
-    // Update cDiagDsmAlData struct with the CRC
-    cDiagDsmAlData.u32DsmAlSimpleRCDataCRC = u32CalculatedCRC;
-    u32BuffLength = (U32) (DIAG_DSM_SIMPLE_RC_BUFF_LEN +
-        sizeof(cDiagDsmAlData.u32DsmAlSimpleRCDataCRC));
-
-    // Write cDiagDsmAlData struct in Non Volatile Memory
-    s16Ret = s16NVM_WriteData(NVM_DEVICE_ID0,  // Device ID for accessing NVM
-        DSM_POFF_USR_AREA_ID,
-        eNVM_BLOCKING_MODE,
-        &eStatus, 0,
-        (U8*) (void*) &cDiagDsmAlData,
-        (U32) u32BuffLength);
+    boSimpleRCChanged = ( (boDiagDsmAlSimpleRCAllDirty == TRUE) ||
+                          (u16DiagDsmAlDirtyFirst <= u16DiagDsmAlDirtyLast) ) ? TRUE : FALSE;
 
-    // Check result
-    if (s16Ret == KB_RET_OK)
+    if (boSimpleRCChanged == TRUE)
     {
-        // No error
-        s16Ret = CO_ERROR_NONE;
+        // Calculate CRC over Diag DSM DsmNvMemFormatVer and Simple Root cause data
+        u32CalculatedCRC = u32SSE_Crc32Dir((U8 *) &cDiagDsmAlData,
+            (U32) DIAG_DSM_SIMPLE_RC_BUFF_LEN,
+            (U32) 0,
+            SSE_CRC32_CCITT_POLY);
+
+        // Update cDiagDsmAlData struct with the CRC
+        cDiagDsmAlData.u32DsmAlSimpleRCDataCRC = u32CalculatedCRC;
     }
-    else
+
+    // Written only if something changed in this cycle
+    if ((boSimpleRCChanged == TRUE) || (boDiagDsmAlDetailRCChanged == TRUE))
     {
-        // An error has occurred, set internal error
-        s16Ret = CO_ERROR_INTERNAL;
+        // Write changed Simple Root cause entries and, if changed during the update, Detail Root cause data
+        s16Ret = s16DiagDsmAlNvMem_Write(boSimpleRCChanged, boDiagDsmAlDetailRCChanged);
     }
 
+    // Data not written stays changed and is written by the next update
+    if (s16Ret == CO_ERROR_NONE)
+    {
+        boDiagDsmAlSimpleRCAllDirty = FALSE;
+        u16DiagDsmAlDirtyFirst = C_DIAG_DSM_MAX_NR_STATEOBJECTS;
+        u16DiagDsmAlDirtyLast = 0;
+        boDiagDsmAlDetailRCChanged = FALSE;
+    }
+
+    boDiagDsmAlUpdateActive = FALSE;
+
     // Return result
     return( s16Ret );
 }
@@ -300,17 +335,37 @@ S16 s16DiagDsmAlNvMem_UpdateSingleE(const U16 u16Index,
 //************************************************ Function scope data *************************************************
 
     S16 s16Ret;    // Function return variable
+    C_DIAG_DSMAL_SIMPLE_RC_DATA* pcEntry;    // Entry selected by the index
 
 //*************************************************** Function code ****************************************************
     // Check index range
     if( u16Index < C_DIAG_DSM_MAX_NR_STATEOBJECTS )
     {
-        // Update the entry selected by the index with the values passed by function parameters:
-        // simple state value, degradation state value and simple root cause
-        cDiagDsmAlData.acDiagDsmAlSimpleRCData[u16Index].u8SimpleStateValue = (U8)eSimpleStateValue;
-        cDiagDsmAlData.acDiagDsmAlSimpleRCData[u16Index].u8DegradationStateValue = (U8)eDegradationStateValue;
-        cDiagDsmAlData.acDiagDsmAlSimpleRCData[u16Index].u8SimpleRootCause = (U8)cSimpleRootCause;
-        cDiagDsmAlData.acDiagDsmAlSimpleRCData[u16Index].u8Reserved = 0; // set reserved field at zero
+        pcEntry = &cDiagDsmAlData.acDiagDsmAlSimpleRCData[u16Index];
+
+        // Only a changed entry has to be written and enters the CRC update
+        if( (pcEntry->u8SimpleStateValue != ((U8)eSimpleStateValue & 0x01U)) ||
+            (pcEntry->u8DegradationStateValue != ((U8)eDegradationStateValue & 0x01U)) ||
+            (pcEntry->u8SimpleRootCause != ((U8)cSimpleRootCause & 0x1FU)) ||
+            (pcEntry->u8Reserved != 0U) )
+        {
+            // Update the entry selected by the index with the values passed by function parameters:
+            // simple state value, degradation state value and simple root cause
+            pcEntry->u8SimpleStateValue = (U8)eSimpleStateValue;
+            pcEntry->u8DegradationStateValue = (U8)eDegradationStateValue;
+            pcEntry->u8SimpleRootCause = (U8)cSimpleRootCause;
+            pcEntry->u8Reserved = 0; // set reserved field at zero
+
+            // Extend the changed range
+            if( u16Index < u16DiagDsmAlDirtyFirst )
+            {
+                u16DiagDsmAlDirtyFirst = u16Index;
+            }
+            if( u16Index > u16DiagDsmAlDirtyLast )
+            {
+                u16DiagDsmAlDirtyLast = u16Index;
+            }
+        }
         // Return OK
         s16Ret = CO_ERROR_NONE;
     }
@@ -363,6 +418,62 @@ S16 s16DiagDsmAlNvMem_GetSingleE(const U16 u16Index, E_DIAG_DSM_SIMPLE_STATE_VAL
 }
 //** EndOfFunction s16DiagDsmAlNvMem_GetSingleE ************************************************************************
 
+//**********************************************************************************************************************
+// Function s16DiagDsmAlNvMem_GetBulk
+//**********************************************************************************************************************
+S16 s16DiagDsmAlNvMem_GetBulk(const U16 u16First, const U16 u16Count, const U8* const pu8Select,
+    U8* const pu8Out, const U16 u16OutSize, U16* const pu16Next, U16* const pu16OutLen)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Ret;                                    // Function return variable
+    U16 u16Index;                                  // State object index
+    U16 u16End;                                    // End of the requested range
+    U16 u16Len = 0U;                               // Number of bytes written
+    const C_DIAG_DSMAL_SIMPLE_RC_DATA* pcEntry;    // Entry of the state object
+
+//*************************************************** Function code ****************************************************
+    // Check range and null pointer parameters, the selection is optional
+    if( (u16First <= C_DIAG_DSM_MAX_NR_STATEOBJECTS) && (u16Count <= (C_DIAG_DSM_MAX_NR_STATEOBJECTS - u16First))
+        && (pu8Out != KB_NULL_PTR) && (pu16Next != KB_NULL_PTR) && (pu16OutLen != KB_NULL_PTR) )
+    {
+        u16End = (U16)(u16First + u16Count);
+
+        // One byte per selected state object until the range or the output buffer ends
+        for( u16Index = u16First; (u16Index < u16End) && (u16Len < u16OutSize); u16Index++ )
+        {
+            if( (pu8Select == KB_NULL_PTR) || ((pu8Select[u16Index / 8U] & (U8)(1U << (u16Index % 8U))) != 0U) )
+            {
+                pcEntry = &cDiagDsmAlData.acDiagDsmAlSimpleRCData[u16Index];
+                pu8Out[u16Len] = (U8)(((U8)pcEntry->u8SimpleStateValue << DIAG_DSM_AL_BULK_SIMPLE_SHIFT) |
+                                      ((U8)pcEntry->u8DegradationStateValue << DIAG_DSM_AL_BULK_DEGR_SHIFT) |
+                                      ((U8)pcEntry->u8SimpleRootCause << DIAG_DSM_AL_BULK_RC_SHIFT));
+                u16Len++;
+            }
+        }
+
+        // Objects not selected behind the last copied one need not be examined again by the next call
+        while( (pu8Select != KB_NULL_PTR) && (u16Index < u16End) &&
+               ((pu8Select[u16Index / 8U] & (U8)(1U << (u16Index % 8U))) == 0U) )
+        {
+            u16Index++;
+        }
+
+        *pu16Next = u16Index;
+        *pu16OutLen = u16Len;
+        s16Ret = CO_ERROR_NONE;
+    }
+    else
+    {
+        // Range exceeds the state objects or null pointer parameter
+        // Set argument error
+        s16Ret = CO_ERROR_ARG;
+    }
+
+    // Return result
+    return s16Ret;
+}
+//** EndOfFunction s16DiagDsmAlNvMem_GetBulk ***************************************************************************
+
 //**********************************************************************************************************************
 // Function s16DiagDsmAlNvMem_GetDtldRcTbl
 //**********************************************************************************************************************
@@ -410,10 +521,6 @@ S16 s16DiagDsmAlNvMem_SetDtldRcTbl(T_DIAG_DSM_DTLDRC_NVMEM_DATA_BUFFER* const pc
 //************************************************ Function scope data *************************************************
     S16  s16Ret;                  // function return variable
     U32  u32CalculatedCRC = 0;    // local variable for CRC
-    U32  u32BuffLength;           // local variable for buffer length in bytes
-    U32  u32PoffBuffAddress;      // local variable for offset in area, to write data, in bytes
-    U32* pu32DiagDsmDetailRCData = cDiagDsmAlData.au32DsmAlDetailRC; // pointer to detailed root cause structure
-    E_NVM_OPERATION_STATUS eStatus = eNVM_STATUS_OPERATION_INIT;     // local variable for operation status
 
 //*************************************************** Function code ****************************************************
 
@@ -438,31 +545,17 @@ S16 s16DiagDsmAlNvMem_SetDtldRcTbl(T_DIAG_DSM_DTLDRC_NVMEM_DATA_BUFFER* const pc
 
             // Write CRC to cDiagDsmAlData
             cDiagDsmAlData.u32DsmAlDetailRCDataCRC = u32CalculatedCRC;
-            // Compute buffer len and offset in area, to write data, in bytes
-            // to write detailed root cause CRC in the non volatile memory
-            u32BuffLength = DIAG_DSM_DETAIL_RC_BUFF_LEN + sizeof(cDiagDsmAlData.u32DsmAlDetailRCDataCRC);
-            u32PoffBuffAddress = (U32)(DIAG_DSM_SIMPLE_RC_BUFF_LEN + sizeof(cDiagDsmAlData.u32DsmAlSimpleRCDataCRC));
-
-            // Write data to the non volatile memory
-            s16Ret = s16NVM_WriteData(NVM_DEVICE_ID0,  // Device ID for accessing NVM
-                DSM_POFF_USR_AREA_ID,
-                eNVM_BLOCKING_MODE,
-                &eStatus,
-                u32PoffBuffAddress,
-                (U8*) (void*) pu32DiagDsmDetailRCData,
-                (U32) u32BuffLength);
-
-            // Check result of the write in the non volatile memory
-            // and set function return value
-            if (s16Ret == KB_RET_OK)
+
+            if (boDiagDsmAlUpdateActive == TRUE)
             {
-                // data wrote with success, return ok
+                // Written together with the Simple Root cause data by s16DiagDsmAlNvMem_FinishUpdate
+                boDiagDsmAlDetailRCChanged = TRUE;
                 s16Ret = CO_ERROR_NONE;
             }
             else
             {
-                // an error has occurred, return internal error
-                s16Ret = CO_ERROR_INTERNAL;
+                // Write data to the non volatile memory
+                s16Ret = s16DiagDsmAlNvMem_Write(FALSE, TRUE);
             }
         }
     }
@@ -476,5 +569,161 @@ S16 s16DiagDsmAlNvMem_SetDtldRcTbl(T_DIAG_DSM_DTLDRC_NVMEM_DATA_BUFFER* const pc
 }
 //** EndOfFunction s16DiagDsmAlNvMem_SetDtldRcTbl **********************************************************************
 
+// Function s16DiagDsmAlNvMem_Write
+//**********************************************************************************************************************
+//! @brief          Writes the Simple and/or Detail Root cause data with their CRCs. If both parts are written, they
+//!                 are written in one NVM transaction, so a reset can not leave the non volatile memory with one
+//!                 part updated and the other one not.
+//!
+//! @return         CO_ERROR_NONE on success, CO_ERROR_INTERNAL on errors
+//!
+//! @remarks        The transaction journal costs blocking FRAM writes, so a single part is written directly to the
+//!                 POFF area as before; an interrupted single part write is found by the startup CRC check.
+//!                 A staging error aborts the transaction without writing.
+//!                 With a transaction the DSM update of the 200ms cycle (DIAG_DSM_OPERATION_CYC) waits for the FRAM
+//!                 writes of the journal: the staged parts, the header and the clear, up to NVM_TXN_JRNL_SIZE bytes
+//!                 (about 1.7 ms at a FRAM SPI clock of 10 MHz, see nvm_txn.h).
+//**********************************************************************************************************************
+static S16 s16DiagDsmAlNvMem_Write(const BOOLEAN boSimpleRC, const BOOLEAN boDetailRC)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Ret = KB_RET_OK;  // Function return variable
+    BOOLEAN boTxn;           // Both parts are written in one transaction
+    BOOLEAN boTxnOpen = FALSE; // Transaction opened by this call
+    U32 u32Start;            // Start of the changed Simple Root cause entries in the non volatile memory
+    U32 u32End;              // End of the changed Simple Root cause entries in the non volatile memory
+
+//*************************************************** Function code ****************************************************
+    boTxn = ((boSimpleRC == TRUE) && (boDetailRC == TRUE)) ? TRUE : FALSE;
+
+    if (boTxn == TRUE)
+    {
+        s16Ret = s16NVM_TxnBegin();
+        boTxnOpen = (s16Ret == KB_RET_OK) ? TRUE : FALSE;
+    }
+
+    if ((s16Ret == KB_RET_OK) && (boSimpleRC == TRUE) && (boDiagDsmAlSimpleRCAllDirty == TRUE))
+    {
+        // DsmNvMemFormatVer, Simple Root cause data and CRC
+        s16Ret = s16DiagDsmAlNvMem_WritePart(boTxn,
+            0,
+            (U8*) (void*) &cDiagDsmAlData,
+            (U32) DIAG_DSM_SIMPLE_RC_WRITE_LEN);
+    }
+    else if ((s16Ret == KB_RET_OK) && (boSimpleRC == TRUE))
+    {
+        // Changed entries, widened to U32 transfers inside the Simple Root cause data
+        u32Start = (U32) DIAG_DSM_SIMPLE_RC_MEM_FORMAT_VER_LEN +
+                   ((U32) u16DiagDsmAlDirtyFirst * (U32) sizeof(C_DIAG_DSMAL_SIMPLE_RC_DATA));
+        u32End = (U32) DIAG_DSM_SIMPLE_RC_MEM_FORMAT_VER_LEN +
+                 (((U32) u16DiagDsmAlDirtyLast + 1U) * (U32) sizeof(C_DIAG_DSMAL_SIMPLE_RC_DATA));
+        u32Start -= (u32Start % DIAG_DSM_NVMEM_ALIGN);
+        u32End += ((DIAG_DSM_NVMEM_ALIGN - (u32End % DIAG_DSM_NVMEM_ALIGN)) % DIAG_DSM_NVMEM_ALIGN);
+        if (u32End > DIAG_DSM_SIMPLE_RC_CRC_OFFSET)
+        {
+            u32End = DIAG_DSM_SIMPLE_RC_CRC_OFFSET;
+        }
+
+        s16Ret = s16DiagDsmAlNvMem_WritePart(boTxn,
+            u32Start,
+            ((U8*) (void*) &cDiagDsmAlData) + u32Start,
+            u32End - u32Start);
+
+        // CRC
+        if (s16Ret == KB_RET_OK)
+        {
+            s16Ret = s16DiagDsmAlNvMem_WritePart(boTxn,
+                DIAG_DSM_SIMPLE_RC_CRC_OFFSET,
+                (U8*) (void*) &cDiagDsmAlData.u32DsmAlSimpleRCDataCRC,
+                (U32) sizeof(cDiagDsmAlData.u32DsmAlSimpleRCDataCRC));
+        }
+    }
+    else
+    {
+        // Simple Root cause data unchanged
+    }
+
+    if ((s16Ret == KB_RET_OK) && (boDetailRC == TRUE))
+    {
+        // Detail Root cause data and CRC
+        s16Ret = s16DiagDsmAlNvMem_WritePart(boTxn,
+            (U32) DIAG_DSM_SIMPLE_RC_WRITE_LEN,
+            (U8*) (void*) cDiagDsmAlData.au32DsmAlDetailRC,
+            (U32) DIAG_DSM_DETAIL_RC_WRITE_LEN);
+    }
+
+    if ((boTxnOpen == TRUE) && (s16Ret == KB_RET_OK))
+    {
+        s16Ret = s16NVM_TxnCommit();
+    }
+    else if (boTxnOpen == TRUE)
+    {
+        // Staging failed, nothing is written
+        (void) s16NVM_TxnAbort();
+    }
+    else
+    {
+        // No transaction
+    }
+
+    // Check result
+    if (s16Ret == KB_RET_OK)
+    {
+        // No error
+        s16Ret = CO_ERROR_NONE;
+    }
+    else
+    {
+        // An error has occurred, set internal error
+        s16Ret = CO_ERROR_INTERNAL;
+    }
+
+    // Return result
+    return( s16Ret );
+}
+//** EndOfFunction s16DiagDsmAlNvMem_Write *****************************************************************************
+
+// Function s16DiagDsmAlNvMem_WritePart
+//**********************************************************************************************************************
+//! @brief          Stages a part of the DSM data in the open NVM transaction or writes it directly (blocking).
+//!
+//! @param[in]      boTxn     : TRUE stages the part in the open transaction
+//! @param[in]      u32Offset : Offset in the DSM POFF area
+//! @param[in]      pu8Data   : Data of the part
+//! @param[in]      u32Len    : Length of the part in bytes
+//!
+//! @return         KB_RET_OK on success, error code of s16NVM_TxnStage or s16NVM_WriteData otherwise
+//!
+//! @remarks        -
+//**********************************************************************************************************************
+static S16 s16DiagDsmAlNvMem_WritePart(const BOOLEAN boTxn, const U32 u32Offset, U8* const pu8Data,
+                                       const U32 u32Len)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Ret;    // Function return variable
+    E_NVM_OPERATION_STATUS eStatus = eNVM_STATUS_OPERATION_INIT;    // Local variable for operation status
+
+//*************************************************** Function code ****************************************************
+    if (boTxn == TRUE)
+    {
+        s16Ret = s16NVM_TxnStage(NVM_DEVICE_ID0, DSM_POFF_USR_AREA_ID, u32Offset, pu8Data, u32Len);
+    }
+    else
+    {
+        // Write data to the non volatile memory
+        s16Ret = s16NVM_WriteData(NVM_DEVICE_ID0,  // Device ID for accessing NVM
+            DSM_POFF_USR_AREA_ID,
+            eNVM_BLOCKING_MODE,
+            &eStatus,
+            u32Offset,
+            pu8Data,
+            u32Len);
+    }
+
+    // Return result
+    return( s16Ret );
+}
+//** EndOfFunction s16DiagDsmAlNvMem_WritePart *************************************************************************
+
 
 //** EndOfFile FwkAlDiagDsmNvMem.c *************************************************************************************
@@ -34,6 +34,9 @@
 // 2022-03-09   A. Mauro    TC_004-13662: Modified NVM_FWK_AREA_SIZE1_2 0x4800->0xA080
 // 2023-01-09   J. Lulli    Coding guidelines alignment
 // 2023-11-28   C. Brancolini Lint Plus cleanup
+// 2026-10-19   agent       Device-2 spare area reduced to the logical size of the flash log store: 0x8000->0x2000
+// 2026-10-19   agent       Area offsets and tables generated from the NVM layout (nvm_layout_i.h)
+// 2026-10-19   agent       Scrubbed areas (acNVM_USR_ScrubArea)
 //
 //**********************************************************************************************************************
 //! NOTE: USAGE OF AREA_ID MACRO
@@ -91,6 +94,8 @@
 #include "ladc_flash.h"                                  // LAD configuration area declarations
 #include "FwkAlDrcNvMem.h"
 #include "nvm_i.h"
+#include "nvm_layout_i.h"                                // Layout of the NVM devices
+#include "nvm_scrub.h"                                   // Background scrubber
 
 //**************************************** Constant / macro definitions ( #define ) ************************************
 //! No.of devices configured in CDO table
@@ -99,7 +104,7 @@
 //! Configuration version needs to be updated, once there is modification in 'acNVM_USR_Device_x'
 #define NVM_USR_CFG_VERS_DEV_0          ((U8) 0x01)      //!< Version of APP's NVM configuration for Device-0
 #define NVM_USR_CFG_VERS_DEV_1          ((U8) 0x01)      //!< Version of APP's NVM configuration for Device-1
-#define NVM_USR_CFG_VERS_DEV_2          ((U8) 0x01)      //!< Version of APP's NVM configuration for Device-2
+#define NVM_USR_CFG_VERS_DEV_2          ((U8) 0x02)      //!< Version of APP's NVM configuration for Device-2
 
 //----------------------------------------------------------------------------------------------------------------------
 //! APP area definitions of Device_0, i.e. POFF Device
@@ -118,12 +123,7 @@
 #define NVM_POFF_FWK_AREA_SIZE_DFM          ((U32) 340)
 #define NVM_POFF_FWK_AREA_SIZE_DRC          ((U32) 32)
 
-//! Area offset of APP for Device_0
-#define NVM_USR_AREA_OFFSET0_0              ((U32) 0x0000)  //!< Device-0, First area offset
-#define NVM_USR_AREA_OFFSET0_1              ((U32) (NVM_USR_AREA_OFFSET0_0 + NVM_POFF_FWK_AREA_SIZE_DSM))
-#define NVM_USR_AREA_OFFSET0_2              ((U32) (NVM_USR_AREA_OFFSET0_1 + NVM_POFF_FWK_AREA_SIZE_MAMO))
-#define NVM_USR_AREA_OFFSET0_3              ((U32) (NVM_USR_AREA_OFFSET0_2 + NVM_POFF_FWK_AREA_SIZE_RTC))
-#define NVM_USR_AREA_OFFSET0_4              ((U32) (NVM_USR_AREA_OFFSET0_3 + NVM_POFF_FWK_AREA_SIZE_DFM))
+//! Area offsets of APP for Device_0: NVM_LAYOUT_DEV0_APP (nvm_layout_i.h)
 // End of Device_0 Definitions------------------------------------------------------------------------------------------
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -135,17 +135,7 @@
 #define NVM_FWK_AREA_ID1_2                  ((U8) 0x02)     //!< Device-1, Area-2 :  FWK DFM NON POFF
 #define NVM_USR_AREA_ID1_SPARE              ((U8) 0x03)     //!< Spare or Free space
 
-//! Area sizes of APP for Device_1
-#define NVM_USR_AREA_SIZE1_0                ((U32) 0x0020)  //!< Device-1, First area size-32 bytes
-#define NVM_FWK_AREA_SIZE1_1                ((U32) 0x0200)  //!< Device-1, FWK area size-512 bytes
-#define NVM_FWK_AREA_SIZE1_2                ((U32) 0xA080)  //!< Device-1, DFM area size-41088 bytes
-#define NVM_USR_AREA_SIZE1_SPARE            ((U32) 0xC0)    //!< Device-1, Free space
-
-//! Area offset of APP for Device_1
-#define NVM_USR_AREA_OFFSET1_0              ((U32) 0x0000)  //!< Device-0, First area offset
-#define NVM_FWK_AREA_OFFSET1_1              ((U32) (NVM_USR_AREA_OFFSET1_0 + NVM_USR_AREA_SIZE1_0))
-#define NVM_FWK_AREA_OFFSET1_2              ((U32) (NVM_FWK_AREA_OFFSET1_1 + NVM_FWK_AREA_SIZE1_1))
-#define NVM_FWK_AREA_OFFSET1_SPARE          ((U32) (NVM_FWK_AREA_OFFSET1_2 + NVM_FWK_AREA_SIZE1_2))
+//! Area sizes and offsets of APP for Device_1: NVM_LAYOUT_DEV1_APP (nvm_layout_i.h)
 
 // End of Device_1 Definitions----------------------------------------------------------------------------------------
 
@@ -159,23 +149,42 @@
 #define NVM_USR_AREA_ID2_0                  ((U8) 0x00)     //!< Device-2, Area-0 : LADC Flash
 #define NVM_USR_AREA_ID2_SPARE              ((U8) 0x01)     //!< Device-2, Spare Area
 
-//! Area size of APP for Device_2
-#define NVM_USR_AREA_SIZE2_0                ((U32) 0x4000)  //!< Device-2, First area size
-#define NVM_USR_AREA_SIZE2_SPARE            ((U32) 0x8000)  //!< Device-2, Spare area size
-
-//! Area offset of APP for Device_2
-#define NVM_USR_AREA_OFFSET2_0              ((U32) 0x0000)  //!< Device-2, First area offset
-#define NVM_USR_AREA_OFFSET2_SPARE          ((U32) NVM_USR_AREA_OFFSET2_0 + NVM_USR_AREA_SIZE2_0)  //!< Test
+//! Area sizes and offsets of APP for Device_2: NVM_LAYOUT_DEV2_APP (nvm_layout_i.h)
 
 // End of Device_2 Configuration----------------------------------------------------------------------------------------
 
 //! Reserved byte for structure alignment in CDO table
 #define RES_BYTE                        ((U8) 0x00)
 
+//! Table entry of an APP area
+#define NVM_USR_LAYOUT_ROW(L, Name, Id, Size, Align) \
+    { (Id), RES_BYTE, RES_BYTE, RES_BYTE, NVM_LAYOUT_OFFSET(L, Name), (Size) },
+
+//! Device and device offset of the APP areas, for the scrubber
+#define NVM_USR_SCRUB_DEV_DEV1_APP      NVM_DEVICE_ID1
+#define NVM_USR_SCRUB_DEV_DEV2_APP      NVM_DEVICE_ID2
+#define NVM_USR_SCRUB_BASE_DEV1_APP     ((U32)(NVM_LAYOUT_OFFSET(DEV1_HAL, RES) + NVM_LAYOUT_OFFSET(DEV1_SVL, RES_APP)))
+#define NVM_USR_SCRUB_BASE_DEV2_APP     ((U32)(NVM_LAYOUT_OFFSET(DEV2_HAL, RES) + NVM_LAYOUT_OFFSET(DEV2_SVL, RES_APP)))
+
+//! Table entry of a scrubbed APP area
+#define NVM_USR_SCRUB_ROW(L, Name, Id, Size, Align) \
+    { NVM_USR_SCRUB_DEV_##L, (Id), NVM_USR_SCRUB_BASE_##L + NVM_LAYOUT_OFFSET(L, Name), (Size) },
+
 //**************************************** Type definitions ( typedef ) ************************************************
 //! Number of elements available in CDO_NVM_USR_CFG_TABLE
 TYPEDEF_CDO_NVM_APP_CFG_TABLE (APP, NVM_USR_NUM_OF_CONFIG_DEVICES); // @suppress("Wrong derived data type") // @suppress("Wrong prefix")
 
+//! APP areas, checked against the SVL reserved areas
+NVM_LAYOUT_DEFINE(DEV0_APP)
+NVM_LAYOUT_DEFINE(DEV1_APP)
+NVM_LAYOUT_DEFINE(DEV2_APP)
+
+//! Lower layers, for the device offsets of the APP areas
+NVM_LAYOUT_TYPE(DEV1_HAL)
+NVM_LAYOUT_TYPE(DEV1_SVL)
+NVM_LAYOUT_TYPE(DEV2_HAL)
+NVM_LAYOUT_TYPE(DEV2_SVL)
+
 //**************************************** Global data definitions *****************************************************
 
 //**************************************** Global constant definitions ( const ) ***************************************
@@ -185,30 +194,19 @@ TYPEDEF_CDO_NVM_APP_CFG_TABLE (APP, NVM_USR_NUM_OF_CONFIG_DEVICES); // @suppress
 //! Note: Please add 'AreaID' in sequential manner like 0,1,2...Don't give random numbers
 static const C_NVM_USR_DEVICE_AREAS acNVM_USR_Device_0[] =
 {
-    // Area ID,                       Area Offset,                  Area Size
-    { NVM_POFF_FWK_AREA_ID_DSM,  RES_BYTE, RES_BYTE, RES_BYTE, NVM_USR_AREA_OFFSET0_0, NVM_POFF_FWK_AREA_SIZE_DSM  },
-    { NVM_POFF_FWK_AREA_ID_MAMO, RES_BYTE, RES_BYTE, RES_BYTE, NVM_USR_AREA_OFFSET0_1, NVM_POFF_FWK_AREA_SIZE_MAMO },
-    { NVM_POFF_FWK_AREA_ID_RTC,  RES_BYTE, RES_BYTE, RES_BYTE, NVM_USR_AREA_OFFSET0_2, NVM_POFF_FWK_AREA_SIZE_RTC  },
-    { NVM_POFF_FWK_AREA_ID_DFM,  RES_BYTE, RES_BYTE, RES_BYTE, NVM_USR_AREA_OFFSET0_3, NVM_POFF_FWK_AREA_SIZE_DFM  },
-    { NVM_POFF_FWK_AREA_ID_DRC,  RES_BYTE, RES_BYTE, RES_BYTE, NVM_USR_AREA_OFFSET0_4, NVM_POFF_FWK_AREA_SIZE_DRC  }
+    NVM_LAYOUT_DEV0_APP(NVM_USR_LAYOUT_ROW)
 };
 
 //! APP area configuration for FRAM
 static const C_NVM_USR_DEVICE_AREAS acNVM_USR_Device_1[] =
 {
-    // AreaID,                                                AreaOffset,                 AreaSize
-    { NVM_USR_AREA_ID1_0,       RES_BYTE, RES_BYTE, RES_BYTE, NVM_USR_AREA_OFFSET1_0,     NVM_USR_AREA_SIZE1_0     },
-    { NVM_FWK_AREA_ID1_1,       RES_BYTE, RES_BYTE, RES_BYTE, NVM_FWK_AREA_OFFSET1_1,     NVM_FWK_AREA_SIZE1_1     },
-    { NVM_FWK_AREA_ID1_2,       RES_BYTE, RES_BYTE, RES_BYTE, NVM_FWK_AREA_OFFSET1_2,     NVM_FWK_AREA_SIZE1_2     },
-    { NVM_USR_AREA_ID1_SPARE,   RES_BYTE, RES_BYTE, RES_BYTE, NVM_FWK_AREA_OFFSET1_SPARE, NVM_USR_AREA_SIZE1_SPARE }
+    NVM_LAYOUT_DEV1_APP(NVM_USR_LAYOUT_ROW)
 };
 
 //! APP area configuration for FLASH
 static const C_NVM_USR_DEVICE_AREAS acNVM_USR_Device_2[] =
 {
-    // Area ID,                      Area Offset,                  Area Size
-    { NVM_USR_AREA_ID2_0,       RES_BYTE, RES_BYTE, RES_BYTE, NVM_USR_AREA_OFFSET2_0,     NVM_USR_AREA_SIZE2_0      },
-    { NVM_USR_AREA_ID2_SPARE,   RES_BYTE, RES_BYTE, RES_BYTE, NVM_USR_AREA_OFFSET2_SPARE, NVM_USR_AREA_SIZE2_SPARE  }
+    NVM_LAYOUT_DEV2_APP(NVM_USR_LAYOUT_ROW)
 };
 
 
@@ -264,7 +262,7 @@ const U32 u32NVM_FlashErasePattern = NVM_FLASH_ERASE_PATTERN;
 
 //! Set Area ID & AreaOffset of LADCFG for it's usage
 LADC_NVM_USR_AREA_ID_SET     ( NVM_USR_AREA_ID2_0 )
-LADC_NVM_USR_AREA_OFFSET_SET ( NVM_USR_AREA_OFFSET2_0 )
+LADC_NVM_USR_AREA_OFFSET_SET ( NVM_LAYOUT_OFFSET(DEV2_APP, LADC) )
 
 //----------------------------------------------------------------------------------------------------------------------
 //! Framework area id definitions
@@ -293,6 +291,18 @@ DRC_POFF_USR_AREA_ID_SET ( NVM_POFF_FWK_AREA_ID_DRC )
 DFM_NVM_FWK_AREA_ID_SET  ( NVM_FWK_AREA_ID1_2 )
 //----------------------------------------------------------------------------------------------------------------------
 
+//! Areas checked by the background scrubber: all APP areas of FRAM and flash.
+//! POFF areas (Device_0) are RAM and written continuously, they are not scrubbed.
+const C_NVM_SCRUB_AREA acNVM_USR_ScrubArea[] =
+{
+    NVM_LAYOUT_DEV1_APP(NVM_USR_SCRUB_ROW)
+    NVM_LAYOUT_DEV2_APP(NVM_USR_SCRUB_ROW)
+};
+
+//! Number of scrubbed areas
+const U8 u8NVM_USR_ScrubAreaCnt = (U8)(sizeof(acNVM_USR_ScrubArea) / sizeof(C_NVM_SCRUB_AREA));
+NVM_LAYOUT_CHECK(SCRUB_AREAS, (sizeof(acNVM_USR_ScrubArea) / sizeof(C_NVM_SCRUB_AREA)) <= NVM_SCRUB_MAX_AREAS)
+
 //**************************************** Module global data segment ( static ) ***************************************
 
 //**************************************** Module global constants ( static const ) ************************************
@@ -0,0 +1,71 @@
+//**********************************************************************************************************************
+//
+//                                                   crc32_sl.h
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date 2026-10-19
+//! @author agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file crc32_sl.h
+//! @brief CRC32 - Table driven CRC32 (slice-by-4 / slice-by-8).
+//!
+//!        Polynomial 0x04C11DB7, most significant bit first, no final XOR. The CRC register is passed in and returned,
+//!        so a calculation over several buffers continues where the previous one stopped; start value 0.
+//!        The slice-by-8 variant processes 8 bytes per step with 8 tables of 1 kB each; the slice-by-4 variant needs
+//!        half the table memory. The tables are read only. With CRC32_CFG_TAB_SECTION they are placed in the section
+//!        ".crc32tab", which the linker file can map into fast memory.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+//
+//**********************************************************************************************************************
+
+#ifndef CRC32_SL_H
+#define CRC32_SL_H
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "kb_types.h"                                           // Standard definitions
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Bytes processed per step, 4 or 8. Can be set by the build.
+#ifndef CRC32_SLICE_BY
+#define CRC32_SLICE_BY                   8U
+#endif
+
+//! Start value of a calculation
+#define CRC32_START                      ((U32) 0)
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data declarations ( extern ) *****************************************
+
+//**************************************** External parameter / constant declarations ( extern const )	****************
+
+//**************************************** Global func/proc prototypes *************************************************
+
+//* Function u32CRC32_Update *******************************************************************************************
+//!
+//! @brief      Continues a CRC calculation over a buffer. No alignment requirements.
+//!
+//! @param[in]  u32Crc    : CRC of the preceding data, CRC32_START for the first buffer
+//! @param[in]  pu8Data   : Data
+//! @param[in]  u32Length : Number of bytes
+//!
+//! @return     CRC of the preceding data followed by the buffer.
+//!
+//**********************************************************************************************************************
+extern U32 u32CRC32_Update (U32 u32Crc, const U8* pu8Data, U32 u32Length);
+
+#endif // CRC32_SL_H
+
+// EndOfFile crc32_sl.h ************************************************************************************************
@@ -0,0 +1,108 @@
+//**********************************************************************************************************************
+//
+//                                                   fim_dedup.h
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date 2026-10-19
+//! @author agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file fim_dedup.h
+//! @brief FIM - Deduplication of the fault reports of the SVL monitors.
+//!
+//!        The monitors report the state of their faults every test cycle, also while it does not change. The
+//!        functions of this file keep the last forwarded state per fault code and forward a report to FIM only if
+//!        the state changes, so FIM and DSM do not process a persistent fault again every cycle.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+// 2026-10-19   agent          FIM_DEDUP_REFRESH_CNT 1000->8
+// 2026-10-19   agent          Forwarding of every 9th repeat by FIM_DEDUP_REFRESH_CNT documented
+//
+//**********************************************************************************************************************
+
+#ifndef FIM_DEDUP_H
+#define FIM_DEDUP_H
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "kb_types.h"                                           // Standard definitions
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Number of fault codes (U8)
+#define FIM_DEDUP_CODES                  ((U16) 256)
+
+//! A repeated report is forwarded anyway after this number of suppressed repeats, so faults cleared outside the
+//! monitors (e.g. master clear by SDI) are reported again within a few test cycles.
+//! With 8 every 9th repeat of an unchanged state is forwarded: the reports to FIM of a persistent fault are reduced
+//! to 1/9, not to the changes only. This deviates from a forward on change on purpose, FIM has no notification of
+//! a master clear which would allow to forward the next report.
+#define FIM_DEDUP_REFRESH_CNT            ((U16) 8)
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data declarations ( extern ) *****************************************
+
+//**************************************** External parameter / constant declarations ( extern const )	****************
+
+//**************************************** Global func/proc prototypes *************************************************
+
+//* Function s16FIM_DedupSetFault **************************************************************************************
+//!
+//! @brief      Reports a fault as set. Forwarded to s16FIM_SetFault() if the last forwarded state of the fault code
+//!             or its service ID differs or FIM_DEDUP_REFRESH_CNT repeats were suppressed.
+//!
+//! @param[in]  u8FaultCode : Fault code
+//! @param[in]  u8SrvID     : Service identifier of the monitor
+//!
+//! @return     Result of s16FIM_SetFault() if forwarded, KB_RET_OK for a suppressed repeat.
+//!
+//**********************************************************************************************************************
+extern S16 s16FIM_DedupSetFault (U8 u8FaultCode, U8 u8SrvID);
+
+//* Function s16FIM_DedupResetFault ************************************************************************************
+//!
+//! @brief      Reports a fault as reset. Forwarded to s16FIM_ResetFault() like s16FIM_DedupSetFault().
+//!
+//! @param[in]  u8FaultCode : Fault code
+//! @param[in]  u8SrvID     : Service identifier of the monitor
+//!
+//! @return     Result of s16FIM_ResetFault() if forwarded, KB_RET_OK for a suppressed repeat.
+//!
+//**********************************************************************************************************************
+extern S16 s16FIM_DedupResetFault (U8 u8FaultCode, U8 u8SrvID);
+
+//* Function s16FIM_DedupSetToUnknownFault *****************************************************************************
+//!
+//! @brief      Reports a fault as unknown. Forwarded to s16FIM_SetToUnknownFault() like s16FIM_DedupSetFault().
+//!
+//! @param[in]  u8FaultCode : Fault code
+//! @param[in]  u8SrvID     : Service identifier of the monitor
+//!
+//! @return     Result of s16FIM_SetToUnknownFault() if forwarded, KB_RET_OK for a suppressed repeat.
+//!
+//**********************************************************************************************************************
+extern S16 s16FIM_DedupSetToUnknownFault (U8 u8FaultCode, U8 u8SrvID);
+
+//* Function u32FIM_DedupGetSuppressed *********************************************************************************
+//!
+//! @brief      Returns the number of suppressed repeats.
+//!
+//! @param[in]  u16FaultCode : Fault code, FIM_DEDUP_CODES for the total of all fault codes
+//!
+//! @return     Number of suppressed repeats, wrapping around at 2^32, 0 for an invalid fault code.
+//!
+//**********************************************************************************************************************
+extern U32 u32FIM_DedupGetSuppressed (U16 u16FaultCode);
+
+#endif // FIM_DEDUP_H
+
+// EndOfFile fim_dedup.h ***********************************************************************************************
@@ -23,6 +23,7 @@
 // Date:           Author:             Revision / Changes:
 // 2023-09-13      A. Mauro            1.00 Start
 // 2023-12-04      C. Brancolini       Updated MON_SDI_CHANNEL_ERROR value, added MON_SHIFT_VAR_BY_8
+// 2026-10-19      agent               Added MON_SDI_PENDING
 //
 //**********************************************************************************************************************
 
@@ -46,6 +47,7 @@
 
 //! Define SDI common responses
 #define MON_SDI_NO_ERROR           ((U8)0)    //!< No error
+#define MON_SDI_PENDING            ((U8)1)    //!< Response deferred, repeat the command (mon_sdi_defer.h)
 #define MON_SDI_RANGE_ERROR        ((U8)2)    //!< addr range error
 #define MON_SDI_CHANNEL_ERROR      ((U8)3)    //!< channel error for comm
 
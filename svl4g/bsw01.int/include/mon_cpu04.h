@@ -76,6 +76,10 @@
 //  20.04.17     A. Mauro      2.0  / TC_007-96: LINT clean up
 //  2023.09.14   A. Mauro      2.1    Alignment with CA: name changed and other
 //  2023-12-20   C. Brancolini        Lint Plus clean up
+//  2026-10-19   agent                Added address ranges of the data acquisition and the memory dump (C_MON_RAM_AREA)
+//  2026-10-19   agent                Added users of the PWM acquisition stop (vMON_PwmDemodStop)
+//  2026-10-19   agent                Added boMON_PwmDemodStopped, duty cycle and frequency scaling shared by the
+//                                    MON commands and the subscription
 //
 //**********************************************************************************************************************
 
@@ -94,11 +98,19 @@
 // error codes for service terminal commands -------------------------------
 
 #define MON_ERR_PWM_WRITE    1
+// users stopping the PWM acquisition (TC_007-84) --------------------------
+#define MON_PWM_DEMOD_READ_FREQ   ((U8)0x01U)  // s16MON_ReadFreq
+#define MON_PWM_DEMOD_FREQ_DEFER  ((U8)0x02U)  // s16MON_ReadFreqDefer
+#define MON_PWM_DEMOD_SUB         ((U8)0x04U)  // subscription of frequency inputs (mon_sdi_sub.c)
 // Others ------------------------------------------------------------------
 #define MON_DAT            1U            // offset for request data
 #define MON_ACK            3U            // offset for acknowledge data
 
 #define MON_PWM_100PER      (U32)1000    // max value of PWM
+#define MON_DUTY_CYCLE_0PERC   (U32)1000 // PWM input duty cycle 0% (TC_007-98)
+#define MON_DUTY_CYCLE_100PERC (U32)0    // PWM input duty cycle 100% (TC_007-98)
+#define MON_FREQ_OFFSET     50U          // rounding of the frequency input value to Hz
+#define MON_FREQ_FACTOR     100U         // scaling of the frequency input value to Hz
 #define MON_SDI_PAR_OFFSET      (U8)2    // offset of parameters in request message
 
 #define MON_SDI_INDEX_1 1U
@@ -144,6 +156,13 @@ typedef union
 } C_WORD_BYTE;
 #pragma pack(0)                         // Set to default packing // @suppress("No #pragma instructions")
 
+// address range that can be read by the data acquisition and the memory dump (mon_sdi_daq.c, mon_sdi_dump.c)
+typedef struct
+{
+    const U8* pu8Start;                 // start address
+    U32 u32Size;                        // number of bytes
+} C_MON_RAM_AREA;
+
 //********************************** Global data declarations ( extern ) ***********************************************
 
 //********************** External parameter / constant declarations ( extern const ) ***********************************
@@ -153,6 +172,9 @@ extern void (*pvMON_Cycl1ms_GetPWDemod)(void);
 
 extern U8 u8MON_MaxFreqChnls;           // No. of freq chnls applicable for EB0xx
 
+extern const C_MON_RAM_AREA acMON_RamArea[]; // address ranges of the data acquisition and the memory dump
+extern const U8 u8MON_RamAreas;         // No. of address ranges of the data acquisition and the memory dump
+
 
 //*************************************** Global func/proc prototypes **************************************************
 
@@ -167,6 +189,32 @@ extern U8 u8MON_MaxFreqChnls;           // No. of freq chnls applicable for EB0x
 //**********************************************************************************************************************
 extern BOOLEAN boMON_ReadPWM(U8 u8Channel, U32* pu32DutyCycle, BOOLEAN* pboUPToDateBit);
 
+//* Function vMON_PwmDemodStop *****************************************************************************************
+//
+//!  Function  : Stops the PWM acquisition (TC_007-84) for a user, if present and not stopped already by another user
+//! @param[in] u8User: MON_PWM_DEMOD_xxx
+//! @returns    ---
+//! @remarks Every stop has to be followed by vMON_PwmDemodRestart of the same user
+//**********************************************************************************************************************
+extern void vMON_PwmDemodStop(U8 u8User);
+
+//* Function vMON_PwmDemodRestart **************************************************************************************
+//
+//!  Function  : Ends the stop of the PWM acquisition of a user, restarts it when no other user has stopped it
+//! @param[in] u8User: MON_PWM_DEMOD_xxx
+//! @returns    ---
+//! @remarks ---
+//**********************************************************************************************************************
+extern void vMON_PwmDemodRestart(U8 u8User);
+
+//* Function boMON_PwmDemodStopped *************************************************************************************
+//
+//!  Function  : Returns whether the PWM acquisition is stopped by a user
+//! @returns    TRUE if stopped: the PWM input values are not up to date
+//! @remarks ---
+//**********************************************************************************************************************
+extern BOOLEAN boMON_PwmDemodStopped(void);
+
 #endif
 
 //  EndOfFile mon_cpu04.h **********************************************************************************************
@@ -22,6 +22,16 @@
 // 29.05.2014     H. Shaikh     0.2  BC_002-814 added command length for PSDIO
 // 2023.09.28     A. Mauro      0.3    Alignment with CA: name changed and other
 // 2023-12-04     C. Brancolini Changed __MON_CPU04_GENRL_SDI_I_H__ in MON_CPU04_GENRL_SDI_I_H
+// 2026-10-19     agent         Commands for the NVM operation statistics added
+// 2026-10-19     agent         Command for the bulk read of the DSM states added
+// 2026-10-19     agent         Command for batches of MON commands added
+// 2026-10-19     agent         Commands for the subscription to IOS values added
+// 2026-10-19     agent         Commands for the data acquisition of internal variables added
+// 2026-10-19     agent         Commands for the memory dump added
+// 2026-10-19     agent         Command for the read of several binary IO ports added
+// 2026-10-19     agent         Command for the deferred read of the frequency inputs added
+// 2026-10-19     agent         Dispatching of the new commands by the MON library marked as TODO
+// 2026-10-19     agent         Command for the read of the suppressed fault reports added
 //
 //**********************************************************************************************************************
 
@@ -35,6 +45,10 @@
 
 //**********************************************************************************************************************
 //! @name Define General SDI commands
+//!
+//! The MON command table which dispatches a command ID to its handler is part of the MON library
+//! (s16MONProcessTCHMessage), not of this tree. Commands from MON_SDI_READ_NVM_STAT on are answered only after the
+//! MON library owner has added them to that table; the board integrator requests this with the MON library update.
 //**********************************************************************************************************************
 #define MON_SDI_READ_DIGIO_BYTE            12
 #define MON_SDI_WRITE_DIGIO_BYTE           13
@@ -46,6 +60,22 @@
 #define MON_SDI_WRITE_PSDIO                19
 #define MON_SDI_WRITE_ANALOG               20
 #define MON_SDI_READ_PWM                   21
+#define MON_SDI_READ_NVM_STAT              22
+#define MON_SDI_RESET_NVM_STAT             23
+#define MON_SDI_READ_DSM_STATE             24
+#define MON_SDI_BATCH                      25
+#define MON_SDI_SUBSCRIBE                  26
+#define MON_SDI_SUB_READ                   27
+#define MON_SDI_DAQ_ARM                    28
+#define MON_SDI_DAQ_STATE                  29
+#define MON_SDI_DAQ_READ                   30
+#define MON_SDI_DUMP_START                 31
+#define MON_SDI_DUMP_READ                  32
+#define MON_SDI_READ_DIGIO_PORTS           33
+#define MON_SDI_READ_FREQ_DEFER            34
+#define MON_SDI_READ_FIM_SUPPR             35
+//TODO: MON library update - s16MONProcessTCHMessage has to dispatch the commands 22 (MON_SDI_READ_NVM_STAT) to
+//      35 (MON_SDI_READ_FIM_SUPPR) to the handlers declared below; until then these commands are not answered
 
 
 //**********************************************************************************************************************
@@ -53,6 +83,19 @@
 //**********************************************************************************************************************
 #define MON_SDI_READ_PSDIO_LEN             3
 #define MON_SDI_WRITE_PSDIO_LEN            5
+#define MON_SDI_READ_NVM_STAT_LEN          3
+#define MON_SDI_RESET_NVM_STAT_LEN         1
+#define MON_SDI_READ_DSM_STATE_LEN         5     //!< Without the optional bitmap
+#define MON_SDI_BATCH_LEN                  2     //!< Without the commands
+#define MON_SDI_SUBSCRIBE_LEN              4     //!< Without the channels
+#define MON_SDI_SUB_READ_LEN               1
+#define MON_SDI_DAQ_ARM_LEN                12    //!< Without the variables
+#define MON_SDI_DAQ_STATE_LEN              1
+#define MON_SDI_DAQ_READ_LEN               3
+#define MON_SDI_DUMP_START_LEN             10
+#define MON_SDI_DUMP_READ_LEN              3
+#define MON_SDI_READ_DIGIO_PORTS_LEN       2
+#define MON_SDI_READ_FIM_SUPPR_LEN         3
 
 //**************************************** Type definitions ( typedef ) ************************************************
 
@@ -146,6 +189,24 @@ extern s16SDI_CMD(s16MON_WriteFreq);
 //**********************************************************************************************************************
 extern s16SDI_CMD(s16MON_ReadFreq);
 
+//* Function s16MON_ReadFreqDefer **************************************************************************************
+//*
+//!  This function processes the terminal command MON_SDI_READ_FREQ_DEFER, same command and response as
+//!  MON_SDI_READ_FREQ. The readings take about 40 ms, the response is deferred: the command is answered with
+//!  MON_SDI_PENDING and has to be repeated until the response with the frequencies is returned (mon_sdi_defer.h).
+//!  Not reachable yet: MON_SDI_READ_FREQ_DEFER is not in the command table of the MON library. Until it is,
+//!  MON_SDI_READ_FREQ with its busy wait is the only frequency read.
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[out] u16MaxRespOut : Max data to write to output
+//!  @returns    >= 0 : Size of response to terminal (data byte in pu8DataOut)\n
+//!              <0 : not used
+//!  @remarks    Only to be called by s16MONProcessTCHMessage
+//**********************************************************************************************************************
+extern s16SDI_CMD(s16MON_ReadFreqDefer);
+
 //* Function s16MON_WritePSDIO *****************************************************************************************
 //*
 //!  This function processes the terminal command MON_SDI_WRITE_PSDIO
@@ -174,6 +235,189 @@ extern s16SDI_CMD(s16MON_WritePSDIO);
 //**********************************************************************************************************************
 extern s16SDI_CMD(s16MON_ReadPSDIO);
 
+//* Function s16MON_ReadNvmStat ****************************************************************************************
+//*
+//!  This function processes the terminal command MON_SDI_READ_NVM_STAT
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[out] u16MaxRespOut : Max data to write to output
+//!  @returns    >= 0 : Size of response to terminal (data byte in pu8DataOut)\n
+//!              <0 : not used
+//!  @remarks    Only to be called by s16MONProcessTCHMessage
+//**********************************************************************************************************************
+extern s16SDI_CMD(s16MON_ReadNvmStat);
+
+//* Function s16MON_ResetNvmStat ***************************************************************************************
+//*
+//!  This function processes the terminal command MON_SDI_RESET_NVM_STAT
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[out] u16MaxRespOut : Max data to write to output
+//!  @returns    >= 0 : Size of response to terminal (data byte in pu8DataOut)\n
+//!              <0 : not used
+//!  @remarks    Only to be called by s16MONProcessTCHMessage
+//**********************************************************************************************************************
+extern s16SDI_CMD(s16MON_ResetNvmStat);
+
+//* Function s16MON_ReadFimSuppr ***************************************************************************************
+//*
+//!  This function processes the terminal command MON_SDI_READ_FIM_SUPPR (fault reports suppressed by fim_dedup.h)
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[out] u16MaxRespOut : Max data to write to output
+//!  @returns    >= 0 : Size of response to terminal (data byte in pu8DataOut)\n
+//!              <0 : not used
+//!  @remarks    Only to be called by s16MONProcessTCHMessage
+//**********************************************************************************************************************
+extern s16SDI_CMD(s16MON_ReadFimSuppr);
+
+//* Function s16MON_ReadDsmState ***************************************************************************************
+//*
+//!  This function processes the terminal command MON_SDI_READ_DSM_STATE
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[out] u16MaxRespOut : Max data to write to output
+//!  @returns    >= 0 : Size of response to terminal (data byte in pu8DataOut)\n
+//!              <0 : not used
+//!  @remarks    Only to be called by s16MONProcessTCHMessage
+//**********************************************************************************************************************
+extern s16SDI_CMD(s16MON_ReadDsmState);
+
+//* Function s16MON_Batch **********************************************************************************************
+//*
+//!  This function processes the terminal command MON_SDI_BATCH: several reading MON commands in one command
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[out] u16MaxRespOut : Max data to write to output
+//!  @returns    >= 0 : Size of response to terminal (data byte in pu8DataOut)\n
+//!              <0 : not used
+//!  @remarks    Only to be called by s16MONProcessTCHMessage
+//**********************************************************************************************************************
+extern s16SDI_CMD(s16MON_Batch);
+
+//* Function s16MON_Subscribe ******************************************************************************************
+//*
+//!  This function processes the terminal command MON_SDI_SUBSCRIBE: periodic sampling of IOS values by the board
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[out] u16MaxRespOut : Max data to write to output
+//!  @returns    >= 0 : Size of response to terminal (data byte in pu8DataOut)\n
+//!              <0 : not used
+//!  @remarks    Only to be called by s16MONProcessTCHMessage
+//**********************************************************************************************************************
+extern s16SDI_CMD(s16MON_Subscribe);
+
+//* Function s16MON_SubRead ********************************************************************************************
+//*
+//!  This function processes the terminal command MON_SDI_SUB_READ: reads the samples of the subscription
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[out] u16MaxRespOut : Max data to write to output
+//!  @returns    >= 0 : Size of response to terminal (data byte in pu8DataOut)\n
+//!              <0 : not used
+//!  @remarks    Only to be called by s16MONProcessTCHMessage
+//**********************************************************************************************************************
+extern s16SDI_CMD(s16MON_SubRead);
+
+//* Function s16MON_DaqArm *********************************************************************************************
+//*
+//!  This function processes the terminal command MON_SDI_DAQ_ARM: arms the recording of internal variables
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[out] u16MaxRespOut : Max data to write to output
+//!  @returns    >= 0 : Size of response to terminal (data byte in pu8DataOut)\n
+//!              <0 : not used
+//!  @remarks    Only to be called by s16MONProcessTCHMessage
+//**********************************************************************************************************************
+extern s16SDI_CMD(s16MON_DaqArm);
+
+//* Function s16MON_DaqState *******************************************************************************************
+//*
+//!  This function processes the terminal command MON_SDI_DAQ_STATE: reads the state of the recording
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[out] u16MaxRespOut : Max data to write to output
+//!  @returns    >= 0 : Size of response to terminal (data byte in pu8DataOut)\n
+//!              <0 : not used
+//!  @remarks    Only to be called by s16MONProcessTCHMessage
+//**********************************************************************************************************************
+extern s16SDI_CMD(s16MON_DaqState);
+
+//* Function s16MON_DaqRead ********************************************************************************************
+//*
+//!  This function processes the terminal command MON_SDI_DAQ_READ: reads the samples of the recording
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[out] u16MaxRespOut : Max data to write to output
+//!  @returns    >= 0 : Size of response to terminal (data byte in pu8DataOut)\n
+//!              <0 : not used
+//!  @remarks    Only to be called by s16MONProcessTCHMessage
+//**********************************************************************************************************************
+extern s16SDI_CMD(s16MON_DaqRead);
+
+//* Function s16MON_DumpStart ******************************************************************************************
+//*
+//!  This function processes the terminal command MON_SDI_DUMP_START: starts the dump of an address range
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[out] u16MaxRespOut : Max data to write to output
+//!  @returns    >= 0 : Size of response to terminal (data byte in pu8DataOut)\n
+//!              <0 : not used
+//!  @remarks    Only to be called by s16MONProcessTCHMessage
+//**********************************************************************************************************************
+extern s16SDI_CMD(s16MON_DumpStart);
+
+//* Function s16MON_DumpRead *******************************************************************************************
+//*
+//!  This function processes the terminal command MON_SDI_DUMP_READ: reads a frame of the memory dump
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[out] u16MaxRespOut : Max data to write to output
+//!  @returns    >= 0 : Size of response to terminal (data byte in pu8DataOut)\n
+//!              <0 : not used
+//!  @remarks    Only to be called by s16MONProcessTCHMessage
+//**********************************************************************************************************************
+extern s16SDI_CMD(s16MON_DumpRead);
+
+//* Function s16MON_ReadDigioPorts *************************************************************************************
+//*
+//!  This function processes the terminal command MON_SDI_READ_DIGIO_PORTS: reads several binary IO ports in one
+//!  pass without changing their configuration
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[out] u16MaxRespOut : Max data to write to output
+//!  @returns    >= 0 : Size of response to terminal (data byte in pu8DataOut)\n
+//!              <0 : not used
+//!  @remarks    Only to be called by s16MONProcessTCHMessage
+//**********************************************************************************************************************
+extern s16SDI_CMD(s16MON_ReadDigioPorts);
+
 //* Function s16MON_BoardStateTestPRO **********************************************************************************
 //*
 //!  This function realize the MON test entering steps
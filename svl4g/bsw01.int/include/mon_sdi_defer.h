@@ -0,0 +1,85 @@
+//**********************************************************************************************************************
+//
+//                                                 mon_sdi_defer.h
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date    2026-10-19
+//! @author  agent
+//!
+//**********************************************************************************************************************
+//! @file
+//! @brief  Deferred responses of MON SDI commands
+//!
+//!         A command handler that has to wait (e.g. between readings of an input) does not block the SDI process.
+//!         It starts a deferred job and answers MON_SDI_PENDING. The job is continued by a step function in a
+//!         10 ms time slice until it has built its response. The tester repeats the same command until it gets a
+//!         response other than MON_SDI_PENDING; the repeated command returns the stored response.
+//!         One job can be deferred at a time, for all MON commands.
+//!
+//**********************************************************************************************************************
+// History
+// Date           Author:       Changes:
+// 2026-10-19     agent         Start
+//
+//**********************************************************************************************************************
+
+#ifndef MON_SDI_DEFER_H
+#define MON_SDI_DEFER_H
+//**************************************** Header / include files ( #include ) *****************************************
+#include "std_defs.h"
+#include "mon_cpu04.h"                      // MON_MSGMAXLEN
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Maximum length of the command and of the response of a deferred job
+#define MON_DEFER_MSG_SIZE                 ((U16) MON_MSGMAXLEN)
+
+//! A response not collected within this time [ms] is discarded
+#define MON_DEFER_RESULT_TIMEOUT           ((U32) 2000)
+
+//**************************************** Type definitions ( typedef ) ************************************************
+//! Step function of a deferred job, called every 10 ms with the command and the response buffer of the job.
+//! Returns 0 while the job is not finished, otherwise the length of the response like a SDI command handler.
+typedef S16 (*T_MON_DEFER_STEP)(const U8* pu8DataIn, U16 u16CmdLenIn, U8* pu8DataOut, U16 u16MaxRespOut);
+
+//**************************************** Global data declarations ( extern ) *****************************************
+
+//**************************************** External parameter / constant declarations ( extern const )  ****************
+
+//**************************************** Global func/proc prototypes *************************************************
+
+//* Function s16MON_DeferPoll ******************************************************************************************
+//*
+//!  Checks a command against the deferred job. To be called by a deferring handler before it processes the command.
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input
+//!  @param[in]  u16CmdLenIn : length of command
+//!  @param[out] pu8DataOut : Pointer on TCH Message for output
+//!  @param[in]  u16MaxRespOut : Max data to write to output
+//!  @returns    0 : no deferred job, the command has to be processed\n
+//!              > 0 : size of the response in pu8DataOut: the stored response of this command or MON_SDI_PENDING
+//!                    while a job is running
+//**********************************************************************************************************************
+extern S16 s16MON_DeferPoll (const U8* pu8DataIn, U16 u16CmdLenIn, U8* pu8DataOut, U16 u16MaxRespOut);
+
+//* Function s16MON_DeferStart *****************************************************************************************
+//*
+//!  Starts a deferred job for a command. Only allowed after s16MON_DeferPoll() returned 0 for the command.
+//!  The handler answers MON_SDI_PENDING if the job is started.
+//
+//!  @param[in]  pu8DataIn : Pointer of Terminal channel input, copied
+//!  @param[in]  u16CmdLenIn : length of command, up to MON_DEFER_MSG_SIZE
+//!  @param[in]  u16MaxRespOut : Max data to write to output, limited to MON_DEFER_MSG_SIZE
+//!  @param[in]  pfStep : Step function of the job
+//!  @returns    KB_RET_OK if the job is started\n
+//!              KB_RET_ERR_ARG on invalid parameters\n
+//!              KB_RET_ERR_RESOURCE if a job is deferred already or the time slice could not be activated
+//**********************************************************************************************************************
+extern S16 s16MON_DeferStart (const U8* pu8DataIn, U16 u16CmdLenIn, U16 u16MaxRespOut, T_MON_DEFER_STEP pfStep);
+
+#endif
+//* EndOfFile mon_sdi_defer.h ******************************************************************************************
@@ -0,0 +1,148 @@
+//**********************************************************************************************************************
+//
+//                                                 mon_sdi_resp.h
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date    2026-10-19
+//! @author  agent
+//!
+//**********************************************************************************************************************
+//! @file
+//! @brief  Response builder of the MON SDI commands
+//!
+//!         The handlers append their response directly to the SDI response message (pu8DataOut), every append is
+//!         checked against the maximum response length (u16MaxRespOut). A response that does not fit is replaced
+//!         by MON_SDI_RANGE_ERROR at the end.
+//!         The builder starts behind the leading byte of the message (MON_SDI_INDEX_1) with the status.
+//!
+//**********************************************************************************************************************
+// History
+// Date           Author:       Changes:
+// 2026-10-19     agent         Start
+//
+//**********************************************************************************************************************
+
+#ifndef MON_SDI_RESP_H
+#define MON_SDI_RESP_H
+//**************************************** Header / include files ( #include ) *****************************************
+#include "std_defs.h"
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+
+//**************************************** Type definitions ( typedef ) ************************************************
+//! Response under construction
+typedef struct
+{
+    U8* pu8Msg;                             //!< Response message
+    U16 u16Max;                             //!< Maximum length of the response message
+    U16 u16Len;                             //!< Current length of the response message
+    BOOLEAN boOverflow;                     //!< An append did not fit
+} C_MON_RESP;
+
+//**************************************** Global data declarations ( extern ) *****************************************
+
+//**************************************** External parameter / constant declarations ( extern const )  ****************
+
+//**************************************** Global func/proc prototypes *************************************************
+
+//* Function vMON_RespInit *********************************************************************************************
+//*
+//!  Starts a response in the SDI response message.
+//
+//!  @param[out] pcResp : Response
+//!  @param[in]  pu8DataOut : Pointer on TCH Message for output
+//!  @param[in]  u16MaxRespOut : Max data to write to output
+//**********************************************************************************************************************
+extern void vMON_RespInit (C_MON_RESP* pcResp, U8* pu8DataOut, U16 u16MaxRespOut);
+
+//* Function vMON_RespU8 ***********************************************************************************************
+//*
+//!  Appends a byte.
+//
+//!  @param[in,out] pcResp : Response
+//!  @param[in]     u8Value : Value
+//**********************************************************************************************************************
+extern void vMON_RespU8 (C_MON_RESP* pcResp, U8 u8Value);
+
+//* Function vMON_RespU16Be ********************************************************************************************
+//*
+//!  Appends a U16 value, high byte first.
+//
+//!  @param[in,out] pcResp : Response
+//!  @param[in]     u16Value : Value
+//**********************************************************************************************************************
+extern void vMON_RespU16Be (C_MON_RESP* pcResp, U16 u16Value);
+
+//* Function vMON_RespU16Le ********************************************************************************************
+//*
+//!  Appends a U16 value, low byte first (format of the older MON commands).
+//
+//!  @param[in,out] pcResp : Response
+//!  @param[in]     u16Value : Value
+//**********************************************************************************************************************
+extern void vMON_RespU16Le (C_MON_RESP* pcResp, U16 u16Value);
+
+//* Function vMON_RespU32Be ********************************************************************************************
+//*
+//!  Appends a U32 value, high byte first.
+//
+//!  @param[in,out] pcResp : Response
+//!  @param[in]     u32Value : Value
+//**********************************************************************************************************************
+extern void vMON_RespU32Be (C_MON_RESP* pcResp, U32 u32Value);
+
+//* Function vMON_RespBytes ********************************************************************************************
+//*
+//!  Appends bytes.
+//
+//!  @param[in,out] pcResp : Response
+//!  @param[in]     pu8Data : Bytes
+//!  @param[in]     u16Len : Number of bytes
+//**********************************************************************************************************************
+extern void vMON_RespBytes (C_MON_RESP* pcResp, const U8* pu8Data, U16 u16Len);
+
+//* Function pu8MON_RespReserve ****************************************************************************************
+//*
+//!  Appends bytes to be written by the caller, e.g. data produced in place by another service.
+//
+//!  @param[in,out] pcResp : Response
+//!  @param[in]     u16Len : Number of bytes, 0 to get the free space without appending
+//!  @returns       Pointer to the appended bytes, KB_NULL_PTR if they do not fit
+//**********************************************************************************************************************
+extern U8* pu8MON_RespReserve (C_MON_RESP* pcResp, U16 u16Len);
+
+//* Function u16MON_RespFree *******************************************************************************************
+//*
+//!  Returns the number of bytes that can still be appended.
+//
+//!  @param[in]  pcResp : Response
+//!  @returns    Number of free bytes
+//**********************************************************************************************************************
+extern U16 u16MON_RespFree (const C_MON_RESP* pcResp);
+
+//* Function s16MON_RespError ******************************************************************************************
+//*
+//!  Discards the appended bytes and ends the response with a status only.
+//
+//!  @param[in,out] pcResp : Response
+//!  @param[in]     u8Status : Status, MON_SDI_xxx
+//!  @returns       Size of response to terminal
+//**********************************************************************************************************************
+extern S16 s16MON_RespError (C_MON_RESP* pcResp, U8 u8Status);
+
+//* Function s16MON_RespEnd ********************************************************************************************
+//*
+//!  Ends the response.
+//
+//!  @param[in,out] pcResp : Response
+//!  @returns       Size of response to terminal, the size of MON_SDI_RANGE_ERROR if an append did not fit
+//**********************************************************************************************************************
+extern S16 s16MON_RespEnd (C_MON_RESP* pcResp);
+
+#endif
+//* EndOfFile mon_sdi_resp.h *******************************************************************************************
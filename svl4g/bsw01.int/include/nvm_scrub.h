@@ -0,0 +1,121 @@
+//**********************************************************************************************************************
+//
+//                                                   nvm_scrub.h
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date 2026-10-19
+//! @author agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file nvm_scrub.h
+//! @brief NVM - Background scrubbing of the NVM areas.
+//!
+//!        The scrubber reads every configured area in small chunks through the NVM queue and keeps a CRC per area.
+//!        An area whose CRC changes although NVM did not write it (HAL write stamps) is reported to FIM.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+// 2026-10-19   agent          Base error number defined by the project configuration, NVM_SCRUB_MAX_ERR_CODE
+//
+//**********************************************************************************************************************
+
+#ifndef NVM_SCRUB_H
+#define NVM_SCRUB_H
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "kb_types.h"                                           // Standard definitions
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Maximum number of scrubbed areas
+#define NVM_SCRUB_MAX_AREAS              ((U8) 16)
+
+//! Maximum chunk size in bytes (size of the read buffer)
+#define NVM_SCRUB_MAX_CHUNK_SIZE         ((U16) 256)
+
+//! Highest error number, the service error number of FIM is a U8
+#define NVM_SCRUB_MAX_ERR_CODE           ((U16) 0xFF)
+
+//**************************************** Type definitions ( typedef ) ************************************************
+//! Scrubbed area, configured by the owner of the area IDs
+typedef struct
+{
+    U8  u8NvmID;                                                //!< Device identifier
+    U8  u8AreaID;                                               //!< Area identifier, used for the queued reads
+    U32 u32DevOffset;                                           //!< Offset of the area in the device (write stamps)
+    U32 u32Size;                                                //!< Size of the area in bytes
+} C_NVM_SCRUB_AREA;
+
+//! State of an entry of the CRC directory
+typedef enum
+{
+    eNVM_SCRUB_AREA_UNKNOWN = 0,                                //!< No reference CRC yet (startup, area rewritten)
+    eNVM_SCRUB_AREA_VALID,                                      //!< Last pass matched the reference CRC
+    eNVM_SCRUB_AREA_CORRUPT                                     //!< CRC changed without write, reported to FIM
+} E_NVM_SCRUB_AREA_STATE;
+
+//! Entry of the CRC directory
+typedef struct
+{
+    U32 u32Crc;                                                 //!< Reference CRC of the area
+    U32 u32Stamp;                                               //!< HAL write stamp the reference CRC belongs to
+    U16 u16PassCnt;                                             //!< Number of completed passes
+    E_NVM_SCRUB_AREA_STATE eState;                              //!< State of the area
+} C_NVM_SCRUB_AREA_INFO;
+
+//**************************************** Global data declarations ( extern ) *****************************************
+
+//**************************************** External parameter / constant declarations ( extern const )	****************
+//! Scrubbed areas (c_nvm.c)
+extern const C_NVM_SCRUB_AREA acNVM_USR_ScrubArea[];
+
+//! Number of scrubbed areas, at most NVM_SCRUB_MAX_AREAS (c_nvm.c)
+extern const U8 u8NVM_USR_ScrubAreaCnt;
+
+//! Bytes read per chunk, multiple of 4 up to NVM_SCRUB_MAX_CHUNK_SIZE (cfg_nvm.c)
+extern const U16 u16NVM_CFG_ScrubChunkSize;
+
+//! Number of 100ms cycles between two chunks, 0 switches the scrubber off (cfg_nvm.c)
+extern const U16 u16NVM_CFG_ScrubInterval;
+
+//! Base error number of the NVM_ID errors of the scrubbed areas, the error of an area is base + index in
+//! acNVM_USR_ScrubArea. Defined by the project configuration together with the FIM-DSM fault map (C_CDO_FIM_DSM_AL,
+//! cd_fim_faultmap.h), which maps these service error numbers to DSM faults. An error number above
+//! NVM_SCRUB_MAX_ERR_CODE is not reported.
+extern const U16 u16NVM_CFG_ScrubErrCode;
+
+//**************************************** Global func/proc prototypes *************************************************
+
+//* Function vNVM_Cycl100ms_Scrub **************************************************************************************
+//!
+//! @brief      Scrubber step, called in the 100ms BCM cyclic list. Collects the result of the last queued read and
+//!             queues the next chunk once every u16NVM_CFG_ScrubInterval cycles. At most one read is queued at a time.
+//!
+//! @return     -
+//!
+//**********************************************************************************************************************
+extern void vNVM_Cycl100ms_Scrub (void);
+
+//* Function s16NVM_ScrubGetAreaInfo ***********************************************************************************
+//!
+//! @brief      Returns the CRC directory entry of a scrubbed area.
+//!
+//! @param[in]  u8Area  : Index in acNVM_USR_ScrubArea
+//! @param[out] pcInfo  : Directory entry
+//!
+//! @return     KB_RET_OK on success, KB_RET_ERR_ARG for invalid areas, KB_RET_ERR_INST_PTR for null pointers.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_ScrubGetAreaInfo (U8 u8Area, C_NVM_SCRUB_AREA_INFO* pcInfo);
+
+#endif // NVM_SCRUB_H
+
+// EndOfFile nvm_scrub.h ***********************************************************************************************
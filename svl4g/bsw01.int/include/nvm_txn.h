@@ -0,0 +1,133 @@
+//**********************************************************************************************************************
+//
+//                                                    nvm_txn.h
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date 2026-10-19
+//! @author agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file nvm_txn.h
+//! @brief NVM - Atomic transactions over several NVM writes.
+//!
+//!        Writes staged between s16NVM_TxnBegin() and s16NVM_TxnCommit() are stored in a redo journal in FRAM
+//!        before they are applied. After a reset during the commit the journal is replayed by s16NVM_TxnInit(), so
+//!        either all or none of the staged writes are visible.
+//!        Only one transaction can be open at a time. s16NVM_TxnStage(), s16NVM_TxnCommit() and s16NVM_TxnAbort()
+//!        may only be called by the process whose s16NVM_TxnBegin() returned KB_RET_OK.
+//!        The functions block and must be called on task level. The commit writes every staged byte twice, once to
+//!        the journal and once to its area, plus the journal header (24 bytes) and the clear (4 bytes). These are
+//!        blocking FRAM writes in the cycle of the caller: a full journal of NVM_TXN_JRNL_SIZE bytes takes about
+//!        1.7 ms at a FRAM SPI clock of 10 MHz, before the writes are applied.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+// 2026-10-19   agent          Replay errors reported to FIM (u16NVM_CFG_TxnErrCode), cost of the commit documented
+//
+//**********************************************************************************************************************
+
+#ifndef NVM_TXN_H
+#define NVM_TXN_H
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "kb_types.h"                                           // Standard definitions
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Size of the journal area in bytes (NVM_LAYOUT_DEV1_SVL), also the size of the staging buffer
+#define NVM_TXN_JRNL_SIZE                ((U32) 0x0800)
+
+//! Maximum number of writes of a transaction
+#define NVM_TXN_MAX_ENTRIES              ((U16) 16)
+
+//! Highest error number, the service error number of FIM is a U8
+#define NVM_TXN_MAX_ERR_CODE             ((U16) 0xFF)
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data declarations ( extern ) *****************************************
+
+//**************************************** External parameter / constant declarations ( extern const )	****************
+//! Area identifier of the journal on NVM_DEVICE_ID1 (cfg_nvm.c)
+extern const U8 u8NVM_CFG_TxnJrnlAreaID;
+
+//! Error number of the NVM_ID error "journal could not be replayed". Defined by the project configuration together
+//! with the FIM-DSM fault map (C_CDO_FIM_DSM_AL, cd_fim_faultmap.h). A number above NVM_TXN_MAX_ERR_CODE is not
+//! reported.
+extern const U16 u16NVM_CFG_TxnErrCode;
+
+//**************************************** Global func/proc prototypes *************************************************
+
+//* Function s16NVM_TxnInit ********************************************************************************************
+//!
+//! @brief      Replays a committed journal: the writes of a transaction interrupted by a reset are applied again,
+//!             then the journal is cleared. A journal with a wrong CRC was not committed and is ignored.
+//!             Must be called after s16NVM_Init() and s16FIM_Init() and before the first reader of transactional
+//!             data. If the journal can not be read, replayed or cleared, the error u16NVM_CFG_TxnErrCode is
+//!             reported to FIM and the startup continues.
+//!
+//! @return     KB_RET_OK
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_TxnInit (void);
+
+//* Function s16NVM_TxnBegin *******************************************************************************************
+//!
+//! @brief      Opens a transaction.
+//!
+//! @return     KB_RET_OK on success, KB_RET_ERR_INTERNAL if a transaction is already open.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_TxnBegin (void);
+
+//* Function s16NVM_TxnStage *******************************************************************************************
+//!
+//! @brief      Adds a write to the open transaction. The data is copied, nothing is written to NVM yet.
+//!             A failing call marks the transaction as failed, s16NVM_TxnCommit() then writes nothing.
+//!
+//! @param[in]  u8NvmID    : Device identifier
+//! @param[in]  u8AreaID   : Area identifier
+//! @param[in]  u32Offset  : Offset in the area
+//! @param[in]  pu8Data    : Data to write
+//! @param[in]  u32Length  : Number of bytes to write
+//!
+//! @return     KB_RET_OK on success,
+//!             KB_RET_ERR_INTERNAL if no transaction is open,
+//!             KB_RET_ERR_ARG on invalid parameters,
+//!             KB_RET_ERR_RESOURCE if the journal or the entry table is full.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_TxnStage (U8 u8NvmID, U8 u8AreaID, U32 u32Offset, const U8* pu8Data, U32 u32Length);
+
+//* Function s16NVM_TxnCommit ******************************************************************************************
+//!
+//! @brief      Writes the journal, applies the staged writes in order and clears the journal. Closes the transaction.
+//!
+//! @return     KB_RET_OK on success,
+//!             KB_RET_ERR_INTERNAL if no transaction is open or a staging call failed (nothing written),
+//!             KB_RET_ERR_DRIVER on NVM errors. If the journal was written, the writes are replayed at the next
+//!             startup.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_TxnCommit (void);
+
+//* Function s16NVM_TxnAbort *******************************************************************************************
+//!
+//! @brief      Discards the staged writes and closes the transaction.
+//!
+//! @return     KB_RET_OK on success, KB_RET_ERR_INTERNAL if no transaction is open.
+//!
+//**********************************************************************************************************************
+extern S16 s16NVM_TxnAbort (void);
+
+#endif // NVM_TXN_H
+
+// EndOfFile nvm_txn.h *************************************************************************************************
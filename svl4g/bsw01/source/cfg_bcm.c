@@ -81,6 +81,11 @@
 // 2023-05-16      C. Brancolini       Lint clean up
 // 2023-09-28      A. Mauro            Added s16MON_BoardStateTestPRO
 // 2023-12-01      C. Brancolini       Lint Plus clean up
+// 2026-10-19      agent               Added vNVM_Cycl100ms_Scrub (background scrubbing of NVM areas)
+// 2026-10-19      agent               Added s16NVM_TxnInit (replay of interrupted NVM transactions)
+// 2026-10-19      agent               Added s16NVM_TxnInit to the LIMITED board state
+// 2026-10-19      agent               Added s16NVM_HAL_AdpStatStart to the startup functions
+// 2026-10-19      agent               s16NVM_TxnInit after s16FIM_Init in the LIMITED board state
 //
 //**********************************************************************************************************************
 //Note: Suppression of "No magic numbers", all magic numbers come with comments so there's necessity to add definitions
@@ -130,6 +135,9 @@
 #include "nvm_s.h"
 #include "nvm_i.h"
 #include "mon_cpu04_genrl_sdi_i.h"                          //!< CPU04 general MON commands
+#include "nvm_scrub.h"                                      //!< Background scrubbing of NVM areas
+#include "nvm_txn.h"                                        //!< NVM transactions
+#include "nvm_hal_bs_i.h"                                   //!< NVM HAL statistics
 
 //**************************************** Constant / macro definitions ( #define ) ************************************
 
@@ -636,6 +644,7 @@ const T_BCM_S16FP aps16BCM_CFG_NrmlInitFct[] =
         s16FIM_Init,       // Initialize Service FIM
         s16CAN_Init,       // s16CAN_Init must be 2nd in list
         s16NVM_Init,       // NVM initialization
+        s16NVM_TxnInit,    // Replay of interrupted NVM transactions, before the first NVM user
         s16MON_Init,
         s16SDI_Init,       // Service Data Interface
         s16FwkCtrlLad_MemInit,
@@ -690,6 +699,7 @@ const T_BCM_S16FP aps16BCM_CFG_NrmlStartup2Fct[] =
         s16IBC_Startup,
         s16MON_StartUp,
         s16FIM_AdpInit,
+        s16NVM_HAL_AdpStatStart,  // Service times of the NVM statistics, OS is running
     };
 
 // Total number of configured startup stage 2 functions for NORMAL board state
@@ -714,6 +724,7 @@ const T_BCM_S16FP aps16BCM_CFG_LmtdInitFct[] =
      s16NVM_Init, // NVM initialization
      s16BCM_Init, // Initialize BCM
      s16FIM_Init, // Initialize Service FIM
+     s16NVM_TxnInit, // Replay of interrupted NVM transactions after FIM (replay errors), before the DSM data is read
      s16SDI_Init, // Service Data Interface
 };
 
@@ -725,6 +736,7 @@ const T_BCM_S16FP aps16BCM_CFG_LmtdStartupFct[] =
 {
     s16BCM_Startup,
     s16SDI_Startup,
+    s16NVM_HAL_AdpStatStart,  // Service times of the NVM statistics, OS is running
 };
 
 // Total number of configured startup functions for LIMITED board state
@@ -773,7 +785,10 @@ const T_BCM_CYCL_VFP apvBCM_CFG_CyclFct[] =
      // Check connection status of one wire devices
         vBCM_Cycl100ms_OwmDeviceCheck,
     // Update and check temperature values
-    vBCM_Cycl100ms_TempHndl
+    vBCM_Cycl100ms_TempHndl,
+
+    // Background scrubbing of NVM areas, queues at most one NVM read at a time
+    vNVM_Cycl100ms_Scrub
 
 };
 
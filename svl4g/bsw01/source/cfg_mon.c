@@ -33,6 +33,10 @@
 // 2023-01-09   J. Lulli    Coding guidelines alignment
 // 2023-05-16   C. Brancolini  Lint clean up
 // 2023-11-30 C. Brancolini Lint Plus clean up
+// 2026-10-19   agent       Address ranges of the data acquisition added
+// 2026-10-19   agent       Address ranges of the data acquisition used by the memory dump too
+// 2026-10-19   agent       Memory segments listed once (MEM_SEG_LIST) for the memory read, the data acquisition
+//                          and the memory dump
 //
 //**************************************** Compiler options ( #pragma ) ************************************************
 
@@ -54,6 +58,15 @@
 #define MEM_SYS_SEG_LENGTH         ((U32)0x010000)   // Memory segment 3 length
 #define MEM_SPARE_SEG_LENGTH       ((U32)0x0B0000)   // Memory segment 4 length
 #define MEM_SVL_SEG_LENGTH         ((U32)0x100000)   // Memory segment 5 length
+//**************************************** Memory segments {start address, length} ************************************
+// MEM_SEG_COUNT segments, shared by the memory read (cMON_Mem_Read_Normal, cMON_Mem_Read_Test), the data acquisition
+// and the memory dump (acMON_RamArea)
+#define MEM_SEG_LIST                                 \
+        {MEM_RSM_START_ADDR,   MEM_RSM_SEG_LENGTH  }, \
+        {MEM_DRV_START_ADDR,   MEM_DRV_SEG_LENGTH  }, \
+        {MEM_SYS_START_ADDR,   MEM_SYS_SEG_LENGTH  }, \
+        {MEM_SPARE_START_ADDR, MEM_SPARE_SEG_LENGTH}, \
+        {MEM_SVL_START_ADDR,   MEM_SVL_SEG_LENGTH  }
 //**************************************** Type definitions ( typedef ) ************************************************
 
 //**************************************** Global data definitions *****************************************************
@@ -80,11 +93,7 @@ const C_MON_MEM_SEGMENT    cMON_Mem_Read_Normal =
     MEM_SEG_COUNT, // No. of memory segments
     //      Start Address, Size
     {
-        {MEM_RSM_START_ADDR,   MEM_RSM_SEG_LENGTH  },  //lint !e9078
-        {MEM_DRV_START_ADDR,   MEM_DRV_SEG_LENGTH  },  //lint !e9078
-        {MEM_SYS_START_ADDR,   MEM_SYS_SEG_LENGTH  },  //lint !e9078
-        {MEM_SPARE_START_ADDR, MEM_SPARE_SEG_LENGTH},  //lint !e9078
-        {MEM_SVL_START_ADDR,   MEM_SVL_SEG_LENGTH  },  //lint !e9078
+        MEM_SEG_LIST,                 //lint !e9078
         {(U8  *)0,0UL},               //free
         {(U8  *)0,0UL},               //free
         {(U8  *)0,0UL},               //free
@@ -103,11 +112,7 @@ const C_MON_MEM_SEGMENT    cMON_Mem_Read_Test =
     MEM_SEG_COUNT, // No. of memory segments
     {
         //      Start Address, Size
-        {MEM_RSM_START_ADDR,   MEM_RSM_SEG_LENGTH  },  //lint !e9078
-        {MEM_DRV_START_ADDR,   MEM_DRV_SEG_LENGTH  },  //lint !e9078
-        {MEM_SYS_START_ADDR,   MEM_SYS_SEG_LENGTH  },  //lint !e9078
-        {MEM_SPARE_START_ADDR, MEM_SPARE_SEG_LENGTH},  //lint !e9078
-        {MEM_SVL_START_ADDR,   MEM_SVL_SEG_LENGTH  },  //lint !e9078
+        MEM_SEG_LIST,                 //lint !e9078
         {(U8  *)0,0UL},               //free
         {(U8  *)0,0UL},               //free
         {(U8  *)0,0UL},               //free
@@ -121,6 +126,17 @@ const C_MON_MEM_SEGMENT    cMON_Mem_Read_Test =
     }
 };                        // TEST: READ MEMORY
 
+//**********************************************************************************************************************
+// Address ranges {start address, number of bytes} where the data acquisition and the memory dump of MON can read.
+//****************************************************************************
+const C_MON_RAM_AREA       acMON_RamArea[MEM_SEG_COUNT] =
+{
+    //      Start Address, Size
+    MEM_SEG_LIST                      //lint !e9078
+};
+
+const U8 u8MON_RamAreas = (U8) MEM_SEG_COUNT;    // No. of address ranges of the data acquisition and memory dump
+
 
 //**************************************** Local func/proc prototypes ( static ) ***************************************
 
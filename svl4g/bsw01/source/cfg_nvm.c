@@ -32,6 +32,12 @@
 // 2022-11-26   S.Shinde    Adapted for GenCA 7.05
 // 2023-01-09   J. Lulli    Coding guidelines alignment
 // 2023-11-13   C. Brancolini  Lint Plus clean up
+// 2026-10-19   agent       Device-2 APP area reduced to the logical size of the flash log store.
+// 2026-10-19   agent       Area offsets and tables generated from the NVM layout (nvm_layout_i.h)
+// 2026-10-19   agent       Configuration of the background scrubber (nvm_scrub.c)
+// 2026-10-19   agent       Device-1 SVL area for the journal of the NVM transactions (nvm_txn.c)
+// 2026-10-19   agent       Time source of the NVM HAL operation statistics
+// 2026-10-19   agent       Base error number of the scrubber moved to the project configuration (FIM-DSM fault map)
 //
 //**********************************************************************************************************************
 
@@ -43,6 +49,11 @@
 #include "bcm_lmtd_i.h"                                 // BCM LMTD area size
 #include "nvm_common.h"                                 // NVM Common definitions
 #include "bcm_como_i.h"                                 // BCM_COMO area size
+#include "nvm_layout_i.h"                               // Layout of the NVM devices
+#include "nvm_scrub.h"                                  // Background scrubber
+#include "nvm_txn.h"                                    // NVM transactions
+#include "nvm_hal_bs_i.h"                               // NVM HAL operation statistics
+#include "os.h"                                         // s16OS_GetTimeMS
 
 //**************************************** Constant / macro definitions ( #define ) ************************************
 //! No.of devices configured
@@ -50,8 +61,8 @@
 
 //! Following constants needs to be updated, if configuration in 'acNVM_SVL_Device_x' is changed by User
 #define NVM_SVL_CFG_VERS_DEV_0              ((U8) 0x03)      //!< Version of SVL's NVM configuration for Device-0
-#define NVM_SVL_CFG_VERS_DEV_1              ((U8) 0x05)      //!< Version of SVL's NVM configuration for Device-1
-#define NVM_SVL_CFG_VERS_DEV_2              ((U8) 0x07)      //!< Version of SVL's NVM configuration for Device-2
+#define NVM_SVL_CFG_VERS_DEV_1              ((U8) 0x06)      //!< Version of SVL's NVM configuration for Device-1
+#define NVM_SVL_CFG_VERS_DEV_2              ((U8) 0x08)      //!< Version of SVL's NVM configuration for Device-2
 
 //! This is size of queue, indicates how many operations can be queued in
 #define NVM_SVL_CFG_MAX_QUEUE_ENTRIES       ((U8) 0x05)
@@ -67,14 +78,8 @@
 #define NVM_POFF_SVL_AREA_SIZE_BD_LMTD      ((U32) BCM_LMTD_POFF_SIZE)    //!< Size of POFF data for BD LMTD
 #define NVM_POFF_SVL_AREA_SIZE_NVM          ((U32) NVM_CFG_POFF_SIZE)     //!< Size of POFF data for NVM CFG
 #define NVM_POFF_SVL_AREA_SIZE_BCM_COMO     ((U32) sizeof(C_BCM_COMO_NVM_OPCNT))   //!< Size of POFF data for BCM_COMO
-#define NVM_SVL_AREA_SIZE0_RES_APP          ((U32) 0x0C00)                //!< 3kB, Reserved APP area size
 
-//! Area offset of SVL for Device_0
-#define NVM_SVL_AREA_OFFSET0_0              ((U32) 0x0000)  //!< Device-0, First area offset
-#define NVM_SVL_AREA_OFFSET0_1              ((U32) (NVM_SVL_AREA_OFFSET0_0 + NVM_POFF_SVL_AREA_SIZE_BD_LMTD))
-
-#define NVM_SVL_AREA_OFFSET0_2              ((U32) (NVM_SVL_AREA_OFFSET0_1 + NVM_POFF_SVL_AREA_SIZE_NVM))
-#define NVM_SVL_AREA_OFFSET0_RES_APP        ((U32) (NVM_SVL_AREA_OFFSET0_2 + NVM_POFF_SVL_AREA_SIZE_BCM_COMO))
+//! Reserved APP area size and area offsets of SVL for Device_0: NVM_LAYOUT_DEV0_SVL (nvm_layout_i.h)
 
 // End of Device_0 definitions------------------------------------------------------------------------------------------
 
@@ -84,16 +89,9 @@
 //! Area identifiers of SVL for Device_1
 // Note: Define area identifiers for Device_1 here
 #define NVM_SVL_AREA_ID1_SPARE              ((U8) 0x00)          //!< Device-1, Spare memory for SVL areas
+#define NVM_SVL_AREA_ID1_TXN_JRNL           ((U8) 0x01)          //!< Device-1, Journal of the NVM transactions
 
-//! Area sizes of SVL for Device_1
-// Note: This is spare area size provided as an example, board owner can use this memory area
-#define NVM_SVL_AREA_SIZE1_SPARE            ((U32) 0x9800)        //!< Device-1, Spare memory for SVL areas
-#define NVM_SVL_AREA_SIZE1_RES_APP          ((U32) 0x14000)       //!< Device-1, Reserved APP area size
-
-//! Area offset of SVL for Device_1
-#define NVM_SVL_AREA_OFFSET1_SPARE          ((U32) 0x0000)        //!< Device-1, Reserved APP area offset
-#define NVM_HAL_AREA_OFFSET1_RES_APP        ((U32)(NVM_SVL_AREA_OFFSET1_SPARE + NVM_SVL_AREA_SIZE1_SPARE))
-                                                                  //!< Device-1, Second area offset
+//! Area sizes and offsets of SVL for Device_1: NVM_LAYOUT_DEV1_SVL (nvm_layout_i.h)
 
 // End of Device_1 definitions------------------------------------------------------------------------------------------
 
@@ -104,11 +102,7 @@
 // Note: Define area identifiers for Device_2 here
 // There are no SVL areas for this device
 
-//! Area size of SVL for Device_2
-#define NVM_SVL_AREA_SIZE2_RES_APP          ((U32) 0xC000)        //!< Device-2, Reserved APP area size
-
-//! Area offset of SVL for Device_2
-#define NVM_SVL_AREA_OFFSET2_RES_APP        ((U32) 0x0000)        //!< Device-2, First area offset
+//! Area sizes and offsets of SVL for Device_2: NVM_LAYOUT_DEV2_SVL (nvm_layout_i.h)
 
 // End of Device_2 definitions------------------------------------------------------------------------------------------
 
@@ -124,7 +118,18 @@
 // Size of POFF data for APP
 #define NVM_POFF_NONFWR_AREA_SIZE_USR       ((U32) 3072)
 
+//! Table entry of a SVL area
+#define NVM_SVL_LAYOUT_ROW(L, Name, Id, Size, Align)    { (Id), NVM_LAYOUT_OFFSET(L, Name), (Size) },
+
 //**************************************** Type definitions ( typedef ) ************************************************
+//! SVL areas, checked against the HAL reserved areas
+NVM_LAYOUT_DEFINE(DEV0_SVL)
+NVM_LAYOUT_DEFINE(DEV1_SVL)
+NVM_LAYOUT_DEFINE(DEV2_SVL)
+
+//! The journal area holds the complete staging buffer of nvm_txn.c
+NVM_LAYOUT_CHECK(TXN_JRNL_SIZE, (NVM_LAYOUT_OFFSET(DEV1_SVL, RES_APP) - NVM_LAYOUT_OFFSET(DEV1_SVL, TXN_JRNL)) ==
+                                NVM_TXN_JRNL_SIZE)
 
 //**************************************** Global data definitions *****************************************************
 //! Operation Queue Handling structure for device 0
@@ -163,26 +168,19 @@ C_NVM_POFF_DATA acNVM_PoffData[NVM_SVL_NUM_OF_CONFIG_DEVICES]; // @suppress("Avo
 //! SVL area configuration for POFF device
 static const C_NVM_SVL_DEVICE_AREAS acNVM_SVL_Device_0[] =
 {
-    // Area ID,                       Area Offset,                  Area Size
-    { NVM_POFF_SVL_AREA_ID_BD_LMTD, NVM_SVL_AREA_OFFSET0_0,       NVM_POFF_SVL_AREA_SIZE_BD_LMTD  },
-    { NVM_POFF_SVL_AREA_ID_NVM,     NVM_SVL_AREA_OFFSET0_1,       NVM_POFF_SVL_AREA_SIZE_NVM      },
-    { NVM_POFF_SVL_AREA_ID_BCM_COMO,  NVM_SVL_AREA_OFFSET0_2,       NVM_POFF_SVL_AREA_SIZE_BCM_COMO },
-    { NVM_APP_AREA_ID_RES,          NVM_SVL_AREA_OFFSET0_RES_APP, NVM_SVL_AREA_SIZE0_RES_APP      }
+    NVM_LAYOUT_DEV0_SVL(NVM_SVL_LAYOUT_ROW)
 };
 
 //! SVL area configuration for FRAM
 static const C_NVM_SVL_DEVICE_AREAS acNVM_SVL_Device_1[] =
 {
-    // Area ID,                       Area Offset,                  Area Size
-    { NVM_SVL_AREA_ID1_SPARE,         NVM_SVL_AREA_OFFSET1_SPARE,   NVM_SVL_AREA_SIZE1_SPARE       },  //!< Reserved
-    { NVM_APP_AREA_ID_RES,            NVM_HAL_AREA_OFFSET1_RES_APP, NVM_SVL_AREA_SIZE1_RES_APP     }   //!< Reserved
+    NVM_LAYOUT_DEV1_SVL(NVM_SVL_LAYOUT_ROW)
 };
 
 //! SVL area configuration for FLASH
 static const C_NVM_SVL_DEVICE_AREAS acNVM_SVL_Device_2[] =
 {
-    // Area ID,                       Area Offset,                  Area Size
-    { NVM_APP_AREA_ID_RES,            NVM_SVL_AREA_OFFSET2_RES_APP, NVM_SVL_AREA_SIZE2_RES_APP     }   //!< Reserved
+    NVM_LAYOUT_DEV2_SVL(NVM_SVL_LAYOUT_ROW)
 };
 
 //! This table configures 'Device area configuration' & 'number of areas' per device,
@@ -227,6 +225,18 @@ const U8 u8NVM_SVL_MaxEntriesInQueue = NVM_SVL_CFG_MAX_QUEUE_ENTRIES;
 
 //! First area id of Application area
 const U8 u8NVM_SVL_AppFirstAreaID = NVM_APP_AREA_ID_RES;
+
+//! Area identifier of the journal of the NVM transactions
+const U8 u8NVM_CFG_TxnJrnlAreaID = NVM_SVL_AREA_ID1_TXN_JRNL;
+
+//! Scrubber: bytes per queued read and 100ms cycles between two reads. One pass over all areas takes
+//! (sum of the area sizes / chunk size) * interval * 100ms, about 52s for the current layout.
+const U16 u16NVM_CFG_ScrubChunkSize = 128U;                     // @suppress("No magic numbers")
+const U16 u16NVM_CFG_ScrubInterval  = 1U;                       // @suppress("No magic numbers")
+
+//! Time source of the NVM HAL operation statistics (service time histograms), called by the HAL only after
+//! s16NVM_HAL_AdpStatStart (BCM startup, cfg_bcm.c)
+const T_NVM_HAL_S16FP_STAT_GETTIME pfs16NVM_HAL_CFG_StatGetTimeMs = s16OS_GetTimeMS;
 //----------------------------------------------------------------------------------------------------------------------
 //! Unique Area Identifiers
 //----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,224 @@
+//**********************************************************************************************************************
+//
+//                                                   fim_dedup.c
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date 2026-10-19
+//! @author agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file fim_dedup.c
+//! @brief FIM - Deduplication of the fault reports of the SVL monitors.
+//!
+//!        Per fault code the last state forwarded to FIM and its service ID are kept. A report with the same state
+//!        and service ID is not forwarded but counted. A fault code reported by two services is forwarded every
+//!        time the service changes. A report rejected by FIM is not kept, so the next report is forwarded again.
+//!        The reports of one fault code come from one monitor task, different fault codes are independent.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+// 2026-10-19   agent          Total of the suppressed repeats summed up on read
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "kb_types.h"                                           // Standard definitions
+#include "kb_ret.h"                                             // Global Knorr-Bremse return value definitions
+#include "fim.h"                                                // Fault reporting
+#include "fim_dedup.h"                                          // Own interface
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Last forwarded state of a fault code
+#define FIM_DEDUP_NONE                   ((U8) 0)               //!< Nothing forwarded yet
+#define FIM_DEDUP_SET                    ((U8) 1)
+#define FIM_DEDUP_RESET                  ((U8) 2)
+#define FIM_DEDUP_UNKNOWN                ((U8) 3)
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+//! Last forwarded state per fault code
+static U8 au8FIM_DedupState[FIM_DEDUP_CODES];
+
+//! Service ID of the last forwarded report per fault code
+static U8 au8FIM_DedupSrvID[FIM_DEDUP_CODES];
+
+//! Suppressed repeats per fault code since the last forwarded report
+static U16 au16FIM_DedupRepeat[FIM_DEDUP_CODES];
+
+//! Suppressed repeats per fault code. Written by the task of the fault code only, the total is summed up on read.
+static U32 au32FIM_DedupSuppressed[FIM_DEDUP_CODES];
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+static BOOLEAN boFIM_DedupForward (U8 u8FaultCode, U8 u8SrvID, U8 u8State);
+
+static void vFIM_DedupForwarded (U8 u8FaultCode, U8 u8SrvID, U8 u8State, S16 s16Result);
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+// Function s16FIM_DedupSetFault
+//**********************************************************************************************************************
+S16 s16FIM_DedupSetFault (U8 u8FaultCode, U8 u8SrvID)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Result = KB_RET_OK;                                  // Function return variable
+
+//*************************************************** Function code ****************************************************
+    if (boFIM_DedupForward(u8FaultCode, u8SrvID, FIM_DEDUP_SET) == TRUE)
+    {
+        s16Result = s16FIM_SetFault(u8FaultCode, u8SrvID);
+        vFIM_DedupForwarded(u8FaultCode, u8SrvID, FIM_DEDUP_SET, s16Result);
+    }
+
+    return (s16Result);
+}
+//** EndOfFunction s16FIM_DedupSetFault ********************************************************************************
+
+//**********************************************************************************************************************
+// Function s16FIM_DedupResetFault
+//**********************************************************************************************************************
+S16 s16FIM_DedupResetFault (U8 u8FaultCode, U8 u8SrvID)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Result = KB_RET_OK;                                  // Function return variable
+
+//*************************************************** Function code ****************************************************
+    if (boFIM_DedupForward(u8FaultCode, u8SrvID, FIM_DEDUP_RESET) == TRUE)
+    {
+        s16Result = s16FIM_ResetFault(u8FaultCode, u8SrvID);
+        vFIM_DedupForwarded(u8FaultCode, u8SrvID, FIM_DEDUP_RESET, s16Result);
+    }
+
+    return (s16Result);
+}
+//** EndOfFunction s16FIM_DedupResetFault ******************************************************************************
+
+//**********************************************************************************************************************
+// Function s16FIM_DedupSetToUnknownFault
+//**********************************************************************************************************************
+S16 s16FIM_DedupSetToUnknownFault (U8 u8FaultCode, U8 u8SrvID)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Result = KB_RET_OK;                                  // Function return variable
+
+//*************************************************** Function code ****************************************************
+    if (boFIM_DedupForward(u8FaultCode, u8SrvID, FIM_DEDUP_UNKNOWN) == TRUE)
+    {
+        s16Result = s16FIM_SetToUnknownFault(u8FaultCode, u8SrvID);
+        vFIM_DedupForwarded(u8FaultCode, u8SrvID, FIM_DEDUP_UNKNOWN, s16Result);
+    }
+
+    return (s16Result);
+}
+//** EndOfFunction s16FIM_DedupSetToUnknownFault ***********************************************************************
+
+//**********************************************************************************************************************
+// Function u32FIM_DedupGetSuppressed
+//**********************************************************************************************************************
+U32 u32FIM_DedupGetSuppressed (U16 u16FaultCode)
+{
+//************************************************ Function scope data *************************************************
+    U32 u32Cnt = 0U;                                            // Function return variable
+    U16 u16Code;                                                // Fault code
+
+//*************************************************** Function code ****************************************************
+    if (u16FaultCode < FIM_DEDUP_CODES)
+    {
+        u32Cnt = au32FIM_DedupSuppressed[u16FaultCode];
+    }
+    else if (u16FaultCode == FIM_DEDUP_CODES)
+    {
+        // Sum of the fault codes, no counter shared by the tasks of the monitors
+        for (u16Code = 0U; u16Code < FIM_DEDUP_CODES; u16Code++)
+        {
+            u32Cnt += au32FIM_DedupSuppressed[u16Code];
+        }
+    }
+    else
+    {
+        // Invalid fault code
+    }
+
+    return (u32Cnt);
+}
+//** EndOfFunction u32FIM_DedupGetSuppressed ***************************************************************************
+
+// Function boFIM_DedupForward
+//**********************************************************************************************************************
+//! @brief This function decides if a report is forwarded to FIM and counts the suppressed repeats.
+//!
+//! @param[in] u8FaultCode            : Fault code
+//! @param[in] u8SrvID                : Service identifier of the monitor
+//! @param[in] u8State                : Reported state
+//!
+//! @return TRUE if the report is forwarded
+//**********************************************************************************************************************
+static BOOLEAN boFIM_DedupForward (U8 u8FaultCode, U8 u8SrvID, U8 u8State)
+{
+//************************************************ Function scope data *************************************************
+    BOOLEAN boForward = TRUE;                                   // Function return variable
+
+//*************************************************** Function code ****************************************************
+    if (   (au8FIM_DedupState[u8FaultCode] == u8State)
+        && (au8FIM_DedupSrvID[u8FaultCode] == u8SrvID)
+        && (au16FIM_DedupRepeat[u8FaultCode] < FIM_DEDUP_REFRESH_CNT))
+    {
+        boForward = FALSE;
+        au16FIM_DedupRepeat[u8FaultCode]++;
+        au32FIM_DedupSuppressed[u8FaultCode]++;
+    }
+
+    return (boForward);
+}
+//** EndOfFunction boFIM_DedupForward **********************************************************************************
+
+// Function vFIM_DedupForwarded
+//**********************************************************************************************************************
+//! @brief This function keeps the state of a forwarded report.
+//!
+//! @param[in] u8FaultCode            : Fault code
+//! @param[in] u8SrvID                : Service identifier of the monitor
+//! @param[in] u8State                : Forwarded state
+//! @param[in] s16Result              : Result of FIM
+//!
+//! @return -
+//**********************************************************************************************************************
+static void vFIM_DedupForwarded (U8 u8FaultCode, U8 u8SrvID, U8 u8State, S16 s16Result)
+{
+//************************************************ Function scope data *************************************************
+
+//*************************************************** Function code ****************************************************
+    au16FIM_DedupRepeat[u8FaultCode] = 0U;
+    au8FIM_DedupSrvID[u8FaultCode] = u8SrvID;
+
+    // A rejected report is forwarded again next time
+    if (s16Result == KB_RET_OK)
+    {
+        au8FIM_DedupState[u8FaultCode] = u8State;
+    }
+    else
+    {
+        au8FIM_DedupState[u8FaultCode] = FIM_DEDUP_NONE;
+    }
+}
+//** EndOfFunction vFIM_DedupForwarded *********************************************************************************
+
+// EndOfFile fim_dedup.c ***********************************************************************************************
@@ -58,6 +58,7 @@
 // 2023-01-09   J. Lulli      Coding guidelines alignment
 // 2023-03-13   P. Nikam      GenCA V07.06 adaptation changes.
 // 2023-12-13   C. Brancolini Lint Plus clean up
+// 2026-10-19   agent         FIM reports deduplicated by fim_dedup.h
 //
 //**********************************************************************************************************************
 
@@ -70,7 +71,7 @@
 #include "ios_hal_cpu04.h"
 #include "ios_cpu04_i.h"
 #include "ios_board_s.h"
-#include "fim.h"
+#include "fim_dedup.h"
 #include "ios_cpu04_s.h"
 //**************************************** Constant / macro definitions ( #define ) ************************************
 
@@ -405,7 +406,7 @@ BOOLEAN boIOS_GetBiRaw( BOOLEAN* pboInputs )
                             }
                             else
                             { // Channel Error Mode configured.
-                                (void) s16FIM_SetFault( (U8) ( u16IOS_CfgFiltBiErrCode + u16TestChannel ), IOS_ID);
+                                (void) s16FIM_DedupSetFault( (U8) ( u16IOS_CfgFiltBiErrCode + u16TestChannel ), IOS_ID);
                             }
                         }
                         else
@@ -420,7 +421,7 @@ BOOLEAN boIOS_GetBiRaw( BOOLEAN* pboInputs )
 
                         if ( boIOS_CfgFiltBiSumErr == (BOOLEAN)FALSE )
                         { // Channel Error Mode configured.
-                            (void) s16FIM_ResetFault( (U8) ( u16IOS_CfgFiltBiErrCode + u16TestChannel ), IOS_ID);
+                            (void) s16FIM_DedupResetFault( (U8) ( u16IOS_CfgFiltBiErrCode + u16TestChannel ), IOS_ID);
                         }
                     }
                 }
@@ -432,7 +433,7 @@ BOOLEAN boIOS_GetBiRaw( BOOLEAN* pboInputs )
                 if ( boIOS_CfgFiltBiSumErr == (BOOLEAN)FALSE )
                 {
                     // Set error UNKOWN
-                    (void) s16FIM_SetToUnknownFault( (U8) ( u16IOS_CfgFiltBiErrCode + u16TestChannel ), IOS_ID);
+                    (void) s16FIM_DedupSetToUnknownFault( (U8) ( u16IOS_CfgFiltBiErrCode + u16TestChannel ), IOS_ID);
                 }
             }
             // Handling of channel number, flags and Sum Error Mode ------------------
@@ -458,14 +459,14 @@ BOOLEAN boIOS_GetBiRaw( BOOLEAN* pboInputs )
                         boIOS_BiSetUnknownError = FALSE;
                         if ( u32IOS_BiErrorSet != 0U )
                         {
-                            (void) s16FIM_SetFault( (U8) u16IOS_CfgFiltBiErrCode, IOS_ID);
+                            (void) s16FIM_DedupSetFault( (U8) u16IOS_CfgFiltBiErrCode, IOS_ID);
                         }
                         else
                         {
                             // If no FI input error or error BI-FI to be set is different
                             if( (u32IOS_FiBinErrorSet == 0U) || (u16IOS_CfgFiltBiErrCode != u16IOS_CfgFiltFiErrCode) )
                             {
-                                (void) s16FIM_ResetFault( (U8) u16IOS_CfgFiltBiErrCode, IOS_ID);
+                                (void) s16FIM_DedupResetFault( (U8) u16IOS_CfgFiltBiErrCode, IOS_ID);
                             }
                         }
                     }
@@ -478,7 +479,7 @@ BOOLEAN boIOS_GetBiRaw( BOOLEAN* pboInputs )
                                 (u16IOS_CfgFiltBiErrCode != u16IOS_CfgFiltFiErrCode))
                         {
                             // Set error UNKOWN
-                            (void) s16FIM_SetToUnknownFault( (U8) u16IOS_CfgFiltBiErrCode, IOS_ID);
+                            (void) s16FIM_DedupSetToUnknownFault( (U8) u16IOS_CfgFiltBiErrCode, IOS_ID);
                         }
                     }
                 }
@@ -603,7 +604,7 @@ BOOLEAN boIOS_GetFIBinRaw( BOOLEAN* pboInputs )
                             }
                             else
                             { // Channel Error Mode configured.
-                                (void) s16FIM_SetFault( (U8) ( u16IOS_CfgFiltFiErrCode + u16TestChannel ), IOS_ID);
+                                (void) s16FIM_DedupSetFault( (U8) ( u16IOS_CfgFiltFiErrCode + u16TestChannel ), IOS_ID);
                             }
                         }
                         else
@@ -618,7 +619,7 @@ BOOLEAN boIOS_GetFIBinRaw( BOOLEAN* pboInputs )
 
                         if ( boIOS_CfgFiltFiSumErr == (BOOLEAN)FALSE )
                         { // Channel Error Mode configured.
-                          (void) s16FIM_ResetFault( (U8) ( u16IOS_CfgFiltFiErrCode + u16TestChannel ), IOS_ID);
+                          (void) s16FIM_DedupResetFault( (U8) ( u16IOS_CfgFiltFiErrCode + u16TestChannel ), IOS_ID);
                         }
                     }
                 }
@@ -630,7 +631,7 @@ BOOLEAN boIOS_GetFIBinRaw( BOOLEAN* pboInputs )
                 if ( boIOS_CfgFiltFiSumErr == (BOOLEAN)FALSE )
                 {
                     // Set error UNKOWN
-                    (void) s16FIM_SetToUnknownFault( (U8) ( u16IOS_CfgFiltFiErrCode + u16TestChannel ), IOS_ID);
+                    (void) s16FIM_DedupSetToUnknownFault( (U8) ( u16IOS_CfgFiltFiErrCode + u16TestChannel ), IOS_ID);
                 }
             }
 
@@ -656,14 +657,14 @@ BOOLEAN boIOS_GetFIBinRaw( BOOLEAN* pboInputs )
                         boIOS_FiBinSetUnknownError = FALSE;
                         if ( u32IOS_FiBinErrorSet != 0U )
                         {
-                            (void) s16FIM_SetFault( (U8) u16IOS_CfgFiltFiErrCode, IOS_ID);
+                            (void) s16FIM_DedupSetFault( (U8) u16IOS_CfgFiltFiErrCode, IOS_ID);
                         }
                         else
                         {
                             // If no BI input error or error BI-FI to be set is different
                             if ( ( u32IOS_BiErrorSet == 0U ) || ( u16IOS_CfgFiltBiErrCode != u16IOS_CfgFiltFiErrCode ) )
                             {
-                                (void) s16FIM_ResetFault( (U8) u16IOS_CfgFiltFiErrCode, IOS_ID);
+                                (void) s16FIM_DedupResetFault( (U8) u16IOS_CfgFiltFiErrCode, IOS_ID);
                             }
                         }
                     }
@@ -676,7 +677,7 @@ BOOLEAN boIOS_GetFIBinRaw( BOOLEAN* pboInputs )
                                 (u16IOS_CfgFiltBiErrCode != u16IOS_CfgFiltFiErrCode))
                         {
                             // Set error UNKOWN
-                            (void) s16FIM_SetToUnknownFault( (U8) u16IOS_CfgFiltFiErrCode, IOS_ID);
+                            (void) s16FIM_DedupSetToUnknownFault( (U8) u16IOS_CfgFiltFiErrCode, IOS_ID);
                         }
                     }
                 }
@@ -977,12 +978,12 @@ static void vIOSBIFMNInit ( U16 u16Channel )
     {
         // Configuration flag at TRUE,
         // use u16IOS_CfgFiltBiErrCode for all channels
-        (void) s16FIM_SetToUnknownFault( (U8) u16IOS_CfgFiltBiErrCode, IOS_ID);
+        (void) s16FIM_DedupSetToUnknownFault( (U8) u16IOS_CfgFiltBiErrCode, IOS_ID);
     }
     else
     {    // Configuration flag at FALSE,
          // calculate error number for single channel (u16IOS_CfgFiltBiErrCode + u16Channel)
-        (void) s16FIM_SetToUnknownFault( (U8)(u16IOS_CfgFiltBiErrCode + u16Channel), IOS_ID);
+        (void) s16FIM_DedupSetToUnknownFault( (U8)(u16IOS_CfgFiltBiErrCode + u16Channel), IOS_ID);
     }
 
 }
@@ -1013,13 +1014,13 @@ static void vIOSFIBinFMNInit ( U16 u16Channel )
     {
         // Configuration flag at TRUE,
         // use boIOS_CfgFiltFiSumErr for all channels
-        (void) s16FIM_SetToUnknownFault( (U8) u16IOS_CfgFiltFiErrCode, IOS_ID);
+        (void) s16FIM_DedupSetToUnknownFault( (U8) u16IOS_CfgFiltFiErrCode, IOS_ID);
     }
     else
     {
         // Configuration flag at FALSE,
         // calculate error number for single channel (u16IOS_CfgFiltFiErrCode + u16Channel)
-        (void) s16FIM_SetToUnknownFault( (U8)(u16IOS_CfgFiltFiErrCode + u16Channel), IOS_ID);
+        (void) s16FIM_DedupSetToUnknownFault( (U8)(u16IOS_CfgFiltFiErrCode + u16Channel), IOS_ID);
     }
 
 }
@@ -0,0 +1,213 @@
+//**********************************************************************************************************************
+//
+//                                          mon_sdi_batch.c
+//
+//**********************************************************************************************************************
+//
+//                                    Copyrights(c) 2026 by KNORR-BREMSE,
+//                                       Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date    2026-10-19
+//! @author  agent
+//
+//**********************************************************************************************************************
+//!
+//! @file
+//! @brief  Service Monitor for project ESRA
+//!         Module contains the function to execute several MON commands in one SDI command. The commands are
+//!         executed in one scheduling pass of SDI, their responses are packed into one response.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date            Author              Changes
+// 2026-10-19      agent               Start
+// 2026-10-19      agent               Responses built in place by mon_sdi_resp
+// 2026-10-19      agent               MON_SDI_READ_DIGIO_PORTS allowed
+// 2026-10-19      agent               Only reading commands allowed, each command gets the rest of the response
+// 2026-10-19      agent               MON_SDI_READ_FIM_SUPPR allowed
+// 2026-10-19      agent               Errors of a command returned, only a response that did not fit ends the batch
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "mon_cpu04_genrl_sdi_i.h"    // MON CPU04 SDI command handler
+#include "mon_cpu04.h"                // MON CPU04 definitions
+#include "mon.h"                      // MON SDI definitions
+#include "mon_sdi_resp.h"             // MON SDI response builder
+#include "sdi.h"                      // Error Codes
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Command MON_SDI_BATCH:
+//!   command, number of commands N, N times: length L of the command (1), command (L bytes, MON command identifier
+//!   first like a single command).
+//! Response:
+//!   status, number of executed commands M, M times: length of the response (1), response (without the leading
+//!   byte of a single response).
+//! The commands are executed in order, each command gets the rest of the response as maximum response length. A
+//! command whose response does not fit answers MON_SDI_RANGE_ERROR. A command other than the first one that answers
+//! it while the rest is shorter than MON_MSGMAXLEN is executed again with MON_MSGMAXLEN: if it succeeds then, it ran
+//! out of space, it is not counted and the batch ends. Every other error is part of the response. If M < N, the
+//! remaining commands have to be sent again.
+//! Only reading commands are allowed, so a command may be executed again without side effects.
+#define MON_SDI_BATCH_RESP_HDR_LEN    ((U16) 2U)
+
+//**************************************** Type definitions ( typedef ) ************************************************
+//! Command handler
+typedef s16SDI_CMD((*T_MON_SDI_BATCH_FCT));
+
+//! Command of the batch table
+typedef struct
+{
+    U8 u8CmdID;                           //!< MON command identifier
+    T_MON_SDI_BATCH_FCT pfCmd;            //!< Command handler
+} C_MON_SDI_BATCH_CMD;
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+
+//**************************************** Module global constants ( static const ) ************************************
+//! MON commands allowed in a batch
+static const C_MON_SDI_BATCH_CMD acMON_SDI_BatchCmd[] =
+{
+    { (U8) MON_SDI_READ_DIGIO_BYTE,  s16MON_ReadDigioByte  },
+    { (U8) MON_SDI_READ_PSDIO,       s16MON_ReadPSDIO      },
+    { (U8) MON_SDI_READ_PWM,         s16MON_ReadPWM        },
+    { (U8) MON_SDI_READ_NVM_STAT,    s16MON_ReadNvmStat    },
+    { (U8) MON_SDI_READ_DSM_STATE,   s16MON_ReadDsmState   },
+    { (U8) MON_SDI_READ_DIGIO_PORTS, s16MON_ReadDigioPorts },
+    { (U8) MON_SDI_READ_FIM_SUPPR,   s16MON_ReadFimSuppr   }
+};
+
+//! Number of commands allowed in a batch
+#define MON_SDI_BATCH_CMDS  ((U8)(sizeof(acMON_SDI_BatchCmd) / sizeof(C_MON_SDI_BATCH_CMD)))
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_Batch
+//
+//**********************************************************************************************************************
+s16SDI_CMD(s16MON_Batch)
+{
+//************************************************ Function scope data *************************************************
+    C_MON_RESP cResp;                     // SDI response
+    U8* pu8Done = KB_NULL_PTR;            // Number of executed commands in the response
+    U8* pu8Sub;                           // Response of the current command
+    U16 u16CmdIndex;                      // Index of the current command
+    U8  u8Cmds;                           // Number of commands
+    U8  u8Done = 0U;                      // Number of executed commands
+    U8  u8Cnt;                            // counting variable
+    U8  u8Fct;                            // Index in acMON_SDI_BatchCmd
+    S16 s16RespLen;                       // Response length of a command
+    S16 s16FullLen;                       // Response length of a command executed with MON_MSGMAXLEN
+    U8  au8Full[MON_MSGMAXLEN];           // Response of a command executed with MON_MSGMAXLEN
+    U16 u16Free;                          // Rest of the response
+    BOOLEAN boFull = FALSE;               // Rest of the response too short for the current command
+
+//*************************************************** Function code ****************************************************
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+
+    u8Cmds = pu8DataIn[MON_SDI_INDEX_1];
+
+    // Check the frame: the commands have to fill the command exactly
+    u16CmdIndex = MON_SDI_INDEX_2;
+    for (u8Cnt = 0U; (u8Cnt < u8Cmds) && (u16CmdIndex < u16CmdLenIn); u8Cnt++)
+    {
+        if (pu8DataIn[u16CmdIndex] == 0U)
+        {
+            u16CmdIndex = (U16)(u16CmdLenIn + 1U); // empty command
+        }
+        else
+        {
+            u16CmdIndex = (U16)(u16CmdIndex + 1U + pu8DataIn[u16CmdIndex]);
+        }
+    }
+
+    if ((u16CmdLenIn < (U16) MON_SDI_BATCH_LEN) || (u8Cnt != u8Cmds) || (u16CmdIndex != u16CmdLenIn) ||
+        (u16MaxRespOut < (MON_SDI_INDEX_1 + MON_SDI_BATCH_RESP_HDR_LEN)))
+    { //Command length invalid
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
+    }
+    else
+    {
+        vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
+        pu8Done = pu8MON_RespReserve(&cResp, 1U); // set at the end
+        u16CmdIndex = MON_SDI_INDEX_2;
+
+        // Length byte and status of a command
+        while ((u8Done < u8Cmds) && (boFull == FALSE) && (u16MON_RespFree(&cResp) > (U16) MON_SDI_INDEX_1))
+        {
+            pu8Sub = pu8MON_RespReserve(&cResp, 0U);
+            u16Free = u16MON_RespFree(&cResp);
+
+            for (u8Fct = 0U; (u8Fct < MON_SDI_BATCH_CMDS) &&
+                             (acMON_SDI_BatchCmd[u8Fct].u8CmdID != pu8DataIn[u16CmdIndex + 1U]); u8Fct++)
+            {
+                // Search the command
+            }
+
+            if (u8Fct < MON_SDI_BATCH_CMDS)
+            {
+                // The command writes its response behind the length byte, its leading byte is the length byte
+                s16RespLen = acMON_SDI_BatchCmd[u8Fct].pfCmd(&pu8DataIn[u16CmdIndex + 1U],
+                                                             (U16) pu8DataIn[u16CmdIndex],
+                                                             pu8Sub,
+                                                             u16Free);
+            }
+            else
+            {
+                pu8Sub[MON_SDI_INDEX_1] = MON_SDI_INVALID_COMMAND;
+                s16RespLen = (S16)(MON_SDI_INDEX_1 + 1U);
+            }
+
+            if (s16RespLen < (S16) MON_SDI_INDEX_1)
+            {
+                s16RespLen = (S16) MON_SDI_INDEX_1;
+            }
+
+            if ((u8Done > 0U) && (u16Free < (U16) MON_MSGMAXLEN) && (u8Fct < MON_SDI_BATCH_CMDS) &&
+                (s16RespLen > (S16) MON_SDI_INDEX_1) && (pu8Sub[MON_SDI_INDEX_1] == MON_SDI_RANGE_ERROR))
+            {
+                // Out of space or a range error of the command: only out of space if it succeeds with the full length
+                s16FullLen = acMON_SDI_BatchCmd[u8Fct].pfCmd(&pu8DataIn[u16CmdIndex + 1U],
+                                                             (U16) pu8DataIn[u16CmdIndex],
+                                                             au8Full,
+                                                             (U16) MON_MSGMAXLEN);
+                if ((s16FullLen > (S16) MON_SDI_INDEX_1) && (au8Full[MON_SDI_INDEX_1] != MON_SDI_RANGE_ERROR))
+                {
+                    // The command is sent again with the next batch
+                    boFull = TRUE;
+                }
+            }
+
+            if (boFull == FALSE)
+            {
+                pu8Sub[0] = (U8)((U16) s16RespLen - MON_SDI_INDEX_1);
+                (void) pu8MON_RespReserve(&cResp, (U16) s16RespLen);
+
+                u16CmdIndex = (U16)(u16CmdIndex + 1U + pu8DataIn[u16CmdIndex]);
+                u8Done++;
+            }
+        }
+
+        if (pu8Done != KB_NULL_PTR)
+        {
+            *pu8Done = u8Done;
+        }
+    }
+
+    return (s16MON_RespEnd(&cResp)); // return reply len
+}
+//  EndOfFunction s16MON_Batch *****************************************************************************************
+
+//  EndOfFile mon_sdi_batch.c ******************************************************************************************
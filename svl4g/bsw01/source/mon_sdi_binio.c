@@ -43,18 +43,19 @@
 // 20.04.17        A. Mauro            1.7    TC_007-96: LINT clean up
 // 2023.09.13      A. Mauro            1.8    Alignment with CA: name changed and other
 // 2023-12-15      C. Brancolini       Lint Plus cleanup
+// 2026-10-19      agent               Responses built in place by mon_sdi_resp
+// 2026-10-19      agent               Ports read after all are configured, s16MON_ReadDigioPorts added
 //
 //**********************************************************************************************************************
 
 //**************************************** Compiler options ( #pragma ) ************************************************
 
 //**************************************** Header / include files ( #include ) *****************************************
-#include <string.h>                   // Include memcpy
-
 #include "mon_cpu04_genrl_sdi_i.h"    // MON CPU04 SDI command handler
 #include "mon_binio.h"                // MON binary IO definitions
 #include "mon_cpu04.h"                // MON CPU04 definitions
 #include "mon.h"                      // MON SDI definitions
+#include "mon_sdi_resp.h"             // MON SDI response builder
 #include "bcl_s.h"                    // General BCL service definitions
 #include "sdi.h"                      // Error Codes
 #include "bcm_strt.h"                 // BCL system interface
@@ -73,6 +74,8 @@
 
 #define MON_MAXINPORT_NO ((MON_MSGMAXLEN - 3U) / 2U) //todo: not clear
 
+#define MON_BINIO_PORTS      ((U8) 7U)     // PORT0 to PORT6, ports read by MON_SDI_READ_DIGIO_PORTS
+
 //**************************************** Type definitions ( typedef ) ************************************************
 
 //**************************************** Global data definitions *****************************************************
@@ -98,18 +101,15 @@ s16SDI_CMD(s16MON_ReadDigioByte)
     U8 u8ReqPortsCnt;                     // var to store number of ports to read
     U8 u8Mask;                            // temp var for DigIO mask
     U8 u8State;                           // temp var for DigIO state
-    C_MON_IO_BUFF cMonIOBuff;             // buffer for temp storage of io input bytes/words/lwords
-    U8* pu8IOByteBuffer = KB_NULL_PTR;    // ptr to buffer
-    U8 u8SDIRespIndex = MON_SDI_INDEX_1;  // SDI response index
+    C_MON_RESP cResp;                     // SDI response
     E_BCM_BOARD_STATE eBoardState;        // Board state
-    S16 s16RetVal;                        // Function return value
     U8* pu8Tmp;                           // Temp pointer
 
     //*************************************** Function scope static data declaration ***********************************
 
     //*************************************************** Function code ************************************************
 
-    (void)u16MaxRespOut; // unused parameter
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
 
     // Check Board State:
     eBoardState = eBCM_StrtGetBoardState();
@@ -125,23 +125,20 @@ s16SDI_CMD(s16MON_ReadDigioByte)
         if (u8ReqPortsCnt > MON_MAXINPORT_NO)
         {
             // too big - reply with RANGE_ERROR
-            pu8DataOut[u8SDIRespIndex] = MON_SDI_RANGE_ERROR;
-            u8SDIRespIndex++;
-            return ((S16)u8SDIRespIndex);
+            return (s16MON_RespError(&cResp, MON_SDI_RANGE_ERROR));
         }
 
         if( u16CmdLenIn != (((U16)u8ReqPortsCnt * MON_INPORT_PARA_LEN) + MON_SDI_PAR_OFFSET) )
         {
             // Command length invalid
-            pu8DataOut[u8SDIRespIndex] = MON_SDI_INVALID_COMMAND;
-            u8SDIRespIndex++;
+            vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
         }
         else
         {
             // Command length valid
             pu8Tmp = pu8DataIn + MON_SDI_PAR_OFFSET;    // setup ptr to port numbers
-            pu8IOByteBuffer = &(cMonIOBuff.au8Data[0]); // setup ptr to result buffer
 
+            // Configure all IO channels for reading first, then the ports are read in one pass
             for (u8Cnt = 0; u8Cnt < u8ReqPortsCnt; u8Cnt++)
             {
                 // Try to init IO channel for reading
@@ -152,43 +149,35 @@ s16SDI_CMD(s16MON_ReadDigioByte)
                      MON_DUMMY_OUTPUT_VAL) == (BOOLEAN)FALSE)
                 {
                     // channel error
-                    pu8DataOut[u8SDIRespIndex] = MON_SDI_CHANNEL_ERROR;
-                    u8SDIRespIndex++;
-                    return ((S16)u8SDIRespIndex);
+                    return (s16MON_RespError(&cResp, MON_SDI_CHANNEL_ERROR));
                 }
-                (void) boMON_GetBinIOChannels( pu8Tmp[MON_INPUT_PORT_NUM], &u8Mask, &u8State );
-                // read bin io channels
-                *pu8IOByteBuffer = u8State & pu8Tmp[MON_INPUT_PORT_MASK];
-                pu8IOByteBuffer++;
-                // put read bytes into buffer
                 // switch to next port number
                 pu8Tmp = pu8Tmp + MON_INPORT_PARA_LEN;
             }
 
-            // No error so far, prepare reply message
-            pu8DataOut[u8SDIRespIndex] = MON_SDI_NO_ERROR; // no error
-            u8SDIRespIndex++;
+            // Reply message
+            vMON_RespU8(&cResp, MON_SDI_NO_ERROR); // no error
+            vMON_RespU8(&cResp, u8ReqPortsCnt);
 
-            pu8DataOut[u8SDIRespIndex] = u8ReqPortsCnt;
-            u8SDIRespIndex++;
-
-            // copy buffer to reply message
-            memcpy((void *) (pu8DataOut + u8SDIRespIndex),
-                   (const void *) cMonIOBuff.au8Data, u8ReqPortsCnt);
-            u8SDIRespIndex = (u8SDIRespIndex + u8ReqPortsCnt); // reply message length
+            pu8Tmp = pu8DataIn + MON_SDI_PAR_OFFSET;
+            for (u8Cnt = 0; u8Cnt < u8ReqPortsCnt; u8Cnt++)
+            {
+                (void) boMON_GetBinIOChannels( pu8Tmp[MON_INPUT_PORT_NUM], &u8Mask, &u8State );
+                // read bin io channels, put read byte into reply message
+                vMON_RespU8(&cResp, (U8)(u8State & pu8Tmp[MON_INPUT_PORT_MASK]));
+                // switch to next port number
+                pu8Tmp = pu8Tmp + MON_INPORT_PARA_LEN;
+            }
         }
     }
     else
     {
         // Board not in test mode:
         // reply invalid command
-        u8SDIRespIndex = MON_SDI_INDEX_1;
-        pu8DataOut[u8SDIRespIndex] = MON_SDI_INVALID_COMMAND;
-        u8SDIRespIndex++;
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
     }
-    s16RetVal = (S16) (u8SDIRespIndex );
     // return reply message length
-    return (s16RetVal);
+    return (s16MON_RespEnd(&cResp));
 
 }
 //  EndOfFunction s16MON_ReadDigioByte *********************************************************************************
@@ -202,14 +191,13 @@ s16SDI_CMD(s16MON_WriteDigioByte)
 //************************************************ Function scope data *********************************************
     U8 u8Cnt;                             // counting variable
     U8 u8PortsCnt;                        // variable to store number of ports to write
-    U8 u8SDIRespIndex = MON_SDI_INDEX_1;  // SDI reply index
+    C_MON_RESP cResp;                     // SDI reply
     U8 u8SDICmdIndex = MON_SDI_INDEX_1;   // SDI command index
     E_BCM_BOARD_STATE eBoardState;        // Board state
-    S16 s16RetVal;                        // Function return value
     U8* pu8Tmp;                           // Temporary pointer
 
 //*************************************************** Function code ************************************************
-    (void)u16MaxRespOut; // unused parameter
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
 
     // Get Board State
     eBoardState = eBCM_StrtGetBoardState();
@@ -226,18 +214,15 @@ s16SDI_CMD(s16MON_WriteDigioByte)
         if (u8PortsCnt > MON_MAXOUTPORT_NO)
         {
             // too big - reply with RANGE_ERROR
-            pu8DataOut[u8SDIRespIndex] = MON_SDI_RANGE_ERROR;
-            u8SDIRespIndex++;
             // return reply message length
-            return ((S16)u8SDIRespIndex);
+            return (s16MON_RespError(&cResp, MON_SDI_RANGE_ERROR));
         }
 
         // Check command length
         if( u16CmdLenIn != (((U16)u8PortsCnt * MON_OUTPORT_PARA_LEN) + MON_SDI_PAR_OFFSET) )
         {
             //Command length invalid - reply with INVALID_COMMAND
-            pu8DataOut[u8SDIRespIndex] = MON_SDI_INVALID_COMMAND;
-            u8SDIRespIndex++;
+            vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
         }
         else
         {
@@ -256,31 +241,93 @@ s16SDI_CMD(s16MON_WriteDigioByte)
                     pu8Tmp[MON_OUTPUT_PORT_VALUE] ) == (BOOLEAN)FALSE )         // i/o-channel value
                 {
                     // failed to initialize the channel - reply with CHANNEL_ERROR
-                    pu8DataOut[u8SDIRespIndex] = MON_SDI_CHANNEL_ERROR;
-                    u8SDIRespIndex++;
                     // return reply message length
-                    return ((S16)u8SDIRespIndex);
+                    return (s16MON_RespError(&cResp, MON_SDI_CHANNEL_ERROR));
                 }
                 // switch to next port number
                 pu8Tmp = pu8Tmp + MON_OUTPORT_PARA_LEN;
             }
 
             // request is done properly - reply with NO_ERROR
-            pu8DataOut[u8SDIRespIndex] = MON_SDI_NO_ERROR;
-            u8SDIRespIndex++;
+            vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
         }
     }
     else
     {
         // The board is not in test mode - reply with INVALID_COMMAND
-        u8SDIRespIndex = MON_SDI_INDEX_1;
-        pu8DataOut[u8SDIRespIndex] = MON_SDI_INVALID_COMMAND;
-        u8SDIRespIndex++;
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
     }
-    s16RetVal = (S16) u8SDIRespIndex;
     // Return the length of the reply message
-    return (s16RetVal);
+    return (s16MON_RespEnd(&cResp));
 }
 //  EndOfFunction s16MON_WriteDigioByte ********************************************************************************
 
+//**********************************************************************************************************************
+//
+// Function s16MON_ReadDigioPorts
+//**********************************************************************************************************************
+s16SDI_CMD(s16MON_ReadDigioPorts)
+{
+//************************************************ Function scope data *********************************************
+    U8 u8Port;                            // port number
+    U8 u8Ports;                           // bitmap of the ports to read
+    U8 au8Mask[MON_BINIO_PORTS];          // input configuration of the ports
+    U8 au8State[MON_BINIO_PORTS];         // state of the ports
+    C_MON_RESP cResp;                     // SDI reply
+
+//*************************************************** Function code ************************************************
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+
+    if (eBCM_StrtGetBoardState() != eBCM_BS_TEST)
+    {
+        // The board is not in test mode - reply with INVALID_COMMAND
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+    }
+
+    if (u16CmdLenIn != (U16) MON_SDI_READ_DIGIO_PORTS_LEN)
+    {
+        //Command length invalid - reply with INVALID_COMMAND
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+    }
+
+    // get bitmap of the ports to read, bit n is port n
+    u8Ports = pu8DataIn[MON_SDI_INDEX_1];
+    if ((u8Ports >> MON_BINIO_PORTS) != 0U)
+    {
+        // unknown port - reply with RANGE_ERROR
+        return (s16MON_RespError(&cResp, MON_SDI_RANGE_ERROR));
+    }
+
+    // read the ports in one pass, the configuration is not changed
+    for (u8Port = 0U; u8Port < MON_BINIO_PORTS; u8Port++)
+    {
+        if ((u8Ports & (U8)(1U << u8Port)) != 0U)
+        {
+            au8Mask[u8Port] = 0U;
+            au8State[u8Port] = 0U;
+            if (boMON_GetBinIOChannels(u8Port, &au8Mask[u8Port], &au8State[u8Port]) == (BOOLEAN)FALSE)
+            {
+                // port not available on this board - reply with CHANNEL_ERROR
+                return (s16MON_RespError(&cResp, MON_SDI_CHANNEL_ERROR));
+            }
+        }
+    }
+
+    // Reply message: status, bitmap, for each port read: input configuration, state
+    vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
+    vMON_RespU8(&cResp, u8Ports);
+    for (u8Port = 0U; u8Port < MON_BINIO_PORTS; u8Port++)
+    {
+        if ((u8Ports & (U8)(1U << u8Port)) != 0U)
+        {
+            vMON_RespU8(&cResp, au8Mask[u8Port]);
+            vMON_RespU8(&cResp, au8State[u8Port]);
+        }
+    }
+
+    // Return the length of the reply message
+    return (s16MON_RespEnd(&cResp));
+}
+//  EndOfFunction s16MON_ReadDigioPorts ********************************************************************************
+
 //  EndOfFile MON_SDI_BINIO.C ******************************************************************************************
@@ -0,0 +1,651 @@
+//**********************************************************************************************************************
+//
+//                                          mon_sdi_daq.c
+//
+//**********************************************************************************************************************
+//
+//                                    Copyrights(c) 2026 by KNORR-BREMSE,
+//                                       Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date    2026-10-19
+//! @author  agent
+//
+//**********************************************************************************************************************
+//!
+//! @file
+//! @brief  Service Monitor for project ESRA
+//!         Module contains the data acquisition of internal variables: the armed variables are sampled by the board
+//!         in a 1 ms time slice into a ring buffer until a trigger condition is met and the post trigger samples
+//!         are taken. The tester downloads the recording in blocks afterwards.
+//!         While the recording runs, the time slice writes the buffer and the recording state; the SDI process
+//!         changes them only while the time slice is deactivated.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date            Author              Changes
+// 2026-10-19      agent               Start
+// 2026-10-19      agent               Address ranges shared with the memory dump (acMON_RamArea)
+// 2026-10-19      agent               Recording only in test mode, sample buffer 16 KiB -> 4 KiB
+// 2026-10-19      agent               Period counted from the first sample
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "mon_cpu04_genrl_sdi_i.h"    // MON CPU04 SDI command handler
+#include "mon_cpu04.h"                // MON CPU04 definitions, readable address ranges
+#include "mon.h"                      // MON SDI definitions
+#include "mon_sdi_resp.h"             // MON SDI response builder
+#include "os.h"                       // Time slices, time
+#include "sdi.h"                      // Error Codes
+#include "bcm_strt.h"                 // BCL system interface
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Command MON_SDI_DAQ_ARM:
+//!   command, period in ms (2), post trigger samples (2), trigger variable (1), trigger condition (MON_DAQ_TRIG_xxx),
+//!   trigger threshold (4), number of variables N, N times: address (4), size (1, 2 or 4).
+//!   The variables have to lie in an address range of acMON_RamArea and be aligned to their size. The trigger
+//!   variable is an index in the N variables, its value is compared unsigned with the threshold.
+//!   Until the trigger, the buffer keeps the newest samples (pre trigger history). The recording ends when the post
+//!   trigger samples, including the trigger sample, are taken.
+//!   N = 0 ends a running recording, the samples taken so far can be read.
+//! Response:
+//!   status, length of a sample.
+//!
+//! Command MON_SDI_DAQ_STATE:
+//!   command.
+//! Response:
+//!   status, state (MON_DAQ_xxx), number of samples (2), index of the trigger sample (2, 0xFFFF: no trigger),
+//!   length of a sample.
+//!
+//! Command MON_SDI_DAQ_READ:
+//!   command, index of the first sample (2), index 0 is the oldest sample.
+//! Response:
+//!   status, index of the first sample (2), length of a sample, number of samples M, M samples: time in ms (4),
+//!   value of each variable in the order of MON_SDI_DAQ_ARM (size bytes).
+//!   The samples are read as many as fit into the response, only while no recording runs.
+//! Multi byte values are big endian.
+#define MON_DAQ_TRIG_NONE             ((U8) 0)     //!< Trigger on the first sample
+#define MON_DAQ_TRIG_ABOVE            ((U8) 1)     //!< Value greater than the threshold
+#define MON_DAQ_TRIG_BELOW            ((U8) 2)     //!< Value less than the threshold
+#define MON_DAQ_TRIG_EQUAL            ((U8) 3)     //!< Value equal to the threshold
+#define MON_DAQ_TRIG_CHANGE           ((U8) 4)     //!< Value different from the previous sample
+
+#define MON_DAQ_IDLE                  ((U8) 0)     //!< No recording
+#define MON_DAQ_ARMED                 ((U8) 1)     //!< Recording, waiting for the trigger
+#define MON_DAQ_TRIGGERED             ((U8) 2)     //!< Recording the post trigger samples
+#define MON_DAQ_DONE                  ((U8) 3)     //!< Recording ended, can be read
+
+#define MON_DAQ_ARM_PERIOD_POS        1U           //!< Position of the period in MON_SDI_DAQ_ARM
+#define MON_DAQ_ARM_POST_POS          3U           //!< Position of the post trigger samples in MON_SDI_DAQ_ARM
+#define MON_DAQ_ARM_TRIG_ITEM_POS     5U           //!< Position of the trigger variable in MON_SDI_DAQ_ARM
+#define MON_DAQ_ARM_TRIG_COND_POS     6U           //!< Position of the trigger condition in MON_SDI_DAQ_ARM
+#define MON_DAQ_ARM_THRESHOLD_POS     7U           //!< Position of the trigger threshold in MON_SDI_DAQ_ARM
+#define MON_DAQ_ARM_ITEMS_POS         11U          //!< Position of the number of variables in MON_SDI_DAQ_ARM
+#define MON_DAQ_ITEM_SIZE_POS         4U           //!< Position of the size in a variable of MON_SDI_DAQ_ARM
+#define MON_DAQ_ITEM_LEN              ((U16) 5U)   //!< Length of a variable in MON_SDI_DAQ_ARM
+#define MON_DAQ_STATE_RESP_LEN        ((U16) 7U)   //!< Length of the response of MON_SDI_DAQ_STATE
+#define MON_DAQ_READ_HDR_LEN          ((U16) 5U)   //!< Status, first sample, sample length, number of samples
+#define MON_DAQ_TIME_LEN              ((U8) 4U)    //!< Length of the time of a sample
+
+#define MON_DAQ_MAX_ITEMS             ((U8) 16U)   //!< Maximum number of variables
+#define MON_DAQ_SAMPLE_MAX_LEN        ((U8) 48U)   //!< Maximum length of a sample, fits into a MON response
+#define MON_DAQ_PERIOD_MIN            ((U16) 1U)   //!< Minimum period in ms, the time slice
+#define MON_DAQ_PERIOD_MAX            ((U16) 60000U) //!< Maximum period in ms
+// Sample buffer: 85 samples of the maximum length, 512 samples of one U32 variable.
+// Static RAM of the NVM and MON extensions, placed by the linker file with the other module data (.bss):
+//   POFF shadow au32NVM_HAL_AdpPoffShadow (nvm_hal_adp.c)        8192 bytes
+//   FRAM shadow au8NVM_HAL_CFG_ShadowUsrDaba (cfg_nvm_hal.c)      544 bytes
+//   Transaction staging au32NVM_TxnBody (nvm_txn.c)             < 2048 bytes
+//   Subscription frames au8MON_SubBuff (mon_sdi_sub.c)           1024 bytes
+//   Recording au8MON_DaqBuff and acMON_DaqItem (this file)       4224 bytes
+//   Memory dump (mon_sdi_dump.c)                                 no buffer, 130 bytes stack in u16MON_DumpRle
+// About 16 KiB in total, a quarter of the 64 KiB internal SRAM of the MPC5534 if the linker file does not place
+// the module data in the external PSRAM.
+#define MON_DAQ_BUFF_SIZE             ((U16) 4096U) //!< Size of the sample buffer
+#define MON_DAQ_NO_TRIGGER            ((U16) 0xFFFFU) //!< Index of the trigger sample: no trigger
+
+//**************************************** Type definitions ( typedef ) ************************************************
+//! Recorded variable
+typedef struct
+{
+    const U8* pu8Addr;                    //!< Address
+    U8  u8Size;                           //!< Size in bytes: 1, 2 or 4
+} C_MON_DAQ_ITEM;
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+//! Recorded variables
+static C_MON_DAQ_ITEM acMON_DaqItem[MON_DAQ_MAX_ITEMS];
+
+//! Number of recorded variables
+static U8 u8MON_DaqItems = 0U;
+
+//! Length of a sample, 0: no recording
+static U8 u8MON_DaqSampleLen = 0U;
+
+//! Number of samples the buffer can hold
+static U16 u16MON_DaqSlots = 0U;
+
+//! Period in ms
+static U16 u16MON_DaqPeriod = 0U;
+
+//! Post trigger samples
+static U16 u16MON_DaqPost = 0U;
+
+//! Trigger variable
+static U8 u8MON_DaqTrigItem = 0U;
+
+//! Trigger condition
+static U8 u8MON_DaqTrigCond = MON_DAQ_TRIG_NONE;
+
+//! Trigger threshold
+static U32 u32MON_DaqTrigThreshold = 0U;
+
+//! Value of the trigger variable in the previous sample
+static U32 u32MON_DaqTrigPrev = 0U;
+
+//! Time of the last sample in ms
+static U32 u32MON_DaqLastTime = 0U;
+
+//! Sample buffer
+static U8 au8MON_DaqBuff[MON_DAQ_BUFF_SIZE];
+
+//! Recording state, MON_DAQ_xxx
+static volatile U8 u8MON_DaqState = MON_DAQ_IDLE;
+
+//! Next sample to write
+static volatile U16 u16MON_DaqHead = 0U;
+
+//! Number of samples in the buffer
+static volatile U16 u16MON_DaqCount = 0U;
+
+//! Samples taken since the trigger, including the trigger sample
+static volatile U16 u16MON_DaqAfterTrig = 0U;
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+static void vMON_DaqCycl1ms (void);
+static void vMON_DaqStop (void);
+static U32 u32MON_DaqGetU32 (const U8* pu8Data);
+static BOOLEAN boMON_DaqCheckItem (U32 u32Addr, U8 u8Size);
+static U32 u32MON_DaqReadItem (const C_MON_DAQ_ITEM* pcItem);
+static BOOLEAN boMON_DaqSample (U8* pu8Sample, U32 u32Now);
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_DaqArm
+//
+//**********************************************************************************************************************
+s16SDI_CMD(s16MON_DaqArm)
+{
+//************************************************ Function scope data *************************************************
+    C_MON_RESP cResp;                     // SDI response
+    U8* pu8Para;                          // Parameters of the current variable
+    U8  u8Items;                          // Number of variables
+    U8  u8Cnt;                            // counting variable
+    U8  u8SampleLen = MON_DAQ_TIME_LEN;   // Length of a sample
+    U16 u16Period;                        // Period in ms
+    U16 u16Post;                          // Post trigger samples
+    U8  u8TrigItem;                       // Trigger variable
+    U8  u8TrigCond;                       // Trigger condition
+    U32 u32Addr;                          // Address of the current variable
+    BOOLEAN boActive;                     // Time slice activated
+    U8 u8Status = MON_SDI_NO_ERROR;       // Response status
+
+//*************************************************** Function code ****************************************************
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+
+    if (eBCM_StrtGetBoardState() != eBCM_BS_TEST)
+    {
+        // The board is not in test mode - reply with INVALID_COMMAND
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+    }
+
+    u8Items = (u16CmdLenIn >= (U16) MON_SDI_DAQ_ARM_LEN) ? pu8DataIn[MON_DAQ_ARM_ITEMS_POS] : 0U;
+
+    if ((u16CmdLenIn < (U16) MON_SDI_DAQ_ARM_LEN) ||
+        (u16CmdLenIn != ((U16) MON_SDI_DAQ_ARM_LEN + ((U16) u8Items * MON_DAQ_ITEM_LEN))))
+    { //Command length invalid
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+    }
+
+    if (u8Items == 0U)
+    {
+        // End a running recording, its samples stay readable
+        if ((u8MON_DaqState == MON_DAQ_ARMED) || (u8MON_DaqState == MON_DAQ_TRIGGERED))
+        {
+            vMON_DaqStop();
+        }
+        vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
+        vMON_RespU8(&cResp, u8MON_DaqSampleLen);
+        return (s16MON_RespEnd(&cResp)); // return reply len
+    }
+
+    u16Period = (U16)(((U16) pu8DataIn[MON_DAQ_ARM_PERIOD_POS] << MON_SHIFT_VAR_BY_8) |
+                      pu8DataIn[MON_DAQ_ARM_PERIOD_POS + 1U]);
+    u16Post = (U16)(((U16) pu8DataIn[MON_DAQ_ARM_POST_POS] << MON_SHIFT_VAR_BY_8) |
+                    pu8DataIn[MON_DAQ_ARM_POST_POS + 1U]);
+    u8TrigItem = pu8DataIn[MON_DAQ_ARM_TRIG_ITEM_POS];
+    u8TrigCond = pu8DataIn[MON_DAQ_ARM_TRIG_COND_POS];
+
+    // Check the variables before the current recording is changed
+    pu8Para = &pu8DataIn[MON_SDI_DAQ_ARM_LEN];
+    for (u8Cnt = 0U; (u8Cnt < u8Items) && (u8Status == MON_SDI_NO_ERROR); u8Cnt++)
+    {
+        if (boMON_DaqCheckItem(u32MON_DaqGetU32(pu8Para), pu8Para[MON_DAQ_ITEM_SIZE_POS]) == FALSE)
+        {
+            u8Status = MON_SDI_RANGE_ERROR;
+        }
+        u8SampleLen = (U8)(u8SampleLen + pu8Para[MON_DAQ_ITEM_SIZE_POS]);
+        pu8Para = &pu8Para[MON_DAQ_ITEM_LEN];
+    }
+
+    if ((u8Status != MON_SDI_NO_ERROR) || (u8Items > MON_DAQ_MAX_ITEMS) || (u8SampleLen > MON_DAQ_SAMPLE_MAX_LEN) ||
+        (u16Period < MON_DAQ_PERIOD_MIN) || (u16Period > MON_DAQ_PERIOD_MAX) || (u8TrigCond > MON_DAQ_TRIG_CHANGE) ||
+        ((u8TrigCond != MON_DAQ_TRIG_NONE) && (u8TrigItem >= u8Items)) ||
+        (u16Post == 0U) || (u16Post > (U16)(MON_DAQ_BUFF_SIZE / u8SampleLen)))
+    {
+        return (s16MON_RespError(&cResp, MON_SDI_RANGE_ERROR));
+    }
+
+    // The current recording ends, its samples are discarded
+    vMON_DaqStop();
+
+    pu8Para = &pu8DataIn[MON_SDI_DAQ_ARM_LEN];
+    for (u8Cnt = 0U; u8Cnt < u8Items; u8Cnt++)
+    {
+        u32Addr = u32MON_DaqGetU32(pu8Para);
+        // Inhibit lint note 9078 caused by address to object pointer conversion needed for memory access
+        acMON_DaqItem[u8Cnt].pu8Addr = (const U8*) u32Addr; //lint !e9078
+        acMON_DaqItem[u8Cnt].u8Size = pu8Para[MON_DAQ_ITEM_SIZE_POS];
+        pu8Para = &pu8Para[MON_DAQ_ITEM_LEN];
+    }
+
+    u8MON_DaqItems = u8Items;
+    u8MON_DaqSampleLen = u8SampleLen;
+    u16MON_DaqSlots = (U16)(MON_DAQ_BUFF_SIZE / u8SampleLen);
+    u16MON_DaqPeriod = u16Period;
+    u16MON_DaqPost = u16Post;
+    u8MON_DaqTrigItem = u8TrigItem;
+    u8MON_DaqTrigCond = u8TrigCond;
+    u32MON_DaqTrigThreshold = u32MON_DaqGetU32(&pu8DataIn[MON_DAQ_ARM_THRESHOLD_POS]);
+    u16MON_DaqHead = 0U;
+    u16MON_DaqCount = 0U;
+    u16MON_DaqAfterTrig = 0U;
+    u8MON_DaqState = MON_DAQ_ARMED;
+
+    // The first sample is taken in the next time slice
+    (void) s16OS_GetTimeMS(&u32MON_DaqLastTime);
+    u32MON_DaqLastTime -= u16Period;
+
+    // Inhibit lint warning 466 and note 9074 due to a missing void in boOS_ActivateFct declaration
+    //lint -save -e466 -e9074
+    boActive = boOS_ActivateFct(vMON_DaqCycl1ms, (U8) eOS_SLICE_1MS);
+    //lint -restore
+    if (boActive == FALSE)
+    {
+        u8MON_DaqState = MON_DAQ_IDLE;
+        u8MON_DaqSampleLen = 0U;
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+    }
+
+    vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
+    vMON_RespU8(&cResp, u8MON_DaqSampleLen);
+
+    return (s16MON_RespEnd(&cResp)); // return reply len
+}
+//  EndOfFunction s16MON_DaqArm ****************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_DaqState
+//
+//**********************************************************************************************************************
+s16SDI_CMD(s16MON_DaqState)
+{
+//************************************************ Function scope data *************************************************
+    C_MON_RESP cResp;                     // SDI response
+    U16 u16Count;                         // Number of samples
+    U16 u16AfterTrig;                     // Samples taken since the trigger
+    U8  u8State;                          // Recording state
+
+//*************************************************** Function code ****************************************************
+    (void)pu8DataIn;     // unused parameter
+
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+
+    if ((u16CmdLenIn != (U16) MON_SDI_DAQ_STATE_LEN) ||
+        (u16MaxRespOut < (MON_SDI_INDEX_1 + MON_DAQ_STATE_RESP_LEN)))
+    { //Command length invalid
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
+    }
+    else
+    {
+        // The state is read first: the counts belong to it or to a later state
+        u8State = u8MON_DaqState;
+        u16Count = u16MON_DaqCount;
+        u16AfterTrig = u16MON_DaqAfterTrig;
+
+        vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
+        vMON_RespU8(&cResp, u8State);
+        vMON_RespU16Be(&cResp, u16Count);
+        vMON_RespU16Be(&cResp, ((u16AfterTrig == 0U) || (u16AfterTrig > u16Count)) ?
+                                   MON_DAQ_NO_TRIGGER : (U16)(u16Count - u16AfterTrig));
+        vMON_RespU8(&cResp, u8MON_DaqSampleLen);
+    }
+
+    return (s16MON_RespEnd(&cResp)); // return reply len
+}
+//  EndOfFunction s16MON_DaqState **************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_DaqRead
+//
+//**********************************************************************************************************************
+s16SDI_CMD(s16MON_DaqRead)
+{
+//************************************************ Function scope data *************************************************
+    C_MON_RESP cResp;                     // SDI response
+    U8* pu8Samples;                       // Number of samples in the response
+    U8  u8Samples = 0U;                   // Number of samples
+    U16 u16First;                         // Index of the first sample
+    U16 u16Slot;                          // Buffer slot of the current sample
+
+//*************************************************** Function code ****************************************************
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+
+    if ((u16CmdLenIn != (U16) MON_SDI_DAQ_READ_LEN) ||
+        ((u8MON_DaqState != MON_DAQ_IDLE) && (u8MON_DaqState != MON_DAQ_DONE)) ||
+        (u16MaxRespOut < (MON_SDI_INDEX_1 + MON_DAQ_READ_HDR_LEN + (U16) u8MON_DaqSampleLen)))
+    { //Command length invalid or recording running
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+    }
+
+    u16First = (U16)(((U16) pu8DataIn[MON_SDI_INDEX_1] << MON_SHIFT_VAR_BY_8) | pu8DataIn[MON_SDI_INDEX_2]);
+    if (u16First >= u16MON_DaqCount)
+    {
+        return (s16MON_RespError(&cResp, MON_SDI_RANGE_ERROR));
+    }
+
+    vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
+    vMON_RespU16Be(&cResp, u16First);
+    vMON_RespU8(&cResp, u8MON_DaqSampleLen);
+    pu8Samples = pu8MON_RespReserve(&cResp, 1U); // set at the end
+
+    // The oldest sample is the one behind the newest if the buffer was overwritten
+    u16Slot = (U16)(((u16MON_DaqHead + u16MON_DaqSlots) - u16MON_DaqCount + u16First) % u16MON_DaqSlots);
+    while (((u16First + u8Samples) < u16MON_DaqCount) && (u16MON_RespFree(&cResp) >= u8MON_DaqSampleLen) &&
+           (u8Samples < 0xFFU)) // @suppress("No magic numbers")
+    {
+        vMON_RespBytes(&cResp, &au8MON_DaqBuff[u16Slot * u8MON_DaqSampleLen], u8MON_DaqSampleLen);
+        u8Samples++;
+        u16Slot = (U16)((u16Slot + 1U) % u16MON_DaqSlots);
+    }
+
+    if (pu8Samples != KB_NULL_PTR)
+    {
+        *pu8Samples = u8Samples;
+    }
+
+    return (s16MON_RespEnd(&cResp)); // return reply len
+}
+//  EndOfFunction s16MON_DaqRead ***************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function vMON_DaqCycl1ms
+//
+//**********************************************************************************************************************
+//! @brief   Takes a sample of the recorded variables when the period has elapsed, checks the trigger and ends the
+//!          recording after the post trigger samples.
+//!
+//! @return  -
+//**********************************************************************************************************************
+static void vMON_DaqCycl1ms (void)
+{
+//************************************************ Function scope data *************************************************
+    U32 u32Now = 0U;                      // Current time
+    U16 u16Head;                          // Next sample to write
+    BOOLEAN boTrigger;                    // Trigger condition met
+
+//*************************************************** Function code ****************************************************
+    (void) s16OS_GetTimeMS(&u32Now);
+    if ((u32Now - u32MON_DaqLastTime) >= u16MON_DaqPeriod)
+    {
+        // Keep the period unless the time slice was delayed by more than a period, the first sample starts it
+        u32MON_DaqLastTime += u16MON_DaqPeriod;
+        if (((u32Now - u32MON_DaqLastTime) >= u16MON_DaqPeriod) || (u16MON_DaqCount == 0U))
+        {
+            u32MON_DaqLastTime = u32Now;
+        }
+
+        // Before the trigger the oldest sample is overwritten
+        u16Head = u16MON_DaqHead;
+        boTrigger = boMON_DaqSample(&au8MON_DaqBuff[u16Head * u8MON_DaqSampleLen], u32Now);
+        u16MON_DaqHead = (U16)((u16Head + 1U) % u16MON_DaqSlots);
+        if (u16MON_DaqCount < u16MON_DaqSlots)
+        {
+            u16MON_DaqCount++;
+        }
+
+        if ((u8MON_DaqState == MON_DAQ_ARMED) && (boTrigger == TRUE))
+        {
+            u8MON_DaqState = MON_DAQ_TRIGGERED;
+        }
+
+        if (u8MON_DaqState == MON_DAQ_TRIGGERED)
+        {
+            u16MON_DaqAfterTrig++;
+            if (u16MON_DaqAfterTrig >= u16MON_DaqPost)
+            {
+                vMON_DaqStop();
+            }
+        }
+    }
+}
+//  EndOfFunction vMON_DaqCycl1ms **************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function vMON_DaqStop
+//
+//**********************************************************************************************************************
+//! @brief   Stops the sampling. A recording that has samples can be read.
+//!
+//! @return  -
+//**********************************************************************************************************************
+static void vMON_DaqStop (void)
+{
+//************************************************ Function scope data *************************************************
+
+//*************************************************** Function code ****************************************************
+    // Inhibit lint warning 466 and note 9074 due to a missing void in boOS_DeActivateFct declaration
+    //lint -save -e466 -e9074
+    (void) boOS_DeActivateFct(vMON_DaqCycl1ms, (U8) eOS_SLICE_1MS);
+    //lint -restore
+
+    if (u8MON_DaqState != MON_DAQ_IDLE)
+    {
+        u8MON_DaqState = MON_DAQ_DONE;
+    }
+}
+//  EndOfFunction vMON_DaqStop *****************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function u32MON_DaqGetU32
+//
+//**********************************************************************************************************************
+//! @brief   Returns a big endian U32 value of a command.
+//!
+//! @param[in]  pu8Data : Value in the command
+//! @return  Value
+//**********************************************************************************************************************
+static U32 u32MON_DaqGetU32 (const U8* pu8Data)
+{
+//************************************************ Function scope data *************************************************
+
+//*************************************************** Function code ****************************************************
+    return (((U32) pu8Data[0] << 24U) | ((U32) pu8Data[1] << 16U) | // @suppress("No magic numbers")
+            ((U32) pu8Data[2] << MON_SHIFT_VAR_BY_8) | (U32) pu8Data[3]);
+}
+//  EndOfFunction u32MON_DaqGetU32 *************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function boMON_DaqCheckItem
+//
+//**********************************************************************************************************************
+//! @brief   Checks that a variable lies in an address range of acMON_RamArea and is aligned to its size.
+//!
+//! @param[in]  u32Addr : Address
+//! @param[in]  u8Size : Size in bytes
+//! @return  TRUE if the variable can be recorded
+//**********************************************************************************************************************
+static BOOLEAN boMON_DaqCheckItem (U32 u32Addr, U8 u8Size)
+{
+//************************************************ Function scope data *************************************************
+    BOOLEAN boValid = FALSE;              // Function return value
+    U32 u32Start;                         // Start of the address range
+    U8  u8Area;                           // counting variable
+
+//*************************************************** Function code ****************************************************
+    if (((u8Size == 1U) || (u8Size == 2U) || (u8Size == 4U)) && ((u32Addr % u8Size) == 0U))
+    {
+        for (u8Area = 0U; (u8Area < u8MON_RamAreas) && (boValid == FALSE); u8Area++)
+        {
+            // Inhibit lint note 9078 caused by object pointer to address conversion needed for memory access
+            u32Start = (U32) acMON_RamArea[u8Area].pu8Start; //lint !e9078
+            if ((u32Addr >= u32Start) && ((u32Addr - u32Start) < acMON_RamArea[u8Area].u32Size) &&
+                ((acMON_RamArea[u8Area].u32Size - (u32Addr - u32Start)) >= u8Size))
+            {
+                boValid = TRUE;
+            }
+        }
+    }
+
+    return (boValid);
+}
+//  EndOfFunction boMON_DaqCheckItem ***********************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function u32MON_DaqReadItem
+//
+//**********************************************************************************************************************
+//! @brief   Reads the value of a variable with one access of its size.
+//!
+//! @param[in]  pcItem : Variable
+//! @return  Value
+//**********************************************************************************************************************
+static U32 u32MON_DaqReadItem (const C_MON_DAQ_ITEM* pcItem)
+{
+//************************************************ Function scope data *************************************************
+    U32 u32Value;                         // Function return value
+
+//*************************************************** Function code ****************************************************
+    // Inhibit lint note 9087 caused by the access of the variable with its size, the alignment is checked
+    if (pcItem->u8Size == 1U)
+    {
+        u32Value = *(const volatile U8*) pcItem->pu8Addr;
+    }
+    else if (pcItem->u8Size == 2U)
+    {
+        u32Value = *(const volatile U16*)(const void*) pcItem->pu8Addr; //lint !e9087
+    }
+    else
+    {
+        u32Value = *(const volatile U32*)(const void*) pcItem->pu8Addr; //lint !e9087
+    }
+
+    return (u32Value);
+}
+//  EndOfFunction u32MON_DaqReadItem ***********************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function boMON_DaqSample
+//
+//**********************************************************************************************************************
+//! @brief   Writes a sample of the recorded variables and checks the trigger condition.
+//!
+//! @param[out] pu8Sample : Sample, u8MON_DaqSampleLen bytes
+//! @param[in]  u32Now : Time of the sample in ms
+//! @return  TRUE if the trigger condition is met
+//**********************************************************************************************************************
+static BOOLEAN boMON_DaqSample (U8* pu8Sample, U32 u32Now)
+{
+//************************************************ Function scope data *************************************************
+    U8  u8Cnt;                            // counting variable
+    U8  u8Byte;                           // counting variable
+    U8  u8Idx = 0U;                       // Index in the sample
+    U32 u32Value;                         // Value of the current variable
+    BOOLEAN boTrigger = FALSE;            // Function return value
+
+//*************************************************** Function code ****************************************************
+    pu8Sample[u8Idx] = (U8)(u32Now >> 24U); // @suppress("No magic numbers")
+    u8Idx++;
+    pu8Sample[u8Idx] = (U8)(u32Now >> 16U); // @suppress("No magic numbers")
+    u8Idx++;
+    pu8Sample[u8Idx] = (U8)(u32Now >> MON_SHIFT_VAR_BY_8);
+    u8Idx++;
+    pu8Sample[u8Idx] = (U8) u32Now;
+    u8Idx++;
+
+    for (u8Cnt = 0U; u8Cnt < u8MON_DaqItems; u8Cnt++)
+    {
+        u32Value = u32MON_DaqReadItem(&acMON_DaqItem[u8Cnt]);
+        for (u8Byte = acMON_DaqItem[u8Cnt].u8Size; u8Byte > 0U; u8Byte--)
+        {
+            pu8Sample[u8Idx] = (U8)(u32Value >> ((u8Byte - 1U) * MON_SHIFT_VAR_BY_8));
+            u8Idx++;
+        }
+
+        if (u8Cnt == u8MON_DaqTrigItem)
+        {
+            if (u8MON_DaqTrigCond == MON_DAQ_TRIG_ABOVE)
+            {
+                boTrigger = (u32Value > u32MON_DaqTrigThreshold) ? TRUE : FALSE;
+            }
+            else if (u8MON_DaqTrigCond == MON_DAQ_TRIG_BELOW)
+            {
+                boTrigger = (u32Value < u32MON_DaqTrigThreshold) ? TRUE : FALSE;
+            }
+            else if (u8MON_DaqTrigCond == MON_DAQ_TRIG_EQUAL)
+            {
+                boTrigger = (u32Value == u32MON_DaqTrigThreshold) ? TRUE : FALSE;
+            }
+            else if (u8MON_DaqTrigCond == MON_DAQ_TRIG_CHANGE)
+            {
+                // Not on the first sample: there is no previous value
+                boTrigger = ((u16MON_DaqCount != 0U) && (u32Value != u32MON_DaqTrigPrev)) ? TRUE : FALSE;
+            }
+            else
+            {
+                boTrigger = TRUE;
+            }
+            u32MON_DaqTrigPrev = u32Value;
+        }
+    }
+
+    if (u8MON_DaqTrigCond == MON_DAQ_TRIG_NONE)
+    {
+        boTrigger = TRUE;
+    }
+
+    return (boTrigger);
+}
+//  EndOfFunction boMON_DaqSample **************************************************************************************
+
+//  EndOfFile mon_sdi_daq.c ********************************************************************************************
@@ -0,0 +1,212 @@
+//**********************************************************************************************************************
+//
+//                                          mon_sdi_defer.c
+//
+//**********************************************************************************************************************
+//
+//                                    Copyrights(c) 2026 by KNORR-BREMSE,
+//                                       Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date    2026-10-19
+//! @author  agent
+//
+//**********************************************************************************************************************
+//!
+//! @file
+//! @brief  Service Monitor for project ESRA
+//!         Module contains the deferred responses of MON SDI commands (see mon_sdi_defer.h).
+//!         The job is handed over between the SDI process and the 10 ms time slice by u8MON_DeferState: the data of
+//!         the job is written before the state changes to the other side.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date            Author              Changes
+// 2026-10-19      agent               Start
+// 2026-10-19      agent               MON_SDI_PENDING built by mon_sdi_resp
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include <string.h>                   // Include memcpy
+#include "kb_ret.h"                   // Global Knorr-Bremse return value definitions
+#include "os.h"                       // Time slices, time
+#include "mon_cpu04.h"                // MON CPU04 definitions
+#include "mon.h"                      // MON SDI definitions
+#include "mon_sdi_resp.h"             // MON SDI response builder
+#include "mon_sdi_defer.h"            // Own interface
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! States of the deferred job
+#define MON_DEFER_IDLE                ((U8) 0)     //!< No job
+#define MON_DEFER_BUSY                ((U8) 1)     //!< Job running in the time slice
+#define MON_DEFER_DONE                ((U8) 2)     //!< Response stored, to be collected by the SDI process
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+//! State of the deferred job
+static volatile U8 u8MON_DeferState = MON_DEFER_IDLE;
+
+//! Command of the job
+static U8 au8MON_DeferCmd[MON_DEFER_MSG_SIZE];
+
+//! Length of the command
+static U16 u16MON_DeferCmdLen = 0U;
+
+//! Response of the job
+static U8 au8MON_DeferResp[MON_DEFER_MSG_SIZE];
+
+//! Maximum length of the response
+static U16 u16MON_DeferMaxResp = 0U;
+
+//! Length of the stored response
+static U16 u16MON_DeferRespLen = 0U;
+
+//! Time the response was stored [ms]
+static U32 u32MON_DeferDoneTime = 0U;
+
+//! Step function of the job
+static T_MON_DEFER_STEP pfMON_DeferStep = KB_NULL_PTR;
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+static void vMON_DeferCycl10ms (void);
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_DeferPoll
+//
+//**********************************************************************************************************************
+S16 s16MON_DeferPoll (const U8* pu8DataIn, U16 u16CmdLenIn, U8* pu8DataOut, U16 u16MaxRespOut)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16RespLen = 0;                   // Function return value
+    U32 u32Now = 0U;                      // Current time
+    C_MON_RESP cResp;                     // Response MON_SDI_PENDING
+
+//*************************************************** Function code ****************************************************
+    if (u8MON_DeferState == MON_DEFER_BUSY)
+    {
+        vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+        vMON_RespU8(&cResp, MON_SDI_PENDING);
+        s16RespLen = s16MON_RespEnd(&cResp);
+    }
+    else if (u8MON_DeferState == MON_DEFER_DONE)
+    {
+        (void) s16OS_GetTimeMS(&u32Now);
+
+        if (   (u16CmdLenIn == u16MON_DeferCmdLen)
+            && (memcmp((const void*) pu8DataIn, (const void*) au8MON_DeferCmd, (size_t) u16CmdLenIn) == 0)
+            && (u16MON_DeferRespLen <= u16MaxRespOut)
+            && ((u32Now - u32MON_DeferDoneTime) < MON_DEFER_RESULT_TIMEOUT))
+        {
+            memcpy((void*) pu8DataOut, (const void*) au8MON_DeferResp, (size_t) u16MON_DeferRespLen);
+            s16RespLen = (S16) u16MON_DeferRespLen;
+        }
+        // The response is collected, or it is outdated or belongs to another command: the job ends
+        u8MON_DeferState = MON_DEFER_IDLE;
+    }
+    else
+    {
+        // No job
+    }
+
+    return (s16RespLen);
+}
+//  EndOfFunction s16MON_DeferPoll *************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_DeferStart
+//
+//**********************************************************************************************************************
+S16 s16MON_DeferStart (const U8* pu8DataIn, U16 u16CmdLenIn, U16 u16MaxRespOut, T_MON_DEFER_STEP pfStep)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16RetVal = KB_RET_OK;            // Function return value
+    BOOLEAN boActivated;                  // Time slice activated
+
+//*************************************************** Function code ****************************************************
+    if ((pu8DataIn == KB_NULL_PTR) || (pfStep == KB_NULL_PTR) || (u16CmdLenIn > MON_DEFER_MSG_SIZE))
+    {
+        s16RetVal = KB_RET_ERR_ARG;
+    }
+    else if (u8MON_DeferState != MON_DEFER_IDLE)
+    {
+        s16RetVal = KB_RET_ERR_RESOURCE;
+    }
+    else
+    {
+        memcpy((void*) au8MON_DeferCmd, (const void*) pu8DataIn, (size_t) u16CmdLenIn);
+        u16MON_DeferCmdLen = u16CmdLenIn;
+        u16MON_DeferMaxResp = (u16MaxRespOut < MON_DEFER_MSG_SIZE) ? u16MaxRespOut : MON_DEFER_MSG_SIZE;
+        u16MON_DeferRespLen = 0U;
+        pfMON_DeferStep = pfStep;
+        u8MON_DeferState = MON_DEFER_BUSY;
+
+        // Inhibit lint warning 466 and note 9074 due to a missing void in boOS_ActivateFct declaration
+        //lint -save -e466 -e9074
+        boActivated = boOS_ActivateFct(vMON_DeferCycl10ms, (U8) eOS_SLICE_10MS);
+        //lint -restore
+        if (boActivated == FALSE)
+        {
+            u8MON_DeferState = MON_DEFER_IDLE;
+            s16RetVal = KB_RET_ERR_RESOURCE;
+        }
+    }
+
+    return (s16RetVal);
+}
+//  EndOfFunction s16MON_DeferStart ************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function vMON_DeferCycl10ms
+//
+//**********************************************************************************************************************
+//! @brief   Calls the step function of the running job, stores the response when the job is finished and
+//!          deactivates itself.
+//!
+//! @return  -
+//**********************************************************************************************************************
+static void vMON_DeferCycl10ms (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16RespLen = 0;                   // Response length of the step
+
+//*************************************************** Function code ****************************************************
+    if (u8MON_DeferState == MON_DEFER_BUSY)
+    {
+        s16RespLen = pfMON_DeferStep(au8MON_DeferCmd, u16MON_DeferCmdLen, au8MON_DeferResp, u16MON_DeferMaxResp);
+    }
+
+    if (s16RespLen != 0)
+    {
+        // A negative length is not used by the handlers, it is answered like an empty response
+        u16MON_DeferRespLen = (s16RespLen > 0) ? (U16) s16RespLen : 0U;
+        (void) s16OS_GetTimeMS(&u32MON_DeferDoneTime);
+        u8MON_DeferState = MON_DEFER_DONE;
+    }
+
+    if (u8MON_DeferState != MON_DEFER_BUSY)
+    {
+        // Inhibit lint warning 466 and note 9074 due to a missing void in boOS_DeActivateFct declaration
+        //lint -save -e466 -e9074
+        (void) boOS_DeActivateFct(vMON_DeferCycl10ms, (U8) eOS_SLICE_10MS);
+        //lint -restore
+    }
+}
+//  EndOfFunction vMON_DeferCycl10ms ***********************************************************************************
+
+//  EndOfFile mon_sdi_defer.c ******************************************************************************************
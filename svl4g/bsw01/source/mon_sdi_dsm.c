@@ -0,0 +1,148 @@
+//**********************************************************************************************************************
+//
+//                                           mon_sdi_dsm.c
+//
+//**********************************************************************************************************************
+//
+//                                    Copyrights(c) 2026 by KNORR-BREMSE,
+//                                       Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date    2026-10-19
+//! @author  agent
+//
+//**********************************************************************************************************************
+//!
+//! @file
+//! @brief  Service Monitor for project ESRA
+//!         Module contains the function to read the states of many DSM state objects in one command, e.g. for a
+//!         status dump of the complete board. Responses longer than the SDI frame are read in pages.
+//!         The DIAG SDI handlers (s16SDI_Diag_get_DS/_F/_RC, diag_sdi_cmd_hndlr_s.h) and their command table belong
+//!         to the FWK DIAG service and are not built with the board, so the paginated dump is a MON command.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date            Author              Changes
+// 2026-10-19      agent               Start
+// 2026-10-19      agent               Responses built in place by mon_sdi_resp
+// 2026-10-19      agent               Response holds the number of state objects of the requested range
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "mon_cpu04_genrl_sdi_i.h"    // MON CPU04 SDI command handler
+#include "mon_cpu04.h"                // MON CPU04 definitions
+#include "mon.h"                      // MON SDI definitions
+#include "mon_sdi_resp.h"             // MON SDI response builder
+#include "sdi.h"                      // Error Codes
+#include "CoErrno.h"                  // Return values of DSM
+#include "cfg_dsm.h"                  // Number of state objects
+#include "DiagDsmAl_i.h"              // DSM bulk read
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Command MON_SDI_READ_DSM_STATE:
+//!   command, first state object (2), number of state objects (2, 0: up to the last state object),
+//!   optional bitmap of the selected state objects: bit (i % 8) of byte (i / 8) for state object i, covering the range.
+//! Response:
+//!   status, number of state objects of the range (2, the requested number, up to the last state object if 0 was
+//!   requested), next state object (2), one packed state per selected state object (DIAG_DSM_AL_BULK_xxx_SHIFT).
+//!   The range is complete if next = first + number, otherwise the next page is requested with first = next,
+//!   number reduced by next - first and the same bitmap.
+//! Multi byte values are big endian.
+#define MON_SDI_DSM_RESP_HDR_LEN      ((U16) 5U)
+
+//! Maximum length of the bitmap
+#define MON_SDI_DSM_SELECT_LEN        ((U16)((C_DIAG_DSM_MAX_NR_STATEOBJECTS + 7U) / 8U))
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_ReadDsmState
+//
+//**********************************************************************************************************************
+s16SDI_CMD(s16MON_ReadDsmState)
+{
+//************************************************ Function scope data *************************************************
+    C_MON_RESP cResp;                     // SDI response
+    U8* pu8Next;                          // Next state object in the response
+    U8* pu8States;                        // States in the response
+    U16 u16First;                         // First requested state object
+    U16 u16Count;                         // Number of requested state objects
+    U16 u16Next = 0U;                     // First state object not copied
+    U16 u16Len = 0U;                      // Number of copied states
+    U16 u16SelectLen;                     // Length of the bitmap
+    const U8* pu8Select = KB_NULL_PTR;    // Bitmap of the selected state objects
+
+//*************************************************** Function code ****************************************************
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+
+    if ((u16CmdLenIn < (U16) MON_SDI_READ_DSM_STATE_LEN) ||
+        (u16CmdLenIn > ((U16) MON_SDI_READ_DSM_STATE_LEN + MON_SDI_DSM_SELECT_LEN)) ||
+        (u16MaxRespOut <= (MON_SDI_INDEX_1 + MON_SDI_DSM_RESP_HDR_LEN)))
+    { //Command length invalid
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
+    }
+    else
+    {
+        // 1, 2 : first state object, 3, 4 : number of state objects, 5.. : bitmap
+        u16First = (U16)(((U16) pu8DataIn[MON_SDI_INDEX_1] << MON_SHIFT_VAR_BY_8) | pu8DataIn[MON_SDI_INDEX_2]);
+        u16Count = (U16)(((U16) pu8DataIn[MON_SDI_INDEX_3] << MON_SHIFT_VAR_BY_8) |
+                         pu8DataIn[MON_SDI_INDEX_3 + 1U]);
+        if ((u16Count == 0U) && (u16First < C_DIAG_DSM_MAX_NR_STATEOBJECTS))
+        {
+            u16Count = (U16)(C_DIAG_DSM_MAX_NR_STATEOBJECTS - u16First);
+        }
+
+        u16SelectLen = (U16)(u16CmdLenIn - (U16) MON_SDI_READ_DSM_STATE_LEN);
+        if (u16SelectLen != 0U)
+        {
+            pu8Select = &pu8DataIn[MON_SDI_READ_DSM_STATE_LEN];
+        }
+
+        // The bitmap has to cover the range, the range is checked by DSM
+        if ((u16SelectLen != 0U) && (((U32) u16SelectLen * 8U) < ((U32) u16First + u16Count)))
+        {
+            vMON_RespU8(&cResp, MON_SDI_RANGE_ERROR);
+        }
+        else
+        {
+            vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
+            vMON_RespU16Be(&cResp, u16Count);
+            pu8Next = pu8MON_RespReserve(&cResp, 2U);   // set after the bulk read
+            pu8States = pu8MON_RespReserve(&cResp, 0U);
+
+            // DSM copies the states into the free space of the response
+            if ((pu8Next == KB_NULL_PTR) || (pu8States == KB_NULL_PTR) ||
+                (s16DiagDsmAlNvMem_GetBulk(u16First, u16Count, pu8Select, pu8States, u16MON_RespFree(&cResp),
+                                           &u16Next, &u16Len) != CO_ERROR_NONE))
+            {
+                return (s16MON_RespError(&cResp, MON_SDI_RANGE_ERROR));
+            }
+
+            pu8Next[0] = (U8)(u16Next >> MON_SHIFT_VAR_BY_8);
+            pu8Next[1] = (U8) u16Next;
+            (void) pu8MON_RespReserve(&cResp, u16Len);
+        }
+    }
+
+    return (s16MON_RespEnd(&cResp)); // return reply len
+}
+//  EndOfFunction s16MON_ReadDsmState **********************************************************************************
+
+//  EndOfFile mon_sdi_dsm.c ********************************************************************************************
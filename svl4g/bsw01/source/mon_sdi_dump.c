@@ -0,0 +1,422 @@
+//**********************************************************************************************************************
+//
+//                                          mon_sdi_dump.c
+//
+//**********************************************************************************************************************
+//
+//                                    Copyrights(c) 2026 by KNORR-BREMSE,
+//                                       Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date    2026-10-19
+//! @author  agent
+//
+//**********************************************************************************************************************
+//!
+//! @file
+//! @brief  Service Monitor for project ESRA
+//!         Module contains the memory dump: an address range is transferred in sequential frames that fill the whole
+//!         response, optionally run length encoded, and ends with a CRC of the transferred data.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date            Author              Changes
+// 2026-10-19      agent               Start
+// 2026-10-19      agent               Dump only in test mode, limits of the frame size and of the CRC documented
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include <string.h>                   // Include memcpy, memset
+#include "mon_cpu04_genrl_sdi_i.h"    // MON CPU04 SDI command handler
+#include "mon_cpu04.h"                // MON CPU04 definitions, readable address ranges
+#include "mon.h"                      // MON SDI definitions
+#include "mon_sdi_resp.h"             // MON SDI response builder
+#include "crc32_sl.h"                 // CRC of the dump
+#include "sdi.h"                      // Error Codes
+#include "bcm_strt.h"                 // BCL system interface
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Command MON_SDI_DUMP_START:
+//!   command, address (4), length (4), mode (MON_DUMP_xxx).
+//!   The range has to lie in one address range of acMON_RamArea. A new dump replaces the current one.
+//! Response:
+//!   status.
+//!
+//! Command MON_SDI_DUMP_READ:
+//!   command, sequence number (2), starting with 0 after MON_SDI_DUMP_START.
+//! Response:
+//!   status, sequence number (2), flags (MON_DUMP_FLAG_xxx), data.
+//!   Each frame continues the data where the frame with the previous sequence number ended and fills the response.
+//!   The last frame (MON_DUMP_FLAG_LAST) ends with the CRC32 (4, crc32_sl.h) of the dumped memory; it can be a frame
+//!   with the CRC only. If a response is lost, the tester repeats the sequence number and the frame is built again.
+//!   Reading the frame after the last frame returns the CRC again.
+//! MON_DUMP_RLE: the data of each frame is encoded on its own as a sequence of
+//!   control byte c < 0x80 : c + 1 bytes follow as they are
+//!   control byte c >= 0x80 : one byte follows, repeated c - 0x80 + 3 times
+//! Multi byte values are big endian.
+//! Both commands are processed only in test mode (eBCM_BS_TEST).
+//!
+//! Limits:
+//! - A response is at most MON_MSGMAXLEN (64) bytes, so a frame carries at most 60 bytes of data. A MON_DUMP_RAW
+//!   dump is therefore not faster than the memory read of the MON library (cMON_Mem_Read_Test, cfg_mon.c); only
+//!   MON_DUMP_RLE transfers more memory per frame, and only if the memory contains runs.
+//! - The dump is not a snapshot. Each frame is read from the live memory when it is built, a repeated frame again.
+//!   The CRC is taken over the transferred data, so it detects lost or corrupted frames, but not memory that changed
+//!   while the dump ran.
+#define MON_DUMP_RAW                  ((U8) 0)     //!< Data as in memory
+#define MON_DUMP_RLE                  ((U8) 1)     //!< Data run length encoded
+
+#define MON_DUMP_FLAG_LAST            ((U8) 0x01)  //!< Last frame, ends with the CRC
+
+#define MON_DUMP_START_ADDR_POS       1U           //!< Position of the address in MON_SDI_DUMP_START
+#define MON_DUMP_START_LEN_POS        5U           //!< Position of the length in MON_SDI_DUMP_START
+#define MON_DUMP_START_MODE_POS       9U           //!< Position of the mode in MON_SDI_DUMP_START
+#define MON_DUMP_READ_HDR_LEN         ((U16) 4U)   //!< Status, sequence number, flags
+#define MON_DUMP_CRC_LEN              ((U16) 4U)   //!< Length of the CRC
+
+#define MON_DUMP_LITERAL_MAX          ((U16) 128U) //!< Maximum number of bytes of a literal
+#define MON_DUMP_RUN_MIN              ((U16) 3U)   //!< Minimum length of a run
+#define MON_DUMP_RUN_MAX              ((U16) 130U) //!< Maximum length of a run
+#define MON_DUMP_RUN_CTRL             ((U8) 0x80U) //!< Control byte of a run of MON_DUMP_RUN_MIN bytes
+#define MON_DUMP_CTRL_LEN             ((U16) 1U)   //!< Length of a control byte
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+//! Start of the dumped range, KB_NULL_PTR: no dump
+static const U8* pu8MON_DumpStart = KB_NULL_PTR;
+
+//! Length of the dumped range
+static U32 u32MON_DumpLen = 0U;
+
+//! Mode, MON_DUMP_xxx
+static U8 u8MON_DumpMode = MON_DUMP_RAW;
+
+//! Sequence number of the next frame
+static U16 u16MON_DumpNextSeq = 0U;
+
+//! Offset of the frame with the sequence number u16MON_DumpNextSeq - 1
+static U32 u32MON_DumpFrameStart = 0U;
+
+//! Offset behind the frame with the sequence number u16MON_DumpNextSeq - 1
+static U32 u32MON_DumpFrameEnd = 0U;
+
+//! CRC of the data before the frame with the sequence number u16MON_DumpNextSeq - 1
+static U32 u32MON_DumpCrcStart = CRC32_START;
+
+//! CRC of the data up to the end of the frame with the sequence number u16MON_DumpNextSeq - 1
+static U32 u32MON_DumpCrcEnd = CRC32_START;
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+static BOOLEAN boMON_DumpCheckRange (U32 u32Addr, U32 u32Len);
+static U16 u16MON_DumpRaw (U8* pu8Out, U16 u16Free, U32 u32Offset, U32* pu32Crc);
+static U16 u16MON_DumpRle (U8* pu8Out, U16 u16Free, U32* pu32Offset, U32* pu32Crc);
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_DumpStart
+//
+//**********************************************************************************************************************
+s16SDI_CMD(s16MON_DumpStart)
+{
+//************************************************ Function scope data *************************************************
+    C_MON_RESP cResp;                     // SDI response
+    U32 u32Addr;                          // Start of the range
+    U32 u32Len;                           // Length of the range
+    U8  u8Mode;                           // Mode
+
+//*************************************************** Function code ****************************************************
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+
+    if (eBCM_StrtGetBoardState() != eBCM_BS_TEST)
+    {
+        // The board is not in test mode - reply with INVALID_COMMAND
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+    }
+
+    if (u16CmdLenIn != (U16) MON_SDI_DUMP_START_LEN)
+    { //Command length invalid
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+    }
+
+    u32Addr = ((U32) pu8DataIn[MON_DUMP_START_ADDR_POS] << 24U) |        // @suppress("No magic numbers")
+              ((U32) pu8DataIn[MON_DUMP_START_ADDR_POS + 1U] << 16U) |   // @suppress("No magic numbers")
+              ((U32) pu8DataIn[MON_DUMP_START_ADDR_POS + 2U] << MON_SHIFT_VAR_BY_8) |
+              (U32) pu8DataIn[MON_DUMP_START_ADDR_POS + 3U];
+    u32Len = ((U32) pu8DataIn[MON_DUMP_START_LEN_POS] << 24U) |          // @suppress("No magic numbers")
+             ((U32) pu8DataIn[MON_DUMP_START_LEN_POS + 1U] << 16U) |     // @suppress("No magic numbers")
+             ((U32) pu8DataIn[MON_DUMP_START_LEN_POS + 2U] << MON_SHIFT_VAR_BY_8) |
+             (U32) pu8DataIn[MON_DUMP_START_LEN_POS + 3U];
+    u8Mode = pu8DataIn[MON_DUMP_START_MODE_POS];
+
+    if ((u8Mode > MON_DUMP_RLE) || (boMON_DumpCheckRange(u32Addr, u32Len) == FALSE))
+    {
+        return (s16MON_RespError(&cResp, MON_SDI_RANGE_ERROR));
+    }
+
+    // Inhibit lint note 9078 caused by address to object pointer conversion needed for memory access
+    pu8MON_DumpStart = (const U8*) u32Addr; //lint !e9078
+    u32MON_DumpLen = u32Len;
+    u8MON_DumpMode = u8Mode;
+    u16MON_DumpNextSeq = 0U;
+    u32MON_DumpFrameStart = 0U;
+    u32MON_DumpFrameEnd = 0U;
+    u32MON_DumpCrcStart = CRC32_START;
+    u32MON_DumpCrcEnd = CRC32_START;
+
+    vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
+
+    return (s16MON_RespEnd(&cResp)); // return reply len
+}
+//  EndOfFunction s16MON_DumpStart *************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_DumpRead
+//
+//**********************************************************************************************************************
+s16SDI_CMD(s16MON_DumpRead)
+{
+//************************************************ Function scope data *************************************************
+    C_MON_RESP cResp;                     // SDI response
+    U8* pu8Flags;                         // Flags in the response
+    U8* pu8Data;                          // Data in the response
+    U16 u16Seq;                           // Sequence number of the frame
+    U16 u16Free;                          // Free bytes for the data
+    U16 u16DataLen;                       // Length of the data
+    U32 u32Offset;                        // Offset of the frame
+    U32 u32Crc;                           // CRC up to the end of the frame
+
+//*************************************************** Function code ****************************************************
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+
+    if (eBCM_StrtGetBoardState() != eBCM_BS_TEST)
+    {
+        // The board is not in test mode - reply with INVALID_COMMAND
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+    }
+
+    if ((u16CmdLenIn != (U16) MON_SDI_DUMP_READ_LEN) || (pu8MON_DumpStart == KB_NULL_PTR) ||
+        (u16MaxRespOut < (MON_SDI_INDEX_1 + MON_DUMP_READ_HDR_LEN + MON_DUMP_CRC_LEN)))
+    { //Command length invalid or no dump
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+    }
+
+    u16Seq = (U16)(((U16) pu8DataIn[MON_SDI_INDEX_1] << MON_SHIFT_VAR_BY_8) | pu8DataIn[MON_SDI_INDEX_2]);
+    if (u16Seq == u16MON_DumpNextSeq)
+    {
+        // The previous frame was received
+        u32MON_DumpFrameStart = u32MON_DumpFrameEnd;
+        u32MON_DumpCrcStart = u32MON_DumpCrcEnd;
+        u16MON_DumpNextSeq++;
+    }
+    else if ((u16MON_DumpNextSeq == 0U) || (u16Seq != (U16)(u16MON_DumpNextSeq - 1U)))
+    {
+        // Neither the next frame nor a repetition of the previous one
+        return (s16MON_RespError(&cResp, MON_SDI_RANGE_ERROR));
+    }
+    else
+    {
+        // Repetition of the previous frame
+    }
+
+    vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
+    vMON_RespU16Be(&cResp, u16Seq);
+    pu8Flags = pu8MON_RespReserve(&cResp, 1U);
+
+    // The frame is built from memory again if it is repeated
+    u32Offset = u32MON_DumpFrameStart;
+    u32Crc = u32MON_DumpCrcStart;
+    pu8Data = pu8MON_RespReserve(&cResp, 0U);
+    u16Free = u16MON_RespFree(&cResp);
+    if (u8MON_DumpMode == MON_DUMP_RLE)
+    {
+        u16DataLen = u16MON_DumpRle(pu8Data, u16Free, &u32Offset, &u32Crc);
+    }
+    else
+    {
+        u16DataLen = u16MON_DumpRaw(pu8Data, u16Free, u32Offset, &u32Crc);
+        u32Offset += u16DataLen;
+    }
+    (void) pu8MON_RespReserve(&cResp, u16DataLen);
+
+    u32MON_DumpFrameEnd = u32Offset;
+    u32MON_DumpCrcEnd = u32Crc;
+
+    if (pu8Flags != KB_NULL_PTR)
+    {
+        *pu8Flags = 0U;
+        if ((u32Offset == u32MON_DumpLen) && (u16MON_RespFree(&cResp) >= MON_DUMP_CRC_LEN))
+        {
+            *pu8Flags = MON_DUMP_FLAG_LAST;
+            vMON_RespU32Be(&cResp, u32Crc);
+        }
+    }
+
+    return (s16MON_RespEnd(&cResp)); // return reply len
+}
+//  EndOfFunction s16MON_DumpRead **************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function boMON_DumpCheckRange
+//
+//**********************************************************************************************************************
+//! @brief   Checks that a range lies in one address range of acMON_RamArea.
+//!
+//! @param[in]  u32Addr : Start address
+//! @param[in]  u32Len : Length, not 0
+//! @return  TRUE if the range can be dumped
+//**********************************************************************************************************************
+static BOOLEAN boMON_DumpCheckRange (U32 u32Addr, U32 u32Len)
+{
+//************************************************ Function scope data *************************************************
+    BOOLEAN boValid = FALSE;              // Function return value
+    U32 u32Start;                         // Start of the address range
+    U8  u8Area;                           // counting variable
+
+//*************************************************** Function code ****************************************************
+    for (u8Area = 0U; (u8Area < u8MON_RamAreas) && (boValid == FALSE) && (u32Len != 0U); u8Area++)
+    {
+        // Inhibit lint note 9078 caused by object pointer to address conversion needed for memory access
+        u32Start = (U32) acMON_RamArea[u8Area].pu8Start; //lint !e9078
+        if ((u32Addr >= u32Start) && ((u32Addr - u32Start) < acMON_RamArea[u8Area].u32Size) &&
+            ((acMON_RamArea[u8Area].u32Size - (u32Addr - u32Start)) >= u32Len))
+        {
+            boValid = TRUE;
+        }
+    }
+
+    return (boValid);
+}
+//  EndOfFunction boMON_DumpCheckRange *********************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function u16MON_DumpRaw
+//
+//**********************************************************************************************************************
+//! @brief   Copies the data of a frame.
+//!
+//! @param[out]    pu8Out : Data of the frame
+//! @param[in]     u16Free : Free bytes for the data
+//! @param[in]     u32Offset : Offset of the frame in the range
+//! @param[in,out] pu32Crc : CRC, continued over the data
+//! @return  Length of the data
+//**********************************************************************************************************************
+static U16 u16MON_DumpRaw (U8* pu8Out, U16 u16Free, U32 u32Offset, U32* pu32Crc)
+{
+//************************************************ Function scope data *************************************************
+    U16 u16Len = u16Free;                 // Function return value
+
+//*************************************************** Function code ****************************************************
+    if ((u32MON_DumpLen - u32Offset) < u16Free)
+    {
+        u16Len = (U16)(u32MON_DumpLen - u32Offset);
+    }
+
+    if (u16Len != 0U)
+    {
+        // The CRC is calculated over the copy, the memory may change meanwhile
+        memcpy((void*) pu8Out, (const void*) &pu8MON_DumpStart[u32Offset], (size_t) u16Len);
+        *pu32Crc = u32CRC32_Update(*pu32Crc, pu8Out, u16Len);
+    }
+
+    return (u16Len);
+}
+//  EndOfFunction u16MON_DumpRaw ***************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function u16MON_DumpRle
+//
+//**********************************************************************************************************************
+//! @brief   Encodes the data of a frame as runs and literals.
+//!
+//! @param[out]    pu8Out : Data of the frame
+//! @param[in]     u16Free : Free bytes for the data
+//! @param[in,out] pu32Offset : Offset in the range, moved behind the encoded bytes
+//! @param[in,out] pu32Crc : CRC, continued over the encoded bytes
+//! @return  Length of the data
+//**********************************************************************************************************************
+static U16 u16MON_DumpRle (U8* pu8Out, U16 u16Free, U32* pu32Offset, U32* pu32Crc)
+{
+//************************************************ Function scope data *************************************************
+    U8  au8Run[MON_DUMP_RUN_MAX];         // Bytes of a run for the CRC
+    const U8* pu8Src;                     // Bytes to encode
+    U32 u32Left;                          // Bytes left in the range
+    U16 u16Out = 0U;                      // Function return value
+    U16 u16Run;                           // Length of the run at pu8Src
+    U16 u16Lit;                           // Length of the literal at pu8Src
+    U16 u16Max;                           // Maximum length of the literal
+    U8  u8Value;                          // Byte of the run
+
+//*************************************************** Function code ****************************************************
+    u32Left = u32MON_DumpLen - *pu32Offset;
+
+    // A token needs a control byte and at least one byte
+    while ((u32Left != 0U) && ((u16Free - u16Out) > MON_DUMP_CTRL_LEN))
+    {
+        pu8Src = &pu8MON_DumpStart[*pu32Offset];
+        u8Value = pu8Src[0];
+        for (u16Run = 1U; (u16Run < MON_DUMP_RUN_MAX) && (u16Run < u32Left) && (pu8Src[u16Run] == u8Value); u16Run++)
+        {
+            // Count the run
+        }
+
+        if (u16Run >= MON_DUMP_RUN_MIN)
+        {
+            pu8Out[u16Out] = (U8)(MON_DUMP_RUN_CTRL + (U8)(u16Run - MON_DUMP_RUN_MIN));
+            pu8Out[u16Out + 1U] = u8Value;
+            u16Out = (U16)(u16Out + MON_DUMP_CTRL_LEN + 1U);
+
+            memset((void*) au8Run, (int) u8Value, (size_t) u16Run);
+            *pu32Crc = u32CRC32_Update(*pu32Crc, au8Run, u16Run);
+            *pu32Offset += u16Run;
+            u32Left -= u16Run;
+        }
+        else
+        {
+            // The literal ends before the next run or where the frame, the range or the literal is full
+            u16Max = (U16)(u16Free - u16Out - MON_DUMP_CTRL_LEN);
+            if (u16Max > MON_DUMP_LITERAL_MAX)
+            {
+                u16Max = MON_DUMP_LITERAL_MAX;
+            }
+            if (u32Left < u16Max)
+            {
+                u16Max = (U16) u32Left;
+            }
+            for (u16Lit = 1U; (u16Lit < u16Max) &&
+                              (((u16Lit + 2U) >= u32Left) || (pu8Src[u16Lit] != pu8Src[u16Lit + 1U]) ||
+                               (pu8Src[u16Lit] != pu8Src[u16Lit + 2U])); u16Lit++)
+            {
+                // Count the literal
+            }
+
+            pu8Out[u16Out] = (U8)(u16Lit - 1U);
+            memcpy((void*) &pu8Out[u16Out + MON_DUMP_CTRL_LEN], (const void*) pu8Src, (size_t) u16Lit);
+            *pu32Crc = u32CRC32_Update(*pu32Crc, &pu8Out[u16Out + MON_DUMP_CTRL_LEN], u16Lit);
+            u16Out = (U16)(u16Out + MON_DUMP_CTRL_LEN + u16Lit);
+            *pu32Offset += u16Lit;
+            u32Left -= u16Lit;
+        }
+    }
+
+    return (u16Out);
+}
+//  EndOfFunction u16MON_DumpRle ***************************************************************************************
+
+//  EndOfFile mon_sdi_dump.c *******************************************************************************************
@@ -50,13 +50,17 @@
 // 2023.04.17      A. Mauro            1.33 / TC_007-96: LINT clean up
 // 2023.09.14      A. Mauro            1.34   Alignment with CA: name changed and other
 // 2023-12-05      C. Brancolini       Lint Plus clean up
+// 2026-10-19      agent               s16MON_ReadFreqDefer added: readings deferred to s16MON_ReadFreqStep
+//                                     (mon_sdi_defer.h) instead of busy waiting, response length checked. PWM
+//                                     acquisition stopped and restarted per user by vMON_PwmDemodStop/Restart
+// 2026-10-19      agent               Responses built in place by mon_sdi_resp
+// 2026-10-19      agent               Added boMON_PwmDemodStopped, frequency scaling from mon_cpu04.h
 //
 //**********************************************************************************************************************
 
 //**************************************** Compiler options ( #pragma ) ************************************************
 
 //**************************************** Header / include files ( #include ) *****************************************
-#include <string.h>                   // Include memcpy
 #include "mon_cpu04_genrl_sdi_i.h"    // MON CPU04 SDI command handler
 #include "mon_fin.h"                  // MON frequency IO definitions
 #include "os.h"
@@ -65,6 +69,10 @@
 #include "bcl_s.h"                    // General BCL service definitions
 #include "sdi.h"                      // Error Codes
 #include "bcm_strt.h"                 // BCL system interface
+#include "kb_ret.h"                   // Global Knorr-Bremse return value definitions
+#include "sciopta_sc.h"               // Scheduler lock of the PWM acquisition users
+#include "mon_sdi_defer.h"            // Deferred SDI responses
+#include "mon_sdi_resp.h"             // MON SDI response builder
 
 //**************************************** Constant / macro definitions ( #define ) ************************************
 
@@ -78,9 +86,6 @@
 #define MON_REPLY_MEASURE_FREQ_LEN     ((U8)2)
 #define MON_REPLY_FI_DATA_LEN          (MON_REPLY_UPDATED_FLAG_LEN + MON_REPLY_MEASURE_FREQ_LEN)
 
-#define FREQ_OFFSET 50U
-#define FREQ_FACTOR 100U
-
 //**************************************** Type definitions ( typedef ) ************************************************
 
 //**************************************** Global data definitions *****************************************************
@@ -88,10 +93,16 @@
 //**************************************** Global constant definitions ( const ) ***************************************
 
 //**************************************** Module global data segment ( static ) ***************************************
+static U8  u8MON_FinLoopCnt = 0U;       //!< Readings of the deferred job left
+static U32 u32MON_FinReadTime = 0U;     //!< Time of the last reading of the deferred job
+static U8  u8MON_PwmDemodUsers = 0U;    //!< MON_PWM_DEMOD_xxx users that stopped the PWM acquisition
 
 //**************************************** Module global constants ( static const ) ************************************
 
 //**************************************** Local func/proc prototypes ( static ) ***************************************
+static U8 u8MON_FinInit(const U8* pu8DataIn, U16 u16CmdLenIn, U16 u16MaxRespOut);
+static S16 s16MON_FinRead(const U8* pu8DataIn, U8* pu8DataOut, U16 u16MaxRespOut);
+static S16 s16MON_ReadFreqStep(const U8* pu8DataIn, U16 u16CmdLenIn, U8* pu8DataOut, U16 u16MaxRespOut);
 
 //** EndOfHeader *******************************************************************************************************
 
@@ -104,14 +115,9 @@ s16SDI_CMD(s16MON_ReadFreq)
     //************************************************ Function scope data *********************************************
     U32 u32StartTime;                     // start time for generate delay
     U32 u32CurrentTime;                   // start time for generate delay
-    U8  u8Cnt;                            // counting variable
-    U8  u8RequestedFIs;                   // number of the frequency inputs to be read
     U8  u8LoopCnt;                        // Number of loops to read freq
-    U8 u8SDIRespIndex = MON_SDI_INDEX_1;  // SDI response index
-    U8 u8SDICmdIndex = MON_SDI_INDEX_1;   // SDI command index
-    U16 u16TempFreq ;                     // variable to hold the freq value
-    C_FIN_MEASUREMENT_DATA cFIN_DATA;       // struct for frequency inputs
-    C_MON_IO_BUFF cMonIoBuff;             // buffer for temp storage of io input u8/u16/u32
+    U8  u8Status;                         // Status of the command check
+    C_MON_RESP cResp;                     // SDI response
     E_BCM_BOARD_STATE   eBoardState;      // Board state
     S16 s16RetVal;                        // Function return value
 
@@ -119,7 +125,7 @@ s16SDI_CMD(s16MON_ReadFreq)
 
     //*************************************************** Function code ************************************************
 
-    (void)u16MaxRespOut; // unused parameter
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
 
     // Get Board State
     eBoardState = eBCM_StrtGetBoardState();
@@ -130,16 +136,200 @@ s16SDI_CMD(s16MON_ReadFreq)
         // If board is not in Test Mode, command will not be processed.
 
         // Build reply message "invalid command"
-        u8SDIRespIndex = MON_SDI_INDEX_1;
-        pu8DataOut[u8SDIRespIndex] = MON_SDI_INVALID_COMMAND;
-        u8SDIRespIndex++;
-
         // Return response length
-        return (S16)u8SDIRespIndex;
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
     }
 
     // Board is in Test Mode State
     // Build reply message ***************************************************************************
+    u8Status = u8MON_FinInit(pu8DataIn, u16CmdLenIn, u16MaxRespOut);
+    if (u8Status != MON_SDI_NO_ERROR)
+    {
+        return (s16MON_RespError(&cResp, u8Status));
+    }
+
+    // Deactivate PWM acquisition if present (TC_007-84)
+    vMON_PwmDemodStop(MON_PWM_DEMOD_READ_FREQ);
+
+    u8LoopCnt = NUM_OF_FIN_LOOPS;
+    do
+    {
+        // Every reading rebuilds the response, the last one is returned
+        s16RetVal = s16MON_FinRead(pu8DataIn, pu8DataOut, u16MaxRespOut);
+
+        u8LoopCnt--;
+        if (u8LoopCnt != 0U)
+        {
+            (void) s16OS_GetTimeMS(&u32StartTime);
+            (void) s16OS_GetTimeMS(&u32CurrentTime);
+
+            while ((u32CurrentTime - u32StartTime) < DELAY_READ_FIN)
+            {
+                (void) s16OS_GetTimeMS(&u32CurrentTime);
+            }
+            // delay before reading the second and third time
+        }
+    } while (u8LoopCnt != 0U);
+
+    // Re-activate PWM acquisition if present and not stopped by another user (TC_007-84)
+    vMON_PwmDemodRestart(MON_PWM_DEMOD_READ_FREQ);
+
+    // Return response length
+    return (s16RetVal);
+}
+//  EndOfFunction s16MON_ReadFreq **************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_ReadFreqDefer
+//**********************************************************************************************************************
+s16SDI_CMD(s16MON_ReadFreqDefer)
+{
+    //************************************************ Function scope data *********************************************
+    U8  u8Status;                         // Status of the command check
+    C_MON_RESP cResp;                     // SDI response
+    E_BCM_BOARD_STATE   eBoardState;      // Board state
+    S16 s16RetVal;                        // Function return value
+
+    //*************************************************** Function code ************************************************
+
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+
+    // Get Board State
+    eBoardState = eBCM_StrtGetBoardState();
+
+    // Check Board State
+    if (eBoardState != eBCM_BS_TEST)   //eBoardState is not eBCM_BS_TEST
+    {
+        // If board is not in Test Mode, command will not be processed.
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+    }
+
+    // The readings are deferred: a repeated command gets MON_SDI_PENDING or the response
+    s16RetVal = s16MON_DeferPoll(pu8DataIn, u16CmdLenIn, pu8DataOut, u16MaxRespOut);
+    if (s16RetVal > 0)
+    {
+        return (s16RetVal);
+    }
+
+    u8Status = u8MON_FinInit(pu8DataIn, u16CmdLenIn,
+                             (u16MaxRespOut < MON_DEFER_MSG_SIZE) ? u16MaxRespOut : MON_DEFER_MSG_SIZE);
+    if (u8Status != MON_SDI_NO_ERROR)
+    {
+        return (s16MON_RespError(&cResp, u8Status));
+    }
+
+    // Deactivate PWM acquisition if present (TC_007-84), re-activated by s16MON_ReadFreqStep
+    vMON_PwmDemodStop(MON_PWM_DEMOD_FREQ_DEFER);
+
+    // First reading in the next step, the others DELAY_READ_FIN after the previous one
+    u8MON_FinLoopCnt = NUM_OF_FIN_LOOPS;
+    (void) s16OS_GetTimeMS(&u32MON_FinReadTime);
+    u32MON_FinReadTime -= DELAY_READ_FIN;
+
+    if (s16MON_DeferStart(pu8DataIn, u16CmdLenIn, u16MaxRespOut, s16MON_ReadFreqStep) == KB_RET_OK)
+    {
+        vMON_RespU8(&cResp, MON_SDI_PENDING);
+    }
+    else
+    {
+        vMON_PwmDemodRestart(MON_PWM_DEMOD_FREQ_DEFER);
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
+    }
+
+    // Return response length
+    return (s16MON_RespEnd(&cResp));
+}
+//  EndOfFunction s16MON_ReadFreqDefer *********************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function vMON_PwmDemodStop
+//**********************************************************************************************************************
+void vMON_PwmDemodStop(U8 u8User)
+{
+    //************************************************ Function scope data *********************************************
+
+    //*************************************************** Function code ************************************************
+
+    // Users of other processes must not see an inconsistent set of users
+    ( void )sc_lock();
+    if ((u8MON_PwmDemodUsers == 0U) && (pvMON_Cycl1ms_GetPWDemod != KB_NULL_PTR))
+    {
+        // Inhibit lint error warning 466 and note 9074 due to a missing void in boOS_DeActivateFct declaration
+        //lint -save -e466 -e9074
+        // Stop PWM cycle readings
+        (void)boOS_DeActivateFct(pvMON_Cycl1ms_GetPWDemod,(U8)eOS_SLICE_1MS);
+        //lint -restore
+    }
+    u8MON_PwmDemodUsers |= u8User;
+    sc_unlock();
+}
+//  EndOfFunction vMON_PwmDemodStop ************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function vMON_PwmDemodRestart
+//**********************************************************************************************************************
+void vMON_PwmDemodRestart(U8 u8User)
+{
+    //************************************************ Function scope data *********************************************
+
+    //*************************************************** Function code ************************************************
+
+    // Users of other processes must not see an inconsistent set of users
+    ( void )sc_lock();
+    if ((u8MON_PwmDemodUsers & u8User) != 0U)
+    {
+        u8MON_PwmDemodUsers &= (U8) ~u8User;
+        if ((u8MON_PwmDemodUsers == 0U) && (pvMON_Cycl1ms_GetPWDemod != KB_NULL_PTR))
+        {
+            // Restart PWM cycle readings
+            // Inhibit lint warning 466 and note 9074 due to a missing void in boOS_ActivateFct declaration
+            //lint -save -e466 -e9074
+            (void)boOS_ActivateFct(pvMON_Cycl1ms_GetPWDemod,(U8)eOS_SLICE_1MS);
+            //lint -restore
+        }
+    }
+    sc_unlock();
+}
+//  EndOfFunction vMON_PwmDemodRestart *********************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function boMON_PwmDemodStopped
+//**********************************************************************************************************************
+BOOLEAN boMON_PwmDemodStopped(void)
+{
+    //************************************************ Function scope data *********************************************
+
+    //*************************************************** Function code ************************************************
+
+    return ((u8MON_PwmDemodUsers != 0U) ? (BOOLEAN)TRUE : (BOOLEAN)FALSE);
+}
+//  EndOfFunction boMON_PwmDemodStopped ********************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function u8MON_FinInit
+//**********************************************************************************************************************
+//! @brief   Checks a command MON_SDI_READ_FREQ or MON_SDI_READ_FREQ_DEFER and initializes the requested frequency
+//!          inputs.
+//!
+//! @param[in]  pu8DataIn : Pointer of Terminal channel input
+//! @param[in]  u16CmdLenIn : length of command
+//! @param[in]  u16MaxRespOut : Max data to write to output
+//! @return  MON_SDI_NO_ERROR or the error status of the response
+//**********************************************************************************************************************
+static U8 u8MON_FinInit(const U8* pu8DataIn, U16 u16CmdLenIn, U16 u16MaxRespOut)
+{
+    //************************************************ Function scope data *********************************************
+    U8  u8Cnt;                            // counting variable
+    U8  u8RequestedFIs;                   // number of the frequency inputs to be read
+    U8 u8SDICmdIndex = MON_SDI_INDEX_1;   // SDI command index
+    U8 u8Status = MON_SDI_NO_ERROR;       // Function return value
+
+    //*************************************************** Function code ************************************************
 
     // Get the number of the frequency inputs to be read
     u8RequestedFIs = pu8DataIn[u8SDICmdIndex];
@@ -148,9 +338,7 @@ s16SDI_CMD(s16MON_ReadFreq)
     if ( u8RequestedFIs > u8MON_MaxFreqChnls )  // Frequency channels more than actual
     {
         // Replay with RANGE_ERROR
-        pu8DataOut[u8SDIRespIndex] = MON_SDI_CHANNEL_ERROR;
-        u8SDIRespIndex++;
-        return (S16)u8SDIRespIndex;                         // too big - ack with RANGE_ERROR
+        return (MON_SDI_CHANNEL_ERROR); // too big - ack with RANGE_ERROR
     }
     //TC0047-39 -Freq channel no. verification
     //TC_005-62 -From <= to <
@@ -159,9 +347,7 @@ s16SDI_CMD(s16MON_ReadFreq)
 
         if ((pu8DataIn[(u8SDICmdIndex + u8Cnt + MON_FREQIN_PARA_LEN)] >= u8MON_MaxFreqChnls))       //Freq chan no. more than actual
         { // check reading range
-            pu8DataOut[u8SDIRespIndex] = MON_SDI_CHANNEL_ERROR;
-            u8SDIRespIndex++;
-            return (S16)u8SDIRespIndex;                         // too big - ack with RANGE_ERROR
+            return (MON_SDI_CHANNEL_ERROR); // too big - ack with RANGE_ERROR
         }
     }
 
@@ -169,93 +355,117 @@ s16SDI_CMD(s16MON_ReadFreq)
     if (u16CmdLenIn != (((U16)u8RequestedFIs * MON_FREQIN_PARA_LEN) + MON_SDI_PAR_OFFSET))
     {
         //Command length invalid
-        pu8DataOut[u8SDIRespIndex] = MON_SDI_INVALID_COMMAND;
-        u8SDIRespIndex++;
+        u8Status = MON_SDI_INVALID_COMMAND;
+    }
+    //Check response length
+    else if ((U16) (MON_ACK + ((U16)u8RequestedFIs * MON_REPLY_FI_DATA_LEN)) > u16MaxRespOut)
+    {
+        u8Status = MON_SDI_RANGE_ERROR;
     }
     else
     {
         u8SDICmdIndex++; // point to freq. channel no.
-        for (u8Cnt = 0; u8Cnt < u8RequestedFIs; u8Cnt++)
+        for (u8Cnt = 0; (u8Cnt < u8RequestedFIs) && (u8Status == MON_SDI_NO_ERROR); u8Cnt++)
         { // init frequency channels first
             if (boMON_InitFINCaptChannel((E_FIN_CHNL_NUM) pu8DataIn[u8SDICmdIndex + u8Cnt]) == (BOOLEAN)FALSE)
             {
-                pu8DataOut[u8SDIRespIndex] = MON_SDI_CHANNEL_ERROR;
-                u8SDIRespIndex++;
-                return (S16)u8SDIRespIndex;                       // error occurred during channel
-                                                                // initialization - no further read
+                u8Status = MON_SDI_CHANNEL_ERROR; // error occurred during channel
+                                                  // initialization - no further read
             }
         }
+    }
 
-        // Deactivate PWM acquisition if present (TC_007-84)
-        if ( pvMON_Cycl1ms_GetPWDemod != KB_NULL_PTR )
-        {
-            // Inhibit lint error warning 466 and note 9074 due to a missing void in boOS_DeActivateFct declaration
-            //lint -save -e466 -e9074
-            // Stop PWM cycle readings
-            (void)boOS_DeActivateFct(pvMON_Cycl1ms_GetPWDemod,(U8)eOS_SLICE_1MS);
-            //lint -restore
-        }
+    return (u8Status);
+}
+//  EndOfFunction u8MON_FinInit ****************************************************************************************
 
-        u8LoopCnt = NUM_OF_FIN_LOOPS;
-        do
-        {
-            for (u8Cnt = 0; u8Cnt < u8RequestedFIs; u8Cnt++) // read frequency ports
-            {
-                (void) boMON_GetFINCaptData((E_FIN_CHNL_NUM) pu8DataIn[u8SDICmdIndex + u8Cnt], &cFIN_DATA);
+//**********************************************************************************************************************
+//
+// Function s16MON_FinRead
+//**********************************************************************************************************************
+//! @brief   Reads the requested frequency inputs once and builds the response (frequency low-byte first).
+//!
+//! @param[in]  pu8DataIn : Command (checked by u8MON_FinInit)
+//! @param[out] pu8DataOut : Response
+//! @param[in]  u16MaxRespOut : Max data to write to output (checked by u8MON_FinInit)
+//! @return  Size of the response
+//**********************************************************************************************************************
+static S16 s16MON_FinRead(const U8* pu8DataIn, U8* pu8DataOut, U16 u16MaxRespOut)
+{
+    //************************************************ Function scope data *********************************************
+    U8  u8Cnt;                            // counting variable
+    U8  u8RequestedFIs;                   // number of the frequency inputs to be read
+    C_MON_RESP cResp;                     // SDI response
+    U16 u16TempFreq ;                     // variable to hold the freq value
+    C_FIN_MEASUREMENT_DATA cFIN_DATA;       // struct for frequency inputs
 
-                cMonIoBuff.acMonFreqBuff[u8Cnt].u16Frequency =
-                    (U16)((cFIN_DATA.u32Frequency + FREQ_OFFSET) / FREQ_FACTOR);
-                //Conversion to Frequency Value
-                cMonIoBuff.acMonFreqBuff[u8Cnt].boFreqUpToDate = cFIN_DATA.boFreqUpToDate;
-                // put read bytes into buffer
-            }
-            u8LoopCnt--;
-            if (u8LoopCnt != 0U)
-            {
-                (void) s16OS_GetTimeMS(&u32StartTime);
-                (void) s16OS_GetTimeMS(&u32CurrentTime);
+    //*************************************************** Function code ************************************************
 
-                while ((u32CurrentTime - u32StartTime) < DELAY_READ_FIN)
-                {
-                    (void) s16OS_GetTimeMS(&u32CurrentTime);
-                }
-                // delay before reading the second and third time
-            }
-        } while (u8LoopCnt != 0U);
+    u8RequestedFIs = pu8DataIn[MON_SDI_INDEX_1];
 
-        for (u8Cnt = 0; u8Cnt < u8RequestedFIs; u8Cnt++) // put read bytes into ack message
-        {
-            *(pu8DataOut + MON_ACK + (u8Cnt * MON_REPLY_FI_DATA_LEN)) = cMonIoBuff.acMonFreqBuff[u8Cnt].boFreqUpToDate;
-            u16TempFreq = cMonIoBuff.acMonFreqBuff[u8Cnt].u16Frequency >> MON_SHIFT_VAR_BY_8;
-                                              // used to avoid compiler warning
-            u16TempFreq |= cMonIoBuff.acMonFreqBuff[u8Cnt].u16Frequency << MON_SHIFT_VAR_BY_8;
-                                              // used to avoid compiler warning
-            memcpy((void *)(pu8DataOut + MON_ACK + MON_REPLY_UPDATED_FLAG_LEN + (u8Cnt * MON_REPLY_FI_DATA_LEN)),
-                    (const void *)&u16TempFreq, MON_REPLY_MEASURE_FREQ_LEN);
-        }
-        pu8DataOut[u8SDIRespIndex] = MON_SDI_NO_ERROR; // request is done properly
-        u8SDIRespIndex++;
-        pu8DataOut[u8SDIRespIndex] = u8RequestedFIs;      // ack with NO_ERROR
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+    vMON_RespU8(&cResp, MON_SDI_NO_ERROR); // request is done properly
+    vMON_RespU8(&cResp, u8RequestedFIs);   // ack with NO_ERROR
 
-        u8SDIRespIndex = MON_ACK + (U8)(u8RequestedFIs * MON_REPLY_FI_DATA_LEN);
-    }
-    // Re-activate PWM acquisition if present (TC_007-84)
-    if ( pvMON_Cycl1ms_GetPWDemod != KB_NULL_PTR )
+    for (u8Cnt = 0; u8Cnt < u8RequestedFIs; u8Cnt++) // read frequency ports, put read bytes into ack message
     {
-        // Restart PWM cycle readings
-        // Inhibit lint warning 466 and note 9074 due to a missing void in boOS_ActivateFct declaration
-        //lint -save -e466 -e9074
-        (void)boOS_ActivateFct(pvMON_Cycl1ms_GetPWDemod,(U8)eOS_SLICE_1MS);
-        //lint -restore
+        (void) boMON_GetFINCaptData((E_FIN_CHNL_NUM) pu8DataIn[MON_SDI_INDEX_2 + u8Cnt], &cFIN_DATA);
+
+        //Conversion to Frequency Value
+        u16TempFreq = (U16)((cFIN_DATA.u32Frequency + MON_FREQ_OFFSET) / MON_FREQ_FACTOR);
+
+        vMON_RespU8(&cResp, (U8) cFIN_DATA.boFreqUpToDate);
+        vMON_RespU16Le(&cResp, u16TempFreq);
     }
 
+    return (s16MON_RespEnd(&cResp));
+}
+//  EndOfFunction s16MON_FinRead ***************************************************************************************
 
+//**********************************************************************************************************************
+//
+// Function s16MON_ReadFreqStep
+//**********************************************************************************************************************
+//! @brief   Step of the deferred job of s16MON_ReadFreqDefer. Reads the frequency inputs NUM_OF_FIN_LOOPS times,
+//!          DELAY_READ_FIN apart, and returns the response of the last reading.
+//!
+//! @param[in]  pu8DataIn : Command of the job (checked by s16MON_ReadFreqDefer)
+//! @param[in]  u16CmdLenIn : length of command
+//! @param[out] pu8DataOut : Response of the job
+//! @param[in]  u16MaxRespOut : Max data to write to output (checked by s16MON_ReadFreqDefer)
+//! @return  0 while readings are left, otherwise the size of the response
+//**********************************************************************************************************************
+static S16 s16MON_ReadFreqStep(const U8* pu8DataIn, U16 u16CmdLenIn, U8* pu8DataOut, U16 u16MaxRespOut)
+{
+    //************************************************ Function scope data *********************************************
+    U32 u32CurrentTime;                   // current time
+    S16 s16RespLen;                       // Response length of the reading
+    S16 s16RetVal = 0;                    // Function return value
 
-    // Return response length
-    s16RetVal = (S16) u8SDIRespIndex;
+    //*************************************************** Function code ************************************************
+
+    (void)u16CmdLenIn;   // unused parameter
+
+    (void) s16OS_GetTimeMS(&u32CurrentTime);
+    if ((u32CurrentTime - u32MON_FinReadTime) >= DELAY_READ_FIN)
+    {
+        u32MON_FinReadTime = u32CurrentTime;
+
+        // Every reading rebuilds the response, the last one is returned
+        s16RespLen = s16MON_FinRead(pu8DataIn, pu8DataOut, u16MaxRespOut);
+
+        u8MON_FinLoopCnt--;
+        if (u8MON_FinLoopCnt == 0U)
+        {
+            // Re-activate PWM acquisition if present and not stopped by another user (TC_007-84)
+            vMON_PwmDemodRestart(MON_PWM_DEMOD_FREQ_DEFER);
+
+            s16RetVal = s16RespLen;
+        }
+    }
 
     return (s16RetVal);
 }
-//  EndOfFunction s16MON_ReadFreq **************************************************************************************
+//  EndOfFunction s16MON_ReadFreqStep **********************************************************************************
 
 //  EndOfFile mon_sdi_fin.c ********************************************************************************************
@@ -35,6 +35,7 @@
 // 2023.04.17      A. Mauro            1.26 / TC_007-96: LINT clean up
 // 2023.09.14      A. Mauro            1.27   Alignment with CA: name changed and other
 // 2023-12-06      C. Brancolini       Lint Plus clean up
+// 2026-10-19      agent               Responses built in place by mon_sdi_resp
 //
 //**********************************************************************************************************************
 
@@ -46,6 +47,7 @@
 #include "mon_fout.h"                 // MON frequency putputs definitions
 #include "mon_cpu04.h"                // MON CPU04 definitions
 #include "mon.h"                      // MON SDI definitions
+#include "mon_sdi_resp.h"             // MON SDI response builder
 #include "bcl_s.h"                    // General BCL service definitions
 #include "sdi.h"                      // Error Codes
 #include "bcm_strt.h"                 // BCL system interface
@@ -83,17 +85,16 @@ s16SDI_CMD(s16MON_WriteFreq)
     //************************************************ Function scope data *********************************************
     U8 u8Cnt;                             // counting variable
     U8 u8ReqPortsCnt;                     // var to store number of bytes to read
-    U8 u8SDIRespIndex = MON_SDI_INDEX_1;  // SDI command indexes
+    C_MON_RESP cResp;                     // SDI response
     U8 u8SDICmdIndex = MON_SDI_INDEX_1;   // SDI command index
     E_BCM_BOARD_STATE eBoardState;        // Board state
-    S16 s16RetVal;                        // Function return value
     U16 u16FreqOut = 0;                   // Frequency value
     U8* pu8Tmp;                           // Temp pointer
 
     //*************************************** Function scope static data declaration ***********************************
 
     //*************************************************** Function code ************************************************
-    (void)u16MaxRespOut; // unused parameter
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
 
     // Check Board State:
     eBoardState = eBCM_StrtGetBoardState();
@@ -108,9 +109,7 @@ s16SDI_CMD(s16MON_WriteFreq)
         if ( u8ReqPortsCnt > MON_EB_FREQOUT_CHNLS )
         {
             // too big - reply with RANGE_ERROR
-            pu8DataOut[u8SDIRespIndex] = MON_SDI_RANGE_ERROR;
-            u8SDIRespIndex++;
-            return ((S16)u8SDIRespIndex);
+            return (s16MON_RespError(&cResp, MON_SDI_RANGE_ERROR));
         }
         
         // Setup ptr to channel nr
@@ -120,8 +119,7 @@ s16SDI_CMD(s16MON_WriteFreq)
         if (u16CmdLenIn != ( ((U16)u8ReqPortsCnt * MON_PARA_FREQOUT_LEN) + MON_SDI_PAR_OFFSET) )
         {
             // Command length invalid
-            pu8DataOut[u8SDIRespIndex] = MON_SDI_INVALID_COMMAND;
-            u8SDIRespIndex++;
+            vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
         }
         else
         {
@@ -136,31 +134,24 @@ s16SDI_CMD(s16MON_WriteFreq)
                 {
                     // error occurred during channel initialization
                     // reply channel error
-                    pu8DataOut[u8SDIRespIndex] = MON_SDI_CHANNEL_ERROR;
-                    u8SDIRespIndex++;
-                    return ((S16)u8SDIRespIndex);
+                    return (s16MON_RespError(&cResp, MON_SDI_CHANNEL_ERROR));
                 }
                 // Ptr to next target value
                 pu8Tmp = pu8Tmp + MON_PARA_FREQOUT_LEN;
             }
 
             // no error so far, reply no error
-            pu8DataOut[u8SDIRespIndex] = MON_SDI_NO_ERROR;
-            u8SDIRespIndex++;
+            vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
         }
     }
     else
     {
         // Board not in test mode
         // reply with invalid command
-        u8SDIRespIndex = MON_SDI_INDEX_1;
-        pu8DataOut[u8SDIRespIndex] = MON_SDI_INVALID_COMMAND;
-        u8SDIRespIndex++;
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
     }
 
-    s16RetVal = (S16) u8SDIRespIndex;
-
-    return (s16RetVal);
+    return (s16MON_RespEnd(&cResp));
 }
 //  EndOfFunction s16MON_WriteFreq *************************************************************************************
 
@@ -0,0 +1,193 @@
+//**********************************************************************************************************************
+//
+//                                           mon_sdi_nvm.c
+//
+//**********************************************************************************************************************
+//
+//                                    Copyrights(c) 2026 by KNORR-BREMSE,
+//                                       Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date    2026-10-19
+//! @author  agent
+//
+//**********************************************************************************************************************
+//!
+//! @file
+//! @brief  Service Monitor for project ESRA
+//!         Module contains functions to read and clear the NVM operation statistics (counters and service time
+//!         histograms per NVM area, kept by nvm_hal_adp.c) and to read the fault reports suppressed by fim_dedup.c
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date            Author              Changes
+// 2026-10-19      agent               Start
+// 2026-10-19      agent               Responses built in place by mon_sdi_resp
+// 2026-10-19      agent               s16MON_ReadFimSuppr added
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "mon_cpu04_genrl_sdi_i.h"    // MON CPU04 SDI command handler
+#include "mon_cpu04.h"                // MON CPU04 definitions
+#include "mon.h"                      // MON SDI definitions
+#include "mon_sdi_resp.h"             // MON SDI response builder
+#include "sdi.h"                      // Error Codes
+#include "kb_ret.h"                   // Return values
+#include "nvm_hal_bs_i.h"             // NVM HAL operation statistics
+#include "fim_dedup.h"                // Suppressed fault reports
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Response of MON_SDI_READ_NVM_STAT:
+//!   status, number of areas, device, layer, area id, offset (4), size (4),
+//!   operations (4), bytes (4), errors (4), longest time ms (4), histogram (NVM_HAL_STAT_HIST_BINS * 4)
+//! Multi byte values are big endian.
+#define MON_SDI_NVM_STAT_RESP_LEN     ((U16)(14U + 16U + ((U16)NVM_HAL_STAT_HIST_BINS * 4U)))
+
+//! Command MON_SDI_READ_FIM_SUPPR: command, fault code (2), FIM_DEDUP_CODES for the total of all fault codes.
+//! Response: status, suppressed repeats (4). Multi byte values are big endian.
+#define MON_SDI_FIM_SUPPR_RESP_LEN    ((U16) 5U)
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_ReadNvmStat
+//
+//**********************************************************************************************************************
+s16SDI_CMD(s16MON_ReadNvmStat)
+{
+//************************************************ Function scope data *************************************************
+    C_MON_RESP cResp;                     // SDI response
+    U8 u8StatArea;                        // Requested statistics area
+    U8 u8Op;                              // Requested operation
+    U8 u8Bin;                             // Histogram bin
+    C_NVM_HAL_STAT_CNT cCnt;              // Statistics of the operation
+    const C_NVM_HAL_STAT_AREA* pcArea;    // Statistics area
+
+//*************************************************** Function code ****************************************************
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+
+    if ((u16CmdLenIn != (U16) MON_SDI_READ_NVM_STAT_LEN) || (u16MaxRespOut < MON_SDI_NVM_STAT_RESP_LEN))
+    { //Command length invalid
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
+    }
+    else
+    {
+        // 1 : statistics area, 2 : operation
+        u8StatArea = pu8DataIn[MON_SDI_INDEX_1];
+        u8Op = pu8DataIn[MON_SDI_INDEX_2];
+
+        if (s16NVM_HAL_AdpGetStat(u8StatArea, (E_NVM_HAL_STAT_OP)u8Op, &cCnt) != KB_RET_OK)
+        {
+            vMON_RespU8(&cResp, MON_SDI_RANGE_ERROR);
+        }
+        else
+        {
+            pcArea = &acNVM_HAL_CFG_StatArea[u8StatArea];
+
+            vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
+            vMON_RespU8(&cResp, u8NVM_HAL_CFG_StatAreaCnt);
+            vMON_RespU8(&cResp, pcArea->u8NvmID);
+            vMON_RespU8(&cResp, pcArea->u8Layer);
+            vMON_RespU8(&cResp, pcArea->u8AreaID);
+            vMON_RespU32Be(&cResp, pcArea->u32Offset);
+            vMON_RespU32Be(&cResp, pcArea->u32Size);
+            vMON_RespU32Be(&cResp, cCnt.u32OpCnt);
+            vMON_RespU32Be(&cResp, cCnt.u32ByteCnt);
+            vMON_RespU32Be(&cResp, cCnt.u32ErrCnt);
+            vMON_RespU32Be(&cResp, cCnt.u32MaxTimeMs);
+            for (u8Bin = 0U; u8Bin < NVM_HAL_STAT_HIST_BINS; u8Bin++)
+            {
+                vMON_RespU32Be(&cResp, cCnt.au32Hist[u8Bin]);
+            }
+        }
+    }
+
+    return (s16MON_RespEnd(&cResp)); // return reply len
+}
+//  EndOfFunction s16MON_ReadNvmStat ***********************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_ResetNvmStat
+//
+//**********************************************************************************************************************
+s16SDI_CMD(s16MON_ResetNvmStat)
+{
+//************************************************ Function scope data *************************************************
+    C_MON_RESP cResp;                     // SDI response
+
+//*************************************************** Function code ****************************************************
+    (void)pu8DataIn;     // unused parameter
+
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+
+    if (u16CmdLenIn != (U16) MON_SDI_RESET_NVM_STAT_LEN)
+    { //Command length invalid
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
+    }
+    else
+    {
+        vNVM_HAL_AdpResetStat();
+        vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
+    }
+
+    return (s16MON_RespEnd(&cResp)); // return reply len
+}
+//  EndOfFunction s16MON_ResetNvmStat **********************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_ReadFimSuppr
+//
+//**********************************************************************************************************************
+s16SDI_CMD(s16MON_ReadFimSuppr)
+{
+//************************************************ Function scope data *************************************************
+    C_MON_RESP cResp;                     // SDI response
+    U16 u16FaultCode;                     // Requested fault code
+
+//*************************************************** Function code ****************************************************
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+
+    if ((u16CmdLenIn != (U16) MON_SDI_READ_FIM_SUPPR_LEN) || (u16MaxRespOut < MON_SDI_FIM_SUPPR_RESP_LEN))
+    { //Command length invalid
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
+    }
+    else
+    {
+        // 1..2 : fault code
+        u16FaultCode = (U16)(((U16) pu8DataIn[MON_SDI_INDEX_1] << MON_SHIFT_VAR_BY_8) | pu8DataIn[MON_SDI_INDEX_2]);
+
+        if (u16FaultCode > FIM_DEDUP_CODES)
+        {
+            vMON_RespU8(&cResp, MON_SDI_RANGE_ERROR);
+        }
+        else
+        {
+            vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
+            vMON_RespU32Be(&cResp, u32FIM_DedupGetSuppressed(u16FaultCode));
+        }
+    }
+
+    return (s16MON_RespEnd(&cResp)); // return reply len
+}
+//  EndOfFunction s16MON_ReadFimSuppr **********************************************************************************
+
+//  EndOfFile mon_sdi_nvm.c ********************************************************************************************
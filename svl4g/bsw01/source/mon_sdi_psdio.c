@@ -38,6 +38,7 @@
 // 20.04.17        A. Mauro            1.33 / TC_007-96: LINT clean up
 // 2023.09.14      A. Mauro            1.34   Alignment with CA: name changed and other
 // 2023-12-06      C. Brancolini       Lint Plus clean up
+// 2026-10-19      agent               Responses built in place by mon_sdi_resp
 //
 //**********************************************************************************************************************
 
@@ -48,6 +49,7 @@
 #include "mon_psdio.h"                // MON PSDIO definitions
 #include "mon_cpu04.h"                // MON CPU04 definitions
 #include "mon.h"                      // MON SDI definitions
+#include "mon_sdi_resp.h"             // MON SDI response builder
 #include "bcl_s.h"                    // General BCL service definitions
 #include "sdi.h"                      // Error Codes
 #include "bcm_strt.h"                 // BCL system interface
@@ -77,15 +79,13 @@ s16SDI_CMD(s16MON_ReadPSDIO)
 {
 //************************************************ Function scope data *************************************************
 
-    U8 u8SDIIndex = MON_SDI_INDEX_1;                    // SDI command indexes
+    C_MON_RESP cResp;                     // SDI response
     U16 u16Mask;
-    C_WORD_BYTE cState;
+    U16 u16State;
     E_BCM_BOARD_STATE   eBoardState;      // Board state
-    S16 s16RetVal;                        // Function return value
-    U16 u16TempData;
 
 //*************************************************** Function code ****************************************************
-    (void)u16MaxRespOut; // unused parameter
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
 
     // Check Board State:
     eBoardState = eBCM_StrtGetBoardState();
@@ -93,11 +93,10 @@ s16SDI_CMD(s16MON_ReadPSDIO)
     // Build reply message:
     if (eBoardState == eBCM_BS_TEST)
     {
-        cState.u16Data = 0;
+        u16State = 0;
         if (u16CmdLenIn != (U16) MON_SDI_READ_PSDIO_LEN)
         { //Command length invalid
-            pu8DataOut[u8SDIIndex] = MON_SDI_INVALID_COMMAND;
-            u8SDIIndex++;
+            vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
         }
         else
         {
@@ -109,42 +108,29 @@ s16SDI_CMD(s16MON_ReadPSDIO)
                                               // Get value High Byte
 
             // Mask for reading
-            u16TempData = cState.u16Data; // used to avoid compiler warning
             if ( boMON_InitPSDIOChannels(u16Mask, ePSD_INPUT, DUMMY_OUT_VAL) == (BOOLEAN)FALSE )
             {
-                pu8DataOut[u8SDIIndex] = MON_SDI_CHANNEL_ERROR;
-                u8SDIIndex++;
-                return ((S16)u8SDIIndex); // an error occurred on init
+                return (s16MON_RespError(&cResp, MON_SDI_CHANNEL_ERROR)); // an error occurred on init
             }
-            if ( boMON_GetPSDIOChannels(&u16Mask, &u16TempData) == (BOOLEAN)FALSE )
+            if ( boMON_GetPSDIOChannels(&u16Mask, &u16State) == (BOOLEAN)FALSE )
             {
-                pu8DataOut[u8SDIIndex] = MON_SDI_CHANNEL_ERROR;
-                u8SDIIndex++;
-                return ((S16)u8SDIIndex); // an error occurred on init
+                return (s16MON_RespError(&cResp, MON_SDI_CHANNEL_ERROR)); // an error occurred on init
             }
-            cState.u16Data = u16TempData; // used to avoid compiler warning
 //lint -e725
-            cState.u16Data = (U16)(cState.u16Data & u16Mask); // Get relevant bits
-            pu8DataOut[u8SDIIndex] = MON_SDI_NO_ERROR; // request is done properly,
+            u16State = (U16)(u16State & u16Mask); // Get relevant bits
+            vMON_RespU8(&cResp, MON_SDI_NO_ERROR); // request is done properly,
 // ack with NO_ERROR
-            u8SDIIndex++;
-            // TC_005-66: inverted returned values
-            pu8DataOut[u8SDIIndex] = cState.au8Data[1]; // @suppress("No magic numbers")
-            u8SDIIndex++;
-            pu8DataOut[u8SDIIndex] = cState.au8Data[0]; // put result in ack msg
-            u8SDIIndex++;
+            // TC_005-66: inverted returned values, port B (high byte) first
+            vMON_RespU16Be(&cResp, u16State); // put result in ack msg
         }
     }
     else
     {
-        u8SDIIndex = MON_SDI_INDEX_1;
-        pu8DataOut[u8SDIIndex] = MON_SDI_INVALID_COMMAND;
-        u8SDIIndex++;
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
     }
-    s16RetVal = (S16) u8SDIIndex;
 
 //lint -e818
-    return (s16RetVal); // return reply len
+    return (s16MON_RespEnd(&cResp)); // return reply len
 }
 //  EndOfFunction s16MON_ReadPSDIO *************************************************************************************
 
@@ -157,15 +143,14 @@ s16SDI_CMD(s16MON_WritePSDIO)
 {
     //lint -e818
 //************************************************ Function scope data *************************************************
-    U8 u8SDIRespIndex = MON_SDI_INDEX_1;  // SDI response index
+    C_MON_RESP cResp;                     // SDI response
     U8 u8SDICmdIndex;                     // SDI command index
     U16 u16Mask;                          // Mask and state for reading psd
     U16 u16Val;                           // psd value
     E_BCM_BOARD_STATE   eBoardState;      // Board state
-    S16 s16RetVal;                        // Function return value
 
 //*************************************************** Function code ****************************************************
-    (void)u16MaxRespOut; // unused parameter
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
 
     // Check Board State:
     eBoardState = eBCM_StrtGetBoardState();
@@ -175,8 +160,7 @@ s16SDI_CMD(s16MON_WritePSDIO)
     {
         if (u16CmdLenIn != (U16) MON_SDI_WRITE_PSDIO_LEN)
         { //Command length invalid
-            pu8DataOut[u8SDIRespIndex] = MON_SDI_INVALID_COMMAND;
-            u8SDIRespIndex++;
+            vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
         }
         else
         {
@@ -197,26 +181,21 @@ s16SDI_CMD(s16MON_WritePSDIO)
             // Init  PSD IO channels with received mask and value
             if ( boMON_InitPSDIOChannels(u16Mask, ePSD_OUTPUT, u16Val) == (BOOLEAN)FALSE )
             {
-                pu8DataOut[u8SDIRespIndex] = MON_SDI_CHANNEL_ERROR;
-                u8SDIRespIndex++;
+                vMON_RespU8(&cResp, MON_SDI_CHANNEL_ERROR);
             }
             else
             {
                 // No error so far, prepare reply
-                pu8DataOut[u8SDIRespIndex] = MON_SDI_NO_ERROR;
-                u8SDIRespIndex++;
+                vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
             }
         }
     }
     else
     {
-        u8SDIRespIndex = MON_SDI_INDEX_1;
-        pu8DataOut[u8SDIRespIndex] = MON_SDI_INVALID_COMMAND;
-        u8SDIRespIndex++;
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
     }
-    s16RetVal = (S16) u8SDIRespIndex;
 
-    return (s16RetVal); // return reply len
+    return (s16MON_RespEnd(&cResp)); // return reply len
 }
 //  EndOfFunction s16MON_WritePSDIO ************************************************************************************
 
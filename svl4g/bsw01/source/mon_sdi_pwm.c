@@ -35,6 +35,9 @@
 // 20.04.17        A. Mauro            0.8  / TC_007-96: LINT clean up
 // 2023.09.14      A. Mauro            0.9   Alignment with CA: name changed and other
 // 2023-12-05      C. Brancolini       Lint Plus clean up
+// 2026-10-19      agent               Responses built in place by mon_sdi_resp
+// 2026-10-19      agent               s16MON_ReadPWM: values not up to date while the PWM acquisition is stopped,
+//                                     duty cycle limits from mon_cpu04.h
 //
 //**********************************************************************************************************************
 
@@ -45,6 +48,7 @@
 #include "mon_cpu04_genrl_sdi_i.h"    // MON CPU04 SDI command handler
 #include "mon_pwm.h"
 #include "mon_cpu04.h"
+#include "mon_sdi_resp.h"               // MON SDI response builder
 #include "ios_hal.h"                    // Hardware Abstraction Layer
 #include "bcl_s.h"                      // General BCL service definitions
 #include "sdi.h"                                            // Error Codes
@@ -54,11 +58,6 @@
 #define MON_NUMBER_FIN_CHNL  (U8)2           //!< Number of FIs
 #define MON_NUMBER_FOUT_CHNL (U8)2           //!< Number of FOs
 #define MON_FIRST_CH_HANDLE  (U8)0           //!< Start point
-#define MON_DUTY_CYCLE_0PERC (U32)1000   //!< Duty Cycle 0%
-#define MON_DUTY_CYCLE_100PERC (U32)0    //!< Duty Cycle 100%
-#define MON_READPWM_REPLY_POS_UPTODATE      (U8)3   //!< Position up to date flag in Read PWM reply
-#define MON_READPWM_REPLY_POS_LOWBYTE      (U8)4   //!< position low-byte in Read PWM reply
-#define MON_READPWM_REPLY_POS_HIGHBYTE     (U8)5   //!< position high-byte in Read PWM reply
 
 #define MON_WRITEPWM_CMD_POS_DUTYC_LOWBYTE      (U8)3   //!< position low-byte in Read PWM cmd
 #define MON_WRITEPWM_CMD_POS_DUTYC_HIGHBYTE     (U8)4   //!< position high-byte in Read PWM cmd
@@ -66,7 +65,6 @@
 
 #define MON_CHANNEL_NUM_POS_VALUE  (U8)1     //!< position of channel in input
 #define MON_READPWM_CMD_PARA_LEN     (U8)1   //!< byte length of parameters for each PWM port in Read PWM cmd
-#define MON_READPWM_REPLY_PARA_LEN   (U8)3   //!< byte length of parameters for each PWM port in Read PWM reply
 #define MON_WRITEPWM_CMD_PARA_LEN    (U8)3   //!< byte length of parameters for each PWM port in Write PWM cmd
 
 
@@ -92,13 +90,12 @@
 s16SDI_CMD(s16MON_ReadPWM)
 {
     //************************************************ Function scope data *********************************************
-    S16 s16RetVal = 0;                              // Return value of function
     U8 u8NumberOfInputs = 0;                        // Number of PWM Inputs to be read
     U32 au32PWMInput[MON_NUMBER_FIN_CHNL] = {0, 0 }; // PWM input values
     BOOLEAN aboUpToDateBit[MON_NUMBER_FIN_CHNL] = {0, 0 };
                                                     // Status up to date bit
     U8 u8Cnt;                                       // Counter for loops
-    U16 u16SDIRespIndex = MON_SDI_INDEX_1;           // SDI response index
+    C_MON_RESP cResp;                               // SDI response
     E_BCM_BOARD_STATE   eBoardState;                // Board state
 
 
@@ -106,7 +103,7 @@ s16SDI_CMD(s16MON_ReadPWM)
 
     //*************************************************** Function code ************************************************
 
-    (void)u16MaxRespOut; // unused parameter
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
 
     // Check Board State:
     eBoardState = eBCM_StrtGetBoardState();
@@ -122,22 +119,16 @@ s16SDI_CMD(s16MON_ReadPWM)
         {
             // Number of PWM Inputs to be read is greater than the number of freq ip channels
             // Reply with RANGE_ERROR
-            pu8DataOut[u16SDIRespIndex] = MON_SDI_RANGE_ERROR;
-            u16SDIRespIndex++;
-            s16RetVal = (S16) u16SDIRespIndex;
+            vMON_RespU8(&cResp, MON_SDI_RANGE_ERROR);
         }// Check for invalid command
         else if (u16CmdLenIn != (((U16)u8NumberOfInputs * MON_READPWM_CMD_PARA_LEN) + MON_SDI_PAR_OFFSET))
         {   //Command length invalid
-            pu8DataOut[u16SDIRespIndex] = MON_SDI_INVALID_COMMAND;
-            u16SDIRespIndex++;
-            s16RetVal = (S16) u16SDIRespIndex;
+            vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
         }// Check for channel error
         else if ((pu8DataIn[MON_SDI_INDEX_2] > MON_CHANNEL_NUM_POS_VALUE) ||
                  (pu8DataIn[MON_SDI_INDEX_3] > MON_CHANNEL_NUM_POS_VALUE))
         {
-            pu8DataOut[u16SDIRespIndex] = MON_SDI_CHANNEL_ERROR; // set channel error
-            u16SDIRespIndex++;
-            s16RetVal = (S16) u16SDIRespIndex;
+            vMON_RespU8(&cResp, MON_SDI_CHANNEL_ERROR); // set channel error
         }
         else
         {
@@ -152,41 +143,33 @@ s16SDI_CMD(s16MON_ReadPWM)
 
                 // Handle up-to-date flag:
                 // set to zero in case of duty cycle 0% or duty cycle 100%
+                // or while the PWM acquisition is stopped for the frequency inputs (TC_007-84)
                 if ( (au32PWMInput[u8Cnt] == MON_DUTY_CYCLE_0PERC) ||
-                     (au32PWMInput[u8Cnt] == MON_DUTY_CYCLE_100PERC) )
+                     (au32PWMInput[u8Cnt] == MON_DUTY_CYCLE_100PERC) ||
+                     (boMON_PwmDemodStopped() == TRUE) )
                 {
                     aboUpToDateBit[u8Cnt] = FALSE;
                 }
 
             }
-            pu8DataOut[u16SDIRespIndex] = MON_SDI_NO_ERROR;         // reset MON STATUS
-            u16SDIRespIndex++;
-            pu8DataOut[u16SDIRespIndex] = u8NumberOfInputs;         // Number of Inputs. Only
+            vMON_RespU8(&cResp, MON_SDI_NO_ERROR);         // reset MON STATUS
+            vMON_RespU8(&cResp, u8NumberOfInputs);         // Number of Inputs. Only
             // Needed once per call
-            u16SDIRespIndex++;
             for (u8Cnt = 0; u8Cnt < u8NumberOfInputs; u8Cnt++) // loop until all PWM In
-            { // signals wrote to
-                *(pu8DataOut + MON_READPWM_REPLY_POS_UPTODATE + (MON_READPWM_REPLY_PARA_LEN * u8Cnt)) =
-                    aboUpToDateBit[u8Cnt];
-                *(pu8DataOut + MON_READPWM_REPLY_POS_LOWBYTE + (MON_READPWM_REPLY_PARA_LEN * u8Cnt)) =
-                    (U8) au32PWMInput[u8Cnt];
-                *(pu8DataOut + MON_READPWM_REPLY_POS_HIGHBYTE + (MON_READPWM_REPLY_PARA_LEN * u8Cnt)) =
-                    (U8) (au32PWMInput[u8Cnt] >> MON_SHIFT_VAR_BY_8);
+            { // signals wrote to, duty cycle low-byte first
+                vMON_RespU8(&cResp, (U8) aboUpToDateBit[u8Cnt]);
+                vMON_RespU16Le(&cResp, (U16) au32PWMInput[u8Cnt]);
             }
-            // length of reply message
-            u16SDIRespIndex = (u16SDIRespIndex + (MON_READPWM_REPLY_PARA_LEN * (U16)u8NumberOfInputs));
-            s16RetVal = (S16) u16SDIRespIndex;
         }
     }
     else
     {
         // Board not in test mode
         // reply with invalid command
-        pu8DataOut[u16SDIRespIndex] = MON_SDI_INVALID_COMMAND;
-        u16SDIRespIndex++;
-        s16RetVal = (S16) u16SDIRespIndex;
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
     }
-    return (s16RetVal);
+    // length of reply message
+    return (s16MON_RespEnd(&cResp));
 }
 // EndOfFunction s16MON_ReadPWM ****************************************************************************************
 
@@ -199,14 +182,13 @@ s16SDI_CMD(s16MON_ReadPWM)
 s16SDI_CMD(s16MON_WritePWM)
 {
     //************************************************ Function scope data *********************************************
-    S16 s16RetVal = 0;                               // Return value of function
     U8  u8NumberOfOutputs;                           // Number of Outputs received
     U8  u8OutputCnt;                                 // Internal Counter
     U8  u8OutputNumber;                              // Number of outputs internal used
     U32 u32PWMDutyCycle;                             // duty cycle
     U32 u32PWMTemp;                                  // duty cycle
     U8  u8Offset = 0;                                // offset for getting information
-    U8  u8SDIRespIndex = MON_SDI_INDEX_1;                              // SDI command index
+    C_MON_RESP cResp;                                // SDI response
     BOOLEAN boReturn;                                // Return value of function
     E_BCM_BOARD_STATE eBoardState;                   // Board state
 
@@ -215,7 +197,7 @@ s16SDI_CMD(s16MON_WritePWM)
 
     //*************************************************** Function code ************************************************
 
-    (void)u16MaxRespOut; // unused parameter
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
 
     // Check Board State:
     eBoardState = eBCM_StrtGetBoardState();
@@ -229,16 +211,13 @@ s16SDI_CMD(s16MON_WritePWM)
         if (u8NumberOfOutputs > MON_NUMBER_FOUT_CHNL)    // N > no of freq output channels
         {
             // too big - reply with RANGE_ERROR
-            pu8DataOut[u8SDIRespIndex] = MON_SDI_RANGE_ERROR;
-            u8SDIRespIndex++;
-            return ((S16)u8SDIRespIndex);
+            return (s16MON_RespError(&cResp, MON_SDI_RANGE_ERROR));
         }
 
         if (u16CmdLenIn != (((U16)u8NumberOfOutputs * MON_WRITEPWM_CMD_PARA_LEN) + MON_SDI_PAR_OFFSET))
         {
             //Command length invalid
-            pu8DataOut[u8SDIRespIndex] = MON_SDI_INVALID_COMMAND;
-            u8SDIRespIndex++;
+            vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
         }
         else
         {
@@ -263,27 +242,21 @@ s16SDI_CMD(s16MON_WritePWM)
                 if (boReturn != (BOOLEAN)TRUE)
                 {
                     // Error in writing, prepare reply message
-                    pu8DataOut[u8SDIRespIndex] = MON_SDI_CHANNEL_ERROR;
-                    u8SDIRespIndex++;
-                    s16RetVal = (S16) u8SDIRespIndex;
-                    return (s16RetVal);
+                    return (s16MON_RespError(&cResp, MON_SDI_CHANNEL_ERROR));
                 }
                 u8Offset += MON_WRITEPWM_CMD_PARA_LEN;      // increase by three
             }
-            pu8DataOut[u8SDIRespIndex] = MON_SDI_NO_ERROR;       // No Error
-            u8SDIRespIndex++;
+            vMON_RespU8(&cResp, MON_SDI_NO_ERROR);       // No Error
         }
     }
     else
     {
         // Board not in test mode
         // reply with invalid command
-        pu8DataOut[u8SDIRespIndex] = MON_SDI_INVALID_COMMAND;
-        u8SDIRespIndex++;
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
     }
-    s16RetVal = (S16) u8SDIRespIndex;
 //lint -e818
-    return (s16RetVal);
+    return (s16MON_RespEnd(&cResp));
 }
 
 // EndOfFunction s16MON_WritePWM ***************************************************************************************
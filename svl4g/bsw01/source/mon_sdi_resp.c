@@ -0,0 +1,256 @@
+//**********************************************************************************************************************
+//
+//                                          mon_sdi_resp.c
+//
+//**********************************************************************************************************************
+//
+//                                    Copyrights(c) 2026 by KNORR-BREMSE,
+//                                       Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date    2026-10-19
+//! @author  agent
+//
+//**********************************************************************************************************************
+//!
+//! @file
+//! @brief  Service Monitor for project ESRA
+//!         Module contains the response builder of the MON SDI commands (see mon_sdi_resp.h).
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date            Author              Changes
+// 2026-10-19      agent               Start
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include <string.h>                   // Include memcpy
+#include "mon_cpu04.h"                // MON CPU04 definitions
+#include "mon.h"                      // MON SDI definitions
+#include "mon_sdi_resp.h"             // Own interface
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function vMON_RespInit
+//
+//**********************************************************************************************************************
+void vMON_RespInit (C_MON_RESP* pcResp, U8* pu8DataOut, U16 u16MaxRespOut)
+{
+//************************************************ Function scope data *************************************************
+
+//*************************************************** Function code ****************************************************
+    pcResp->pu8Msg = pu8DataOut;
+    pcResp->u16Max = u16MaxRespOut;
+    pcResp->u16Len = MON_SDI_INDEX_1;
+    pcResp->boOverflow = FALSE;
+}
+//  EndOfFunction vMON_RespInit ****************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function vMON_RespU8
+//
+//**********************************************************************************************************************
+void vMON_RespU8 (C_MON_RESP* pcResp, U8 u8Value)
+{
+//************************************************ Function scope data *************************************************
+    U8* pu8Dst;                           // Appended byte
+
+//*************************************************** Function code ****************************************************
+    pu8Dst = pu8MON_RespReserve(pcResp, 1U);
+    if (pu8Dst != KB_NULL_PTR)
+    {
+        pu8Dst[0] = u8Value;
+    }
+}
+//  EndOfFunction vMON_RespU8 ******************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function vMON_RespU16Be
+//
+//**********************************************************************************************************************
+void vMON_RespU16Be (C_MON_RESP* pcResp, U16 u16Value)
+{
+//************************************************ Function scope data *************************************************
+    U8* pu8Dst;                           // Appended bytes
+
+//*************************************************** Function code ****************************************************
+    pu8Dst = pu8MON_RespReserve(pcResp, 2U);
+    if (pu8Dst != KB_NULL_PTR)
+    {
+        pu8Dst[0] = (U8)(u16Value >> MON_SHIFT_VAR_BY_8);
+        pu8Dst[1] = (U8) u16Value;
+    }
+}
+//  EndOfFunction vMON_RespU16Be ***************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function vMON_RespU16Le
+//
+//**********************************************************************************************************************
+void vMON_RespU16Le (C_MON_RESP* pcResp, U16 u16Value)
+{
+//************************************************ Function scope data *************************************************
+    U8* pu8Dst;                           // Appended bytes
+
+//*************************************************** Function code ****************************************************
+    pu8Dst = pu8MON_RespReserve(pcResp, 2U);
+    if (pu8Dst != KB_NULL_PTR)
+    {
+        pu8Dst[0] = (U8) u16Value;
+        pu8Dst[1] = (U8)(u16Value >> MON_SHIFT_VAR_BY_8);
+    }
+}
+//  EndOfFunction vMON_RespU16Le ***************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function vMON_RespU32Be
+//
+//**********************************************************************************************************************
+void vMON_RespU32Be (C_MON_RESP* pcResp, U32 u32Value)
+{
+//************************************************ Function scope data *************************************************
+    U8* pu8Dst;                           // Appended bytes
+
+//*************************************************** Function code ****************************************************
+    pu8Dst = pu8MON_RespReserve(pcResp, 4U);
+    if (pu8Dst != KB_NULL_PTR)
+    {
+        pu8Dst[0] = (U8)(u32Value >> 24U); // @suppress("No magic numbers")
+        pu8Dst[1] = (U8)(u32Value >> 16U); // @suppress("No magic numbers")
+        pu8Dst[2] = (U8)(u32Value >> MON_SHIFT_VAR_BY_8);
+        pu8Dst[3] = (U8) u32Value;
+    }
+}
+//  EndOfFunction vMON_RespU32Be ***************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function vMON_RespBytes
+//
+//**********************************************************************************************************************
+void vMON_RespBytes (C_MON_RESP* pcResp, const U8* pu8Data, U16 u16Len)
+{
+//************************************************ Function scope data *************************************************
+    U8* pu8Dst;                           // Appended bytes
+
+//*************************************************** Function code ****************************************************
+    pu8Dst = pu8MON_RespReserve(pcResp, u16Len);
+    if ((pu8Dst != KB_NULL_PTR) && (u16Len != 0U))
+    {
+        memcpy((void*) pu8Dst, (const void*) pu8Data, (size_t) u16Len);
+    }
+}
+//  EndOfFunction vMON_RespBytes ***************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function pu8MON_RespReserve
+//
+//**********************************************************************************************************************
+U8* pu8MON_RespReserve (C_MON_RESP* pcResp, U16 u16Len)
+{
+//************************************************ Function scope data *************************************************
+    U8* pu8Dst = KB_NULL_PTR;             // Function return value
+
+//*************************************************** Function code ****************************************************
+    if ((pcResp->boOverflow == FALSE) && (((U32) pcResp->u16Len + u16Len) <= (U32) pcResp->u16Max))
+    {
+        pu8Dst = &pcResp->pu8Msg[pcResp->u16Len];
+        pcResp->u16Len = (U16)(pcResp->u16Len + u16Len);
+    }
+    else
+    {
+        pcResp->boOverflow = TRUE;
+    }
+
+    return (pu8Dst);
+}
+//  EndOfFunction pu8MON_RespReserve ***********************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function u16MON_RespFree
+//
+//**********************************************************************************************************************
+U16 u16MON_RespFree (const C_MON_RESP* pcResp)
+{
+//************************************************ Function scope data *************************************************
+    U16 u16Free = 0U;                     // Function return value
+
+//*************************************************** Function code ****************************************************
+    if ((pcResp->boOverflow == FALSE) && (pcResp->u16Len < pcResp->u16Max))
+    {
+        u16Free = (U16)(pcResp->u16Max - pcResp->u16Len);
+    }
+
+    return (u16Free);
+}
+//  EndOfFunction u16MON_RespFree **************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_RespError
+//
+//**********************************************************************************************************************
+S16 s16MON_RespError (C_MON_RESP* pcResp, U8 u8Status)
+{
+//************************************************ Function scope data *************************************************
+
+//*************************************************** Function code ****************************************************
+    pcResp->u16Len = MON_SDI_INDEX_1;
+    pcResp->boOverflow = FALSE;
+    vMON_RespU8(pcResp, u8Status);
+
+    return ((S16) pcResp->u16Len);
+}
+//  EndOfFunction s16MON_RespError *************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_RespEnd
+//
+//**********************************************************************************************************************
+S16 s16MON_RespEnd (C_MON_RESP* pcResp)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16RetVal;                        // Function return value
+
+//*************************************************** Function code ****************************************************
+    if (pcResp->boOverflow == TRUE)
+    {
+        s16RetVal = s16MON_RespError(pcResp, MON_SDI_RANGE_ERROR);
+    }
+    else
+    {
+        s16RetVal = (S16) pcResp->u16Len;
+    }
+
+    return (s16RetVal);
+}
+//  EndOfFunction s16MON_RespEnd ***************************************************************************************
+
+//  EndOfFile mon_sdi_resp.c *******************************************************************************************
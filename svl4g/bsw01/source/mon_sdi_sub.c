@@ -0,0 +1,558 @@
+//**********************************************************************************************************************
+//
+//                                          mon_sdi_sub.c
+//
+//**********************************************************************************************************************
+//
+//                                    Copyrights(c) 2026 by KNORR-BREMSE,
+//                                       Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date    2026-10-19
+//! @author  agent
+//
+//**********************************************************************************************************************
+//!
+//! @file
+//! @brief  Service Monitor for project ESRA
+//!         Module contains the subscription to IOS values: the subscribed channels are sampled periodically by the
+//!         board in a 10 ms time slice, the timestamped samples are buffered and read by the tester in blocks.
+//!         The samples are handed over between the time slice (writes u16MON_SubHead, u32MON_SubLost) and the SDI
+//!         process (writes u16MON_SubTail); the subscription is changed by the SDI process while the time slice is
+//!         deactivated.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date            Author              Changes
+// 2026-10-19      agent               Start
+// 2026-10-19      agent               PWM acquisition stopped and restarted by vMON_PwmDemodStop/vMON_PwmDemodRestart
+// 2026-10-19      agent               PWM samples not up to date while the PWM acquisition is stopped, duty cycle and
+//                                     frequency scaling from mon_cpu04.h
+// 2026-10-19      agent               Command length checked before the period is read
+// 2026-10-19      agent               Period counted from the first frame
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "mon_cpu04_genrl_sdi_i.h"    // MON CPU04 SDI command handler
+#include "mon_binio.h"                // MON binary IO definitions
+#include "mon_fin.h"                  // MON frequency IO definitions
+#include "mon_psdio.h"                // MON PSDIO definitions
+#include "mon_cpu04.h"                // MON CPU04 definitions
+#include "mon.h"                      // MON SDI definitions
+#include "mon_sdi_resp.h"             // MON SDI response builder
+#include "os.h"                       // Time slices, time
+#include "bcl_s.h"                    // General BCL service definitions
+#include "sdi.h"                      // Error Codes
+#include "bcm_strt.h"                 // BCL system interface
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Command MON_SDI_SUBSCRIBE:
+//!   command, period in ms (2), number of channels N, N times: type (MON_SUB_xxx), parameter 1, parameter 2.
+//!     MON_SUB_DIGIO : port, pin mask            -> sample: state (1)
+//!     MON_SUB_FREQ  : FIN channel, 0            -> sample: up to date flag (1), frequency in Hz (2)
+//!     MON_SUB_PWM   : PWM input channel, 0      -> sample: up to date flag (1), duty cycle (2)
+//!     MON_SUB_PSDIO : mask port A, mask port B  -> sample: state port B, state port A
+//!   N = 0 ends the subscription. A new subscription or N = 0 discards the frames of the previous one.
+//! Response:
+//!   status, length of a frame.
+//!
+//! Command MON_SDI_SUB_READ:
+//!   command.
+//! Response:
+//!   status, frames lost since the last read (2), length of a frame, number of frames M, M frames: time in ms (4),
+//!   one sample per channel in the order of the subscription.
+//!   The frames are read oldest first, as many as fit into the response. If the buffer is full, new frames are lost
+//!   until the tester reads again.
+//! Multi byte values are big endian.
+#define MON_SUB_DIGIO                 ((U8) 0)     //!< Binary IO port
+#define MON_SUB_FREQ                  ((U8) 1)     //!< Frequency input
+#define MON_SUB_PWM                   ((U8) 2)     //!< PWM input
+#define MON_SUB_PSDIO                 ((U8) 3)     //!< PSD IO ports
+
+#define MON_SUB_PARA_LEN              ((U16) 3U)   //!< Length of a channel in MON_SDI_SUBSCRIBE
+#define MON_SUB_READ_HDR_LEN          ((U16) 5U)   //!< Status, lost frames, frame length, number of frames
+#define MON_SUB_TIME_LEN              ((U8) 4U)    //!< Length of the time of a frame
+
+#define MON_SUB_MAX_CHNLS             ((U8) 8U)    //!< Maximum number of channels
+#define MON_SUB_PERIOD_MIN            ((U16) 10U)  //!< Minimum period in ms, the time slice
+#define MON_SUB_PERIOD_MAX            ((U16) 60000U) //!< Maximum period in ms
+#define MON_SUB_BUFF_SIZE             ((U16) 1024U) //!< Size of the frame buffer
+
+#define MON_SUB_PWM_CHNL_MAX          ((U8) 1U)    //!< Highest PWM input channel
+
+//**************************************** Type definitions ( typedef ) ************************************************
+//! Subscribed channel
+typedef struct
+{
+    U8  u8Type;                           //!< MON_SUB_xxx
+    U8  u8Chnl;                           //!< Port or channel
+    U16 u16Mask;                          //!< Pin mask of MON_SUB_DIGIO and MON_SUB_PSDIO
+} C_MON_SUB_CHNL;
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+//! Subscribed channels
+static C_MON_SUB_CHNL acMON_SubChnl[MON_SUB_MAX_CHNLS];
+
+//! Number of subscribed channels, 0: no subscription
+static U8 u8MON_SubChnls = 0U;
+
+//! Period in ms
+static U16 u16MON_SubPeriod = 0U;
+
+//! Time of the last frame in ms
+static U32 u32MON_SubLastTime = 0U;
+
+//! No frame taken yet, the first frame starts the period
+static BOOLEAN boMON_SubFirst = FALSE;
+
+//! Length of a frame, 0: no frames
+static U8 u8MON_SubFrameLen = 0U;
+
+//! Number of frames the buffer can hold plus one
+static U16 u16MON_SubSlots = 0U;
+
+//! Frame buffer
+static U8 au8MON_SubBuff[MON_SUB_BUFF_SIZE];
+
+//! Next frame to write, written by the time slice
+static volatile U16 u16MON_SubHead = 0U;
+
+//! Next frame to read, written by the SDI process
+static volatile U16 u16MON_SubTail = 0U;
+
+//! Frames lost, written by the time slice
+static volatile U32 u32MON_SubLost = 0U;
+
+//! Frames lost at the last read
+static U32 u32MON_SubLostRead = 0U;
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+static void vMON_SubCycl10ms (void);
+static void vMON_SubStop (void);
+static U8 u8MON_SubSampleLen (U8 u8Type);
+static void vMON_SubSample (U8* pu8Frame, U32 u32Now);
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_Subscribe
+//
+//**********************************************************************************************************************
+s16SDI_CMD(s16MON_Subscribe)
+{
+//************************************************ Function scope data *************************************************
+    C_MON_RESP cResp;                     // SDI response
+    U8* pu8Para;                          // Parameters of the current channel
+    U8  u8Chnls;                          // Number of channels
+    U8  u8Cnt;                            // counting variable
+    U8  u8FrameLen = MON_SUB_TIME_LEN;    // Length of a frame
+    U16 u16Period;                        // Period in ms
+    U16 u16Mask;                          // Pin mask
+    BOOLEAN boFreq = FALSE;               // Frequency inputs subscribed
+    BOOLEAN boPwm = FALSE;                // PWM inputs subscribed
+    BOOLEAN boInit = TRUE;                // Channels initialized, time slice activated
+    U8 u8Status = MON_SDI_NO_ERROR;       // Response status
+
+//*************************************************** Function code ****************************************************
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+
+    if (eBCM_StrtGetBoardState() != eBCM_BS_TEST)
+    {
+        // Board not in test mode
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+    }
+
+    if (u16CmdLenIn < (U16) MON_SDI_SUBSCRIBE_LEN)
+    { //Command length invalid, the fixed part is missing
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+    }
+
+    // 1, 2 : period, 3 : number of channels
+    u16Period = (U16)(((U16) pu8DataIn[MON_SDI_INDEX_1] << MON_SHIFT_VAR_BY_8) | pu8DataIn[MON_SDI_INDEX_2]);
+    u8Chnls = pu8DataIn[MON_SDI_INDEX_3];
+
+    if (u16CmdLenIn != ((U16) MON_SDI_SUBSCRIBE_LEN + ((U16) u8Chnls * MON_SUB_PARA_LEN)))
+    { //Command length invalid
+        return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+    }
+
+    if ((u8Chnls > MON_SUB_MAX_CHNLS) ||
+        ((u8Chnls != 0U) && ((u16Period < MON_SUB_PERIOD_MIN) || (u16Period > MON_SUB_PERIOD_MAX))))
+    {
+        return (s16MON_RespError(&cResp, MON_SDI_RANGE_ERROR));
+    }
+
+    // Check the channels before the current subscription is changed
+    pu8Para = &pu8DataIn[MON_SDI_SUBSCRIBE_LEN];
+    for (u8Cnt = 0U; (u8Cnt < u8Chnls) && (u8Status == MON_SDI_NO_ERROR); u8Cnt++)
+    {
+        if (pu8Para[0] == MON_SUB_FREQ)
+        {
+            boFreq = TRUE;
+            u8Status = (pu8Para[1] < u8MON_MaxFreqChnls) ? MON_SDI_NO_ERROR : MON_SDI_CHANNEL_ERROR;
+        }
+        else if (pu8Para[0] == MON_SUB_PWM)
+        {
+            boPwm = TRUE;
+            u8Status = (pu8Para[1] <= MON_SUB_PWM_CHNL_MAX) ? MON_SDI_NO_ERROR : MON_SDI_CHANNEL_ERROR;
+        }
+        else if ((pu8Para[0] != MON_SUB_DIGIO) && (pu8Para[0] != MON_SUB_PSDIO))
+        {
+            u8Status = MON_SDI_RANGE_ERROR;
+        }
+        else
+        {
+            // Checked by the initialization
+        }
+        u8FrameLen = (U8)(u8FrameLen + u8MON_SubSampleLen(pu8Para[0]));
+        pu8Para = &pu8Para[MON_SUB_PARA_LEN];
+    }
+
+    // The PWM acquisition is stopped while frequency inputs are read (TC_007-84)
+    if ((u8Status == MON_SDI_NO_ERROR) && (boFreq == TRUE) && (boPwm == TRUE))
+    {
+        u8Status = MON_SDI_CHANNEL_ERROR;
+    }
+
+    if (u8Status != MON_SDI_NO_ERROR)
+    {
+        return (s16MON_RespError(&cResp, u8Status));
+    }
+
+    // The current subscription ends, its frames are discarded
+    vMON_SubStop();
+    u8MON_SubFrameLen = 0U;
+    u16MON_SubHead = 0U;
+    u16MON_SubTail = 0U;
+    u32MON_SubLostRead = u32MON_SubLost;
+
+    pu8Para = &pu8DataIn[MON_SDI_SUBSCRIBE_LEN];
+    for (u8Cnt = 0U; (u8Cnt < u8Chnls) && (boInit == TRUE); u8Cnt++)
+    {
+        acMON_SubChnl[u8Cnt].u8Type = pu8Para[0];
+        acMON_SubChnl[u8Cnt].u8Chnl = pu8Para[1];
+        u16Mask = (U16)(((U16) pu8Para[2] << MON_SHIFT_VAR_BY_8) | pu8Para[1]);
+
+        if (pu8Para[0] == MON_SUB_DIGIO)
+        {
+            acMON_SubChnl[u8Cnt].u16Mask = pu8Para[2];
+            boInit = boMON_InitBinIoChannels(pu8Para[1], pu8Para[2], eINPUT, 0U);
+        }
+        else if (pu8Para[0] == MON_SUB_PSDIO)
+        {
+            acMON_SubChnl[u8Cnt].u16Mask = u16Mask;
+            boInit = boMON_InitPSDIOChannels(u16Mask, ePSD_INPUT, 0U);
+        }
+        else if (pu8Para[0] == MON_SUB_FREQ)
+        {
+            acMON_SubChnl[u8Cnt].u16Mask = 0U;
+            boInit = boMON_InitFINCaptChannel((E_FIN_CHNL_NUM) pu8Para[1]);
+        }
+        else
+        {
+            acMON_SubChnl[u8Cnt].u16Mask = 0U;
+        }
+        pu8Para = &pu8Para[MON_SUB_PARA_LEN];
+    }
+
+    if (boInit == FALSE)
+    {
+        return (s16MON_RespError(&cResp, MON_SDI_CHANNEL_ERROR));
+    }
+
+    if (u8Chnls != 0U)
+    {
+        if (boFreq == TRUE)
+        {
+            vMON_PwmDemodStop(MON_PWM_DEMOD_SUB);
+        }
+
+        u8MON_SubChnls = u8Chnls;
+        u16MON_SubPeriod = u16Period;
+        u8MON_SubFrameLen = u8FrameLen;
+        u16MON_SubSlots = (U16)(MON_SUB_BUFF_SIZE / u8FrameLen);
+        // The first frame is taken in the next time slice
+        (void) s16OS_GetTimeMS(&u32MON_SubLastTime);
+        u32MON_SubLastTime -= u16Period;
+        boMON_SubFirst = TRUE;
+
+        // Inhibit lint warning 466 and note 9074 due to a missing void in boOS_ActivateFct declaration
+        //lint -save -e466 -e9074
+        boInit = boOS_ActivateFct(vMON_SubCycl10ms, (U8) eOS_SLICE_10MS);
+        //lint -restore
+        if (boInit == FALSE)
+        {
+            vMON_SubStop();
+            u8MON_SubFrameLen = 0U;
+            return (s16MON_RespError(&cResp, MON_SDI_INVALID_COMMAND));
+        }
+    }
+
+    vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
+    vMON_RespU8(&cResp, u8MON_SubFrameLen);
+
+    return (s16MON_RespEnd(&cResp)); // return reply len
+}
+//  EndOfFunction s16MON_Subscribe *************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function s16MON_SubRead
+//
+//**********************************************************************************************************************
+s16SDI_CMD(s16MON_SubRead)
+{
+//************************************************ Function scope data *************************************************
+    C_MON_RESP cResp;                     // SDI response
+    U8* pu8Frames;                        // Number of frames in the response
+    U8  u8Frames = 0U;                    // Number of frames
+    U16 u16Tail;                          // Next frame to read
+    U32 u32Lost;                          // Frames lost since the last read
+
+//*************************************************** Function code ****************************************************
+    (void)pu8DataIn;     // unused parameter
+
+    vMON_RespInit(&cResp, pu8DataOut, u16MaxRespOut);
+
+    if ((u16CmdLenIn != (U16) MON_SDI_SUB_READ_LEN) || (u8MON_SubFrameLen == 0U) ||
+        (u16MaxRespOut < (MON_SDI_INDEX_1 + MON_SUB_READ_HDR_LEN)))
+    { //Command length invalid or no subscription
+        vMON_RespU8(&cResp, MON_SDI_INVALID_COMMAND);
+    }
+    else
+    {
+        u32Lost = u32MON_SubLost - u32MON_SubLostRead;
+        u32MON_SubLostRead += u32Lost;
+
+        vMON_RespU8(&cResp, MON_SDI_NO_ERROR);
+        vMON_RespU16Be(&cResp, (u32Lost > 0xFFFFU) ? (U16) 0xFFFFU : (U16) u32Lost); // @suppress("No magic numbers")
+        vMON_RespU8(&cResp, u8MON_SubFrameLen);
+        pu8Frames = pu8MON_RespReserve(&cResp, 1U); // set at the end
+
+        u16Tail = u16MON_SubTail;
+        while ((u16Tail != u16MON_SubHead) && (u16MON_RespFree(&cResp) >= u8MON_SubFrameLen) &&
+               (u8Frames < 0xFFU)) // @suppress("No magic numbers")
+        {
+            vMON_RespBytes(&cResp, &au8MON_SubBuff[u16Tail * u8MON_SubFrameLen], u8MON_SubFrameLen);
+            u8Frames++;
+            u16Tail = (U16)((u16Tail + 1U) % u16MON_SubSlots);
+        }
+        u16MON_SubTail = u16Tail;
+
+        if (pu8Frames != KB_NULL_PTR)
+        {
+            *pu8Frames = u8Frames;
+        }
+    }
+
+    return (s16MON_RespEnd(&cResp)); // return reply len
+}
+//  EndOfFunction s16MON_SubRead ***************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function vMON_SubCycl10ms
+//
+//**********************************************************************************************************************
+//! @brief   Takes a frame of the subscribed channels when the period has elapsed. Ends the subscription when the
+//!          board leaves the test mode.
+//!
+//! @return  -
+//**********************************************************************************************************************
+static void vMON_SubCycl10ms (void)
+{
+//************************************************ Function scope data *************************************************
+    U32 u32Now = 0U;                      // Current time
+    U16 u16Head;                          // Next frame to write
+    U16 u16Next;                          // Frame after u16Head
+
+//*************************************************** Function code ****************************************************
+    if (eBCM_StrtGetBoardState() != eBCM_BS_TEST)
+    {
+        // The frames taken so far can still be read
+        vMON_SubStop();
+    }
+    else
+    {
+        (void) s16OS_GetTimeMS(&u32Now);
+        if ((u32Now - u32MON_SubLastTime) >= u16MON_SubPeriod)
+        {
+            // Keep the period unless the time slice was delayed by more than a period, the first frame starts it
+            u32MON_SubLastTime += u16MON_SubPeriod;
+            if (((u32Now - u32MON_SubLastTime) >= u16MON_SubPeriod) || (boMON_SubFirst == TRUE))
+            {
+                u32MON_SubLastTime = u32Now;
+            }
+            boMON_SubFirst = FALSE;
+
+            u16Head = u16MON_SubHead;
+            u16Next = (U16)((u16Head + 1U) % u16MON_SubSlots);
+            if (u16Next == u16MON_SubTail)
+            {
+                // Buffer full: the tester has to read
+                u32MON_SubLost++;
+            }
+            else
+            {
+                vMON_SubSample(&au8MON_SubBuff[u16Head * u8MON_SubFrameLen], u32Now);
+                u16MON_SubHead = u16Next;
+            }
+        }
+    }
+}
+//  EndOfFunction vMON_SubCycl10ms *************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function vMON_SubStop
+//
+//**********************************************************************************************************************
+//! @brief   Stops the sampling and restarts the PWM acquisition if it was stopped for the subscription.
+//!
+//! @return  -
+//**********************************************************************************************************************
+static void vMON_SubStop (void)
+{
+//************************************************ Function scope data *************************************************
+
+//*************************************************** Function code ****************************************************
+    // Inhibit lint warning 466 and note 9074 due to a missing void in boOS_DeActivateFct declaration
+    //lint -save -e466 -e9074
+    (void) boOS_DeActivateFct(vMON_SubCycl10ms, (U8) eOS_SLICE_10MS);
+    //lint -restore
+    u8MON_SubChnls = 0U;
+
+    vMON_PwmDemodRestart(MON_PWM_DEMOD_SUB);
+}
+//  EndOfFunction vMON_SubStop *****************************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function u8MON_SubSampleLen
+//
+//**********************************************************************************************************************
+//! @brief   Returns the length of the sample of a channel.
+//!
+//! @param[in]  u8Type : MON_SUB_xxx
+//! @return  Length of the sample
+//**********************************************************************************************************************
+static U8 u8MON_SubSampleLen (U8 u8Type)
+{
+//************************************************ Function scope data *************************************************
+    U8 u8Len;                             // Function return value
+
+//*************************************************** Function code ****************************************************
+    if (u8Type == MON_SUB_DIGIO)
+    {
+        u8Len = 1U;
+    }
+    else if (u8Type == MON_SUB_PSDIO)
+    {
+        u8Len = 2U;
+    }
+    else
+    {
+        u8Len = 3U; // up to date flag, value
+    }
+
+    return (u8Len);
+}
+//  EndOfFunction u8MON_SubSampleLen ***********************************************************************************
+
+//**********************************************************************************************************************
+//
+// Function vMON_SubSample
+//
+//**********************************************************************************************************************
+//! @brief   Writes a frame of the subscribed channels.
+//!
+//! @param[out] pu8Frame : Frame, u8MON_SubFrameLen bytes
+//! @param[in]  u32Now : Time of the frame in ms
+//! @return  -
+//**********************************************************************************************************************
+static void vMON_SubSample (U8* pu8Frame, U32 u32Now)
+{
+//************************************************ Function scope data *************************************************
+    U8  u8Cnt;                            // counting variable
+    U8  u8Idx = 0U;                       // Index in the frame
+    U8  u8Mask;                           // Pin mask of the binary IO port
+    U8  u8State;                          // State of the binary IO port
+    U16 u16Mask;                          // Pin mask of the PSD IO ports
+    U16 u16State = 0U;                    // State of the PSD IO ports
+    U16 u16Value;                         // Frequency or duty cycle
+    U32 u32Duty = 0U;                     // Duty cycle
+    BOOLEAN boUpToDate = FALSE;           // Up to date flag
+    C_FIN_MEASUREMENT_DATA cFinData;      // Frequency input
+
+//*************************************************** Function code ****************************************************
+    pu8Frame[u8Idx] = (U8)(u32Now >> 24U); // @suppress("No magic numbers")
+    u8Idx++;
+    pu8Frame[u8Idx] = (U8)(u32Now >> 16U); // @suppress("No magic numbers")
+    u8Idx++;
+    pu8Frame[u8Idx] = (U8)(u32Now >> MON_SHIFT_VAR_BY_8);
+    u8Idx++;
+    pu8Frame[u8Idx] = (U8) u32Now;
+    u8Idx++;
+
+    for (u8Cnt = 0U; u8Cnt < u8MON_SubChnls; u8Cnt++)
+    {
+        if (acMON_SubChnl[u8Cnt].u8Type == MON_SUB_DIGIO)
+        {
+            u8State = 0U;
+            (void) boMON_GetBinIOChannels(acMON_SubChnl[u8Cnt].u8Chnl, &u8Mask, &u8State);
+            pu8Frame[u8Idx] = (U8)(u8State & (U8) acMON_SubChnl[u8Cnt].u16Mask);
+            u8Idx++;
+        }
+        else if (acMON_SubChnl[u8Cnt].u8Type == MON_SUB_PSDIO)
+        {
+            u16Mask = acMON_SubChnl[u8Cnt].u16Mask;
+            (void) boMON_GetPSDIOChannels(&u16Mask, &u16State);
+            u16State = (U16)(u16State & acMON_SubChnl[u8Cnt].u16Mask);
+            pu8Frame[u8Idx] = (U8)(u16State >> MON_SHIFT_VAR_BY_8);
+            u8Idx++;
+            pu8Frame[u8Idx] = (U8) u16State;
+            u8Idx++;
+        }
+        else
+        {
+            if (acMON_SubChnl[u8Cnt].u8Type == MON_SUB_FREQ)
+            {
+                cFinData.u32Frequency = 0U;
+                cFinData.boFreqUpToDate = FALSE;
+                (void) boMON_GetFINCaptData((E_FIN_CHNL_NUM) acMON_SubChnl[u8Cnt].u8Chnl, &cFinData);
+                boUpToDate = cFinData.boFreqUpToDate;
+                u16Value = (U16)((cFinData.u32Frequency + MON_FREQ_OFFSET) / MON_FREQ_FACTOR);
+            }
+            else
+            {
+                (void) boMON_ReadPWM(acMON_SubChnl[u8Cnt].u8Chnl, &u32Duty, &boUpToDate);
+                if ((u32Duty == MON_DUTY_CYCLE_0PERC) || (u32Duty == MON_DUTY_CYCLE_100PERC) ||
+                    (boMON_PwmDemodStopped() == TRUE))
+                {
+                    boUpToDate = FALSE;
+                }
+                u16Value = (U16) u32Duty;
+            }
+            pu8Frame[u8Idx] = (U8) boUpToDate;
+            u8Idx++;
+            pu8Frame[u8Idx] = (U8)(u16Value >> MON_SHIFT_VAR_BY_8);
+            u8Idx++;
+            pu8Frame[u8Idx] = (U8) u16Value;
+            u8Idx++;
+        }
+    }
+}
+//  EndOfFunction vMON_SubSample ***************************************************************************************
+
+//  EndOfFile mon_sdi_sub.c ********************************************************************************************
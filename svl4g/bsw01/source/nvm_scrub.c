@@ -0,0 +1,325 @@
+//**********************************************************************************************************************
+//
+//                                                   nvm_scrub.c
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date 2026-10-19
+//! @author agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file nvm_scrub.c
+//! @brief NVM - Background scrubbing of the NVM areas.
+//!
+//!        One area after the other is read in chunks of u16NVM_CFG_ScrubChunkSize bytes. The reads are queued like
+//!        the reads of any other NVM user, at most one at a time, so queued operations are delayed by one chunk at
+//!        most. The CRC over a complete pass is compared with the reference CRC of the area:
+//!        - HAL write stamp changed during the pass: NVM wrote the area, the pass is discarded.
+//!        - HAL write stamp changed since the reference: the area was rewritten, the CRC becomes the new reference.
+//!        - Otherwise a different CRC is silent corruption, reported to FIM.
+//!        The error numbers (u16NVM_CFG_ScrubErrCode) come from the project configuration and its FIM-DSM fault map.
+//!
+//!        The scrubber runs in the 100ms BCM cyclic list (apvBCM_CFG_CyclFct, cfg_bcm.c), not in the BCM idle
+//!        process: the idle process has no hook in this tree and would not give a bounded pass time. A step only
+//!        collects the completed read, takes the CRC over one chunk (at most NVM_SCRUB_MAX_CHUNK_SIZE bytes) and
+//!        queues the next read; it never waits for NVM.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+// 2026-10-19   agent          CRC calculated with u32CRC32_Update (crc32_sl.h)
+// 2026-10-19   agent          FIM reports deduplicated by fim_dedup.h
+// 2026-10-19   agent          Error numbers above NVM_SCRUB_MAX_ERR_CODE not reported, scheduling documented
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include "kb_types.h"                                           // Standard definitions
+#include "kb_ret.h"                                             // Global Knorr-Bremse return value definitions
+#include "nvm_common.h"                                         // NVM Common definitions
+#include "nvm.h"                                                // NVM interfaces
+#include "nvm_hal_bs_i.h"                                       // NVM HAL write stamps
+#include "crc32_sl.h"                                           // CRC calculation
+#include "fim_dedup.h"                                          // Fault reporting, deduplicated
+#include "nvm_scrub.h"                                          // Own interface
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Start value of the CRC of a pass
+#define NVM_SCRUB_CRC_START              CRC32_START
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+//! CRC directory, one entry per scrubbed area
+static C_NVM_SCRUB_AREA_INFO acNVM_ScrubDir[NVM_SCRUB_MAX_AREAS];
+
+//! Read buffer of one chunk
+static U32 au32NVM_ScrubBuffer[NVM_SCRUB_MAX_CHUNK_SIZE / 4U];
+
+//! Operation status of the queued read, changed by NVM
+static E_NVM_OPERATION_STATUS eNVM_ScrubStatus = eNVM_STATUS_OPERATION_INIT;
+
+//! A read is queued, its result is not collected yet
+static BOOLEAN boNVM_ScrubReadQueued = FALSE;
+
+//! Length of the queued read
+static U32 u32NVM_ScrubReadLen = 0U;
+
+//! Index of the area of the current pass
+static U8 u8NVM_ScrubArea = 0U;
+
+//! Offset of the next chunk in the area
+static U32 u32NVM_ScrubPos = 0U;
+
+//! CRC of the current pass up to u32NVM_ScrubPos
+static U32 u32NVM_ScrubCrc = NVM_SCRUB_CRC_START;
+
+//! HAL write stamp of the area at the start of the current pass
+static U32 u32NVM_ScrubStampStart = 0U;
+
+//! Cycles since the last chunk was queued
+static U16 u16NVM_ScrubWait = 0U;
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+static void vNVM_ScrubQueueChunk (void);
+
+static void vNVM_ScrubAreaDone (void);
+
+static void vNVM_ScrubNextArea (void);
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+// Function vNVM_Cycl100ms_Scrub
+//**********************************************************************************************************************
+void vNVM_Cycl100ms_Scrub (void)
+{
+//************************************************ Function scope data *************************************************
+
+//*************************************************** Function code ****************************************************
+    if ((u16NVM_CFG_ScrubInterval != 0U) &&
+        (u8NVM_USR_ScrubAreaCnt != 0U) && (u8NVM_USR_ScrubAreaCnt <= NVM_SCRUB_MAX_AREAS) &&
+        (u16NVM_CFG_ScrubChunkSize != 0U) && (u16NVM_CFG_ScrubChunkSize <= NVM_SCRUB_MAX_CHUNK_SIZE))
+    {
+        // Collect the result of the queued read
+        if ((boNVM_ScrubReadQueued == TRUE) && (eNVM_ScrubStatus != eNVM_STATUS_OPERATION_BUSY))
+        {
+            boNVM_ScrubReadQueued = FALSE;
+
+            if (eNVM_ScrubStatus == eNVM_STATUS_OPERATION_DONE)
+            {
+                // The CRC continues from the start value, so the chunks add up to the CRC of the area. The
+                // reference CRCs are kept in RAM only, so the table driven CRC can be used.
+                u32NVM_ScrubCrc = u32CRC32_Update(u32NVM_ScrubCrc,
+                                                  (const U8*)(void*)au32NVM_ScrubBuffer,
+                                                  u32NVM_ScrubReadLen);
+                u32NVM_ScrubPos += u32NVM_ScrubReadLen;
+
+                if (u32NVM_ScrubPos >= acNVM_USR_ScrubArea[u8NVM_ScrubArea].u32Size)
+                {
+                    vNVM_ScrubAreaDone();
+                }
+            }
+            else
+            {
+                // Read failed, the pass is discarded. Device errors are reported by NVM itself.
+                vNVM_ScrubNextArea();
+            }
+        }
+
+        // Queue the next chunk, the interval limits the load of the NVM queue
+        if (boNVM_ScrubReadQueued == FALSE)
+        {
+            u16NVM_ScrubWait++;
+            if (u16NVM_ScrubWait >= u16NVM_CFG_ScrubInterval)
+            {
+                u16NVM_ScrubWait = 0U;
+                vNVM_ScrubQueueChunk();
+            }
+        }
+    }
+}
+//** EndOfFunction vNVM_Cycl100ms_Scrub ********************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_ScrubGetAreaInfo
+//**********************************************************************************************************************
+S16 s16NVM_ScrubGetAreaInfo (U8 u8Area, C_NVM_SCRUB_AREA_INFO* pcInfo)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                                  // Function return value
+
+//*************************************************** Function code ****************************************************
+    if (pcInfo == KB_NULL_PTR)
+    {
+        // null pointer, return error
+        s16Return = KB_RET_ERR_INST_PTR;
+    }
+    else if ((u8Area >= u8NVM_USR_ScrubAreaCnt) || (u8Area >= NVM_SCRUB_MAX_AREAS))
+    {
+        // Area not scrubbed
+        s16Return = KB_RET_ERR_ARG;
+    }
+    else
+    {
+        *pcInfo = acNVM_ScrubDir[u8Area];
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_ScrubGetAreaInfo *****************************************************************************
+
+// Function vNVM_ScrubQueueChunk
+//**********************************************************************************************************************
+//! @brief          Queues the read of the next chunk of the current area. A pass starts with the write stamp of the
+//!                 area.
+//!
+//! @return         -
+//!
+//! @remarks        If NVM does not accept the request (e.g. queue full), it is repeated after the next interval.
+//**********************************************************************************************************************
+static void vNVM_ScrubQueueChunk (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                                  // Return value of the called interfaces
+    const C_NVM_SCRUB_AREA* pcArea;                             // Current area
+
+//*************************************************** Function code ****************************************************
+    pcArea = &acNVM_USR_ScrubArea[u8NVM_ScrubArea];
+
+    // Start of a pass
+    if (u32NVM_ScrubPos == 0U)
+    {
+        u32NVM_ScrubCrc = NVM_SCRUB_CRC_START;
+        s16Return = s16NVM_HAL_AdpGetWriteStamp(pcArea->u8NvmID,
+                                                pcArea->u32DevOffset,
+                                                pcArea->u32Size,
+                                                &u32NVM_ScrubStampStart);
+    }
+
+    if (s16Return != KB_RET_OK)
+    {
+        // Device without write stamps, the area can not be scrubbed
+        vNVM_ScrubNextArea();
+    }
+    else
+    {
+        u32NVM_ScrubReadLen = pcArea->u32Size - u32NVM_ScrubPos;
+        if (u32NVM_ScrubReadLen > (U32)u16NVM_CFG_ScrubChunkSize)
+        {
+            u32NVM_ScrubReadLen = (U32)u16NVM_CFG_ScrubChunkSize;
+        }
+
+        eNVM_ScrubStatus = eNVM_STATUS_OPERATION_BUSY;
+        s16Return = s16NVM_ReadData(pcArea->u8NvmID,
+                                    pcArea->u8AreaID,
+                                    eNVM_QUEUE_MODE,
+                                    &eNVM_ScrubStatus,
+                                    u32NVM_ScrubPos,
+                                    (U8*)(void*)au32NVM_ScrubBuffer,
+                                    u32NVM_ScrubReadLen);
+
+        boNVM_ScrubReadQueued = (s16Return == KB_RET_OK) ? TRUE : FALSE;
+    }
+}
+//** EndOfFunction vNVM_ScrubQueueChunk ********************************************************************************
+
+// Function vNVM_ScrubAreaDone
+//**********************************************************************************************************************
+//! @brief          Completes the pass of the current area: updates the CRC directory and reports corruption.
+//!
+//! @return         -
+//!
+//! @remarks        A corrupt area stays corrupt until NVM rewrites it, then the fault is reset.
+//**********************************************************************************************************************
+static void vNVM_ScrubAreaDone (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                              // Return value of the called interfaces
+    U32 u32StampEnd = 0U;                                       // Write stamp at the end of the pass
+    const C_NVM_SCRUB_AREA* pcArea;                             // Current area
+    C_NVM_SCRUB_AREA_INFO* pcInfo;                              // Directory entry of the current area
+    U16 u16ErrCode;                                             // Error number of the current area
+
+//*************************************************** Function code ****************************************************
+    pcArea = &acNVM_USR_ScrubArea[u8NVM_ScrubArea];
+    pcInfo = &acNVM_ScrubDir[u8NVM_ScrubArea];
+    u16ErrCode = (U16)(u16NVM_CFG_ScrubErrCode + u8NVM_ScrubArea);
+
+    s16Return = s16NVM_HAL_AdpGetWriteStamp(pcArea->u8NvmID, pcArea->u32DevOffset, pcArea->u32Size, &u32StampEnd);
+
+    // A pass overlapping a write of NVM read partly old and partly new content, it is discarded
+    if ((s16Return == KB_RET_OK) && (u32StampEnd == u32NVM_ScrubStampStart))
+    {
+        pcInfo->u16PassCnt++;
+
+        if ((pcInfo->eState == eNVM_SCRUB_AREA_UNKNOWN) || (pcInfo->u32Stamp != u32StampEnd))
+        {
+            // First pass or area rewritten since the reference: new reference
+            if ((pcInfo->eState == eNVM_SCRUB_AREA_CORRUPT) && (u16ErrCode <= NVM_SCRUB_MAX_ERR_CODE))
+            {
+                (void) s16FIM_DedupResetFault((U8) u16ErrCode, NVM_ID);
+            }
+            pcInfo->u32Crc = u32NVM_ScrubCrc;
+            pcInfo->u32Stamp = u32StampEnd;
+            pcInfo->eState = eNVM_SCRUB_AREA_VALID;
+        }
+        else if (pcInfo->u32Crc != u32NVM_ScrubCrc)
+        {
+            // Content changed without a write of NVM
+            if (u16ErrCode <= NVM_SCRUB_MAX_ERR_CODE)
+            {
+                (void) s16FIM_DedupSetFault((U8) u16ErrCode, NVM_ID);
+            }
+            pcInfo->u32Crc = u32NVM_ScrubCrc;
+            pcInfo->eState = eNVM_SCRUB_AREA_CORRUPT;
+        }
+        else
+        {
+            // Content unchanged
+        }
+    }
+
+    vNVM_ScrubNextArea();
+}
+//** EndOfFunction vNVM_ScrubAreaDone **********************************************************************************
+
+// Function vNVM_ScrubNextArea
+//**********************************************************************************************************************
+//! @brief          Continues with the first chunk of the next area.
+//!
+//! @return         -
+//!
+//! @remarks        -
+//**********************************************************************************************************************
+static void vNVM_ScrubNextArea (void)
+{
+//************************************************ Function scope data *************************************************
+
+//*************************************************** Function code ****************************************************
+    u32NVM_ScrubPos = 0U;
+    u8NVM_ScrubArea++;
+    if (u8NVM_ScrubArea >= u8NVM_USR_ScrubAreaCnt)
+    {
+        u8NVM_ScrubArea = 0U;
+    }
+}
+//** EndOfFunction vNVM_ScrubNextArea **********************************************************************************
+
+//** EndOfFile nvm_scrub.c *********************************************************************************************
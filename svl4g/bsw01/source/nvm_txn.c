@@ -0,0 +1,512 @@
+//**********************************************************************************************************************
+//
+//                                                    nvm_txn.c
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date 2026-10-19
+//! @author agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file nvm_txn.c
+//! @brief NVM - Atomic transactions over several NVM writes (redo journal).
+//!
+//!        The staged writes are collected in RAM as journal body: per write an entry header followed by the data,
+//!        padded to U32. The commit
+//!        1. writes the body to the journal area,
+//!        2. writes the journal header with the CRC of the body (commit point),
+//!        3. applies the writes to their areas,
+//!        4. clears the magic of the journal header.
+//!        A reset before 2. leaves all areas unchanged, a reset after 2. is completed by s16NVM_TxnInit().
+//!        A torn header fails the header CRC and counts as not committed.
+//!
+//!        s16NVM_TxnBegin() takes the transaction under the scheduler lock, so two processes can not open it at the
+//!        same time. The lock is not held until the commit: the commit waits for NVM, which needs the scheduler.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+// 2026-10-19   agent          Transaction taken under the scheduler lock, replay errors reported to FIM
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include <string.h>                                             // memcpy, memset
+#include "kb_types.h"                                           // Standard definitions
+#include "kb_ret.h"                                             // Global Knorr-Bremse return value definitions
+#include "nvm_common.h"                                         // NVM Common definitions
+#include "nvm.h"                                                // NVM interfaces
+#include "sse_crc.h"                                            // CRC calculation
+#include "sciopta_sc.h"                                         // Scheduler lock
+#include "fim_dedup.h"                                          // Fault reporting, deduplicated
+#include "nvm_txn.h"                                            // Own interface
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Magic of a committed journal
+#define NVM_TXN_MAGIC_COMMITTED          ((U32) 0x4E54584EUL)   // "NTXN"
+
+//! Magic of an empty journal
+#define NVM_TXN_MAGIC_EMPTY              ((U32) 0x00000000UL)
+
+//! Start value of the CRCs
+#define NVM_TXN_CRC_START                ((U32) 0)
+
+//! Size of the journal header in bytes, the body follows the header
+#define NVM_TXN_HDR_SIZE                 ((U32) sizeof(C_NVM_TXN_HDR))
+
+//! Maximum size of the journal body in bytes
+#define NVM_TXN_BODY_SIZE                (NVM_TXN_JRNL_SIZE - NVM_TXN_HDR_SIZE)
+
+//! Size of an entry header in bytes
+#define NVM_TXN_ENTRY_SIZE               ((U32) sizeof(C_NVM_TXN_ENTRY))
+
+//! Length rounded up to U32
+#define NVM_TXN_ALIGN4(Len)              (((Len) + 3U) & ~((U32) 3U))
+
+//**************************************** Type definitions ( typedef ) ************************************************
+//! Journal header, stored at offset 0 of the journal area
+typedef struct
+{
+    U32 u32Magic;                                               //!< NVM_TXN_MAGIC_COMMITTED or NVM_TXN_MAGIC_EMPTY
+    U32 u32Seq;                                                 //!< Sequence number of the transaction
+    U16 u16EntryCnt;                                            //!< Number of writes
+    U16 u16Reserved;                                            //!< Reserved, 0
+    U32 u32BodyLen;                                             //!< Length of the body in bytes
+    U32 u32BodyCrc;                                             //!< CRC of the body
+    U32 u32HdrCrc;                                              //!< CRC of the header up to this member
+} C_NVM_TXN_HDR;
+
+//! Entry header of a write in the journal body, followed by the data
+typedef struct
+{
+    U8  u8NvmID;                                                //!< Device identifier
+    U8  u8AreaID;                                               //!< Area identifier
+    U16 u16Length;                                              //!< Number of data bytes
+    U32 u32Offset;                                              //!< Offset in the area
+} C_NVM_TXN_ENTRY;
+
+//! State of the transaction
+typedef enum
+{
+    eNVM_TXN_CLOSED = 0,                                        //!< No transaction open
+    eNVM_TXN_OPEN,                                              //!< Transaction open, writes can be staged
+    eNVM_TXN_FAILED                                             //!< Staging failed, the commit writes nothing
+} E_NVM_TXN_STATE;
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+//! Journal header of the open transaction or of the replayed journal
+static C_NVM_TXN_HDR cNVM_TxnHdr;
+
+//! Journal body of the open transaction or of the replayed journal
+static U32 au32NVM_TxnBody[NVM_TXN_BODY_SIZE / 4U];
+
+//! State of the transaction
+static E_NVM_TXN_STATE eNVM_TxnState = eNVM_TXN_CLOSED;
+
+//! Sequence number of the last journal
+static U32 u32NVM_TxnSeq = 0U;
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+static S16 s16NVM_TxnApply (void);
+
+static S16 s16NVM_TxnClear (void);
+
+static U32 u32NVM_TxnHdrCrc (void);
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_TxnInit
+//**********************************************************************************************************************
+S16 s16NVM_TxnInit (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return;                                              // Function return value
+    E_NVM_OPERATION_STATUS eStatus = eNVM_STATUS_OPERATION_INIT; // Operation status of the blocking calls
+    BOOLEAN boCommitted = FALSE;                                // Journal holds a committed transaction
+
+//*************************************************** Function code ****************************************************
+    eNVM_TxnState = eNVM_TXN_CLOSED;
+
+    s16Return = s16NVM_ReadData(NVM_DEVICE_ID1,
+                                u8NVM_CFG_TxnJrnlAreaID,
+                                eNVM_BLOCKING_MODE,
+                                &eStatus,
+                                0U,
+                                (U8*)(void*)&cNVM_TxnHdr,
+                                NVM_TXN_HDR_SIZE);
+
+    if (s16Return != KB_RET_OK)
+    {
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+    else if ((cNVM_TxnHdr.u32Magic == NVM_TXN_MAGIC_COMMITTED) &&
+             (cNVM_TxnHdr.u32HdrCrc == u32NVM_TxnHdrCrc()) &&
+             (cNVM_TxnHdr.u32BodyLen <= NVM_TXN_BODY_SIZE))
+    {
+        u32NVM_TxnSeq = cNVM_TxnHdr.u32Seq;
+
+        s16Return = s16NVM_ReadData(NVM_DEVICE_ID1,
+                                    u8NVM_CFG_TxnJrnlAreaID,
+                                    eNVM_BLOCKING_MODE,
+                                    &eStatus,
+                                    NVM_TXN_HDR_SIZE,
+                                    (U8*)(void*)au32NVM_TxnBody,
+                                    cNVM_TxnHdr.u32BodyLen);
+
+        if (s16Return != KB_RET_OK)
+        {
+            s16Return = KB_RET_ERR_DRIVER;
+        }
+        else if (cNVM_TxnHdr.u32BodyCrc == u32SSE_Crc32Dir((U8*)(void*)au32NVM_TxnBody,
+                                                           cNVM_TxnHdr.u32BodyLen,
+                                                           NVM_TXN_CRC_START,
+                                                           SSE_CRC32_CCITT_POLY))
+        {
+            boCommitted = TRUE;
+        }
+        else
+        {
+            // Header committed but body damaged: can not happen by a reset (body written first), nothing to replay
+        }
+    }
+    else
+    {
+        // Empty journal or torn header, the transaction did not reach its commit point
+    }
+
+    if (boCommitted == TRUE)
+    {
+        // Reset during the commit, apply the writes again (idempotent)
+        s16Return = s16NVM_TxnApply();
+    }
+
+    // A replay is tried once, a journal that can not be applied must not block every startup
+    if ((s16Return != KB_RET_ERR_DRIVER) || (boCommitted == TRUE))
+    {
+        if ((s16NVM_TxnClear() != KB_RET_OK) && (s16Return == KB_RET_OK))
+        {
+            s16Return = KB_RET_ERR_DRIVER;
+        }
+    }
+
+    // The board starts anyway, the readers of the transactional data find a half applied transaction by their CRCs
+    if ((s16Return != KB_RET_OK) && (u16NVM_CFG_TxnErrCode <= NVM_TXN_MAX_ERR_CODE))
+    {
+        (void) s16FIM_DedupSetFault((U8) u16NVM_CFG_TxnErrCode, NVM_ID);
+    }
+
+    // Return result
+    return (KB_RET_OK);
+}
+//** EndOfFunction s16NVM_TxnInit **************************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_TxnBegin
+//**********************************************************************************************************************
+S16 s16NVM_TxnBegin (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                                  // Function return value
+
+//*************************************************** Function code ****************************************************
+    ( void )sc_lock();
+    if (eNVM_TxnState != eNVM_TXN_CLOSED)
+    {
+        // Only one transaction at a time
+        s16Return = KB_RET_ERR_INTERNAL;
+    }
+    else
+    {
+        eNVM_TxnState = eNVM_TXN_OPEN;
+    }
+    sc_unlock();
+
+    if (s16Return == KB_RET_OK)
+    {
+        cNVM_TxnHdr.u16EntryCnt = 0U;
+        cNVM_TxnHdr.u16Reserved = 0U;
+        cNVM_TxnHdr.u32BodyLen = 0U;
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_TxnBegin *************************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_TxnStage
+//**********************************************************************************************************************
+S16 s16NVM_TxnStage (U8 u8NvmID, U8 u8AreaID, U32 u32Offset, const U8* pu8Data, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                                  // Function return value
+    C_NVM_TXN_ENTRY cEntry;                                     // Entry header of the write
+    U8* pu8Body = (U8*)(void*)au32NVM_TxnBody;                  // Journal body as bytes
+    U32 u32Pos;                                                 // Position of the entry in the body
+
+//*************************************************** Function code ****************************************************
+    if (eNVM_TxnState == eNVM_TXN_CLOSED)
+    {
+        s16Return = KB_RET_ERR_INTERNAL;
+    }
+    else if (eNVM_TxnState == eNVM_TXN_FAILED)
+    {
+        // Transaction already failed, nothing more is staged
+        s16Return = KB_RET_ERR_INTERNAL;
+    }
+    else if ((pu8Data == KB_NULL_PTR) || (u32Length == 0U) || (u32Length > (U32)0xFFFFU))
+    {
+        s16Return = KB_RET_ERR_ARG;
+    }
+    else if ((cNVM_TxnHdr.u16EntryCnt >= NVM_TXN_MAX_ENTRIES) ||
+             ((NVM_TXN_BODY_SIZE - cNVM_TxnHdr.u32BodyLen) < (NVM_TXN_ENTRY_SIZE + NVM_TXN_ALIGN4(u32Length))))
+    {
+        s16Return = KB_RET_ERR_RESOURCE;
+    }
+    else
+    {
+        u32Pos = cNVM_TxnHdr.u32BodyLen;
+
+        cEntry.u8NvmID = u8NvmID;
+        cEntry.u8AreaID = u8AreaID;
+        cEntry.u16Length = (U16)u32Length;
+        cEntry.u32Offset = u32Offset;
+        (void) memcpy(&pu8Body[u32Pos], &cEntry, NVM_TXN_ENTRY_SIZE);
+        u32Pos += NVM_TXN_ENTRY_SIZE;
+
+        (void) memcpy(&pu8Body[u32Pos], pu8Data, u32Length);
+        (void) memset(&pu8Body[u32Pos + u32Length], 0, NVM_TXN_ALIGN4(u32Length) - u32Length);
+
+        cNVM_TxnHdr.u32BodyLen = u32Pos + NVM_TXN_ALIGN4(u32Length);
+        cNVM_TxnHdr.u16EntryCnt++;
+    }
+
+    // A write that is not staged would break the atomicity of the transaction
+    if ((s16Return != KB_RET_OK) && (eNVM_TxnState == eNVM_TXN_OPEN))
+    {
+        eNVM_TxnState = eNVM_TXN_FAILED;
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_TxnStage *************************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_TxnCommit
+//**********************************************************************************************************************
+S16 s16NVM_TxnCommit (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                                  // Function return value
+    E_NVM_OPERATION_STATUS eStatus = eNVM_STATUS_OPERATION_INIT; // Operation status of the blocking calls
+
+//*************************************************** Function code ****************************************************
+    if (eNVM_TxnState != eNVM_TXN_OPEN)
+    {
+        // No transaction or staging failed, nothing is written
+        s16Return = KB_RET_ERR_INTERNAL;
+    }
+    else if (cNVM_TxnHdr.u16EntryCnt == 0U)
+    {
+        // Empty transaction
+    }
+    else
+    {
+        // 1. Body
+        s16Return = s16NVM_WriteData(NVM_DEVICE_ID1,
+                                     u8NVM_CFG_TxnJrnlAreaID,
+                                     eNVM_BLOCKING_MODE,
+                                     &eStatus,
+                                     NVM_TXN_HDR_SIZE,
+                                     (U8*)(void*)au32NVM_TxnBody,
+                                     cNVM_TxnHdr.u32BodyLen);
+
+        // 2. Header, commit point
+        if (s16Return == KB_RET_OK)
+        {
+            u32NVM_TxnSeq++;
+            cNVM_TxnHdr.u32Magic = NVM_TXN_MAGIC_COMMITTED;
+            cNVM_TxnHdr.u32Seq = u32NVM_TxnSeq;
+            cNVM_TxnHdr.u32BodyCrc = u32SSE_Crc32Dir((U8*)(void*)au32NVM_TxnBody,
+                                                     cNVM_TxnHdr.u32BodyLen,
+                                                     NVM_TXN_CRC_START,
+                                                     SSE_CRC32_CCITT_POLY);
+            cNVM_TxnHdr.u32HdrCrc = u32NVM_TxnHdrCrc();
+
+            s16Return = s16NVM_WriteData(NVM_DEVICE_ID1,
+                                         u8NVM_CFG_TxnJrnlAreaID,
+                                         eNVM_BLOCKING_MODE,
+                                         &eStatus,
+                                         0U,
+                                         (U8*)(void*)&cNVM_TxnHdr,
+                                         NVM_TXN_HDR_SIZE);
+        }
+
+        // 3. Writes, 4. clear. On errors the journal stays committed and is replayed at the next startup.
+        if (s16Return == KB_RET_OK)
+        {
+            s16Return = s16NVM_TxnApply();
+        }
+        if (s16Return == KB_RET_OK)
+        {
+            s16Return = s16NVM_TxnClear();
+        }
+        if (s16Return != KB_RET_OK)
+        {
+            s16Return = KB_RET_ERR_DRIVER;
+        }
+    }
+
+    eNVM_TxnState = eNVM_TXN_CLOSED;
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_TxnCommit ************************************************************************************
+
+//**********************************************************************************************************************
+// Function s16NVM_TxnAbort
+//**********************************************************************************************************************
+S16 s16NVM_TxnAbort (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                                  // Function return value
+
+//*************************************************** Function code ****************************************************
+    if (eNVM_TxnState == eNVM_TXN_CLOSED)
+    {
+        s16Return = KB_RET_ERR_INTERNAL;
+    }
+    else
+    {
+        eNVM_TxnState = eNVM_TXN_CLOSED;
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_TxnAbort *************************************************************************************
+
+// Function s16NVM_TxnApply
+//**********************************************************************************************************************
+//! @brief          Applies the writes of the journal body in cNVM_TxnHdr / au32NVM_TxnBody in order.
+//!
+//! @return         KB_RET_OK on success, KB_RET_ERR_DRIVER on NVM errors or a malformed body.
+//!
+//! @remarks        Stops at the first error.
+//**********************************************************************************************************************
+static S16 s16NVM_TxnApply (void)
+{
+//************************************************ Function scope data *************************************************
+    S16 s16Return = KB_RET_OK;                                  // Function return value
+    E_NVM_OPERATION_STATUS eStatus = eNVM_STATUS_OPERATION_INIT; // Operation status of the blocking calls
+    C_NVM_TXN_ENTRY cEntry;                                     // Entry header of the current write
+    U8* pu8Body = (U8*)(void*)au32NVM_TxnBody;                  // Journal body as bytes
+    U32 u32Pos = 0U;                                            // Position of the current entry in the body
+    U16 u16Entry = 0U;                                          // Index of the current write
+
+//*************************************************** Function code ****************************************************
+    while ((s16Return == KB_RET_OK) && (u16Entry < cNVM_TxnHdr.u16EntryCnt))
+    {
+        if ((cNVM_TxnHdr.u32BodyLen - u32Pos) < NVM_TXN_ENTRY_SIZE)
+        {
+            s16Return = KB_RET_ERR_DRIVER;
+        }
+        else
+        {
+            (void) memcpy(&cEntry, &pu8Body[u32Pos], NVM_TXN_ENTRY_SIZE);
+            u32Pos += NVM_TXN_ENTRY_SIZE;
+
+            if ((cNVM_TxnHdr.u32BodyLen - u32Pos) < NVM_TXN_ALIGN4((U32)cEntry.u16Length))
+            {
+                s16Return = KB_RET_ERR_DRIVER;
+            }
+            else
+            {
+                s16Return = s16NVM_WriteData(cEntry.u8NvmID,
+                                             cEntry.u8AreaID,
+                                             eNVM_BLOCKING_MODE,
+                                             &eStatus,
+                                             cEntry.u32Offset,
+                                             &pu8Body[u32Pos],
+                                             (U32)cEntry.u16Length);
+                u32Pos += NVM_TXN_ALIGN4((U32)cEntry.u16Length);
+                u16Entry++;
+            }
+        }
+    }
+
+    if (s16Return != KB_RET_OK)
+    {
+        s16Return = KB_RET_ERR_DRIVER;
+    }
+
+    // Return result
+    return (s16Return);
+}
+//** EndOfFunction s16NVM_TxnApply *************************************************************************************
+
+// Function s16NVM_TxnClear
+//**********************************************************************************************************************
+//! @brief          Marks the journal as empty.
+//!
+//! @return         Return value of s16NVM_WriteData().
+//!
+//! @remarks        Only the magic is written.
+//**********************************************************************************************************************
+static S16 s16NVM_TxnClear (void)
+{
+//************************************************ Function scope data *************************************************
+    E_NVM_OPERATION_STATUS eStatus = eNVM_STATUS_OPERATION_INIT; // Operation status of the blocking call
+
+//*************************************************** Function code ****************************************************
+    cNVM_TxnHdr.u32Magic = NVM_TXN_MAGIC_EMPTY;
+
+    return (s16NVM_WriteData(NVM_DEVICE_ID1,
+                             u8NVM_CFG_TxnJrnlAreaID,
+                             eNVM_BLOCKING_MODE,
+                             &eStatus,
+                             0U,
+                             (U8*)(void*)&cNVM_TxnHdr.u32Magic,
+                             (U32)sizeof(cNVM_TxnHdr.u32Magic)));
+}
+//** EndOfFunction s16NVM_TxnClear *************************************************************************************
+
+// Function u32NVM_TxnHdrCrc
+//**********************************************************************************************************************
+//! @brief          Calculates the CRC of cNVM_TxnHdr up to u32HdrCrc.
+//!
+//! @return         CRC
+//!
+//! @remarks        -
+//**********************************************************************************************************************
+static U32 u32NVM_TxnHdrCrc (void)
+{
+//************************************************ Function scope data *************************************************
+
+//*************************************************** Function code ****************************************************
+    return (u32SSE_Crc32Dir((U8*)(void*)&cNVM_TxnHdr,
+                            NVM_TXN_HDR_SIZE - (U32)sizeof(cNVM_TxnHdr.u32HdrCrc),
+                            NVM_TXN_CRC_START,
+                            SSE_CRC32_CCITT_POLY));
+}
+//** EndOfFunction u32NVM_TxnHdrCrc ************************************************************************************
+
+//** EndOfFile nvm_txn.c ***********************************************************************************************
@@ -0,0 +1,310 @@
+//**********************************************************************************************************************
+//
+//                                                crc32_sl_test.c
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date 2026-10-19
+//! @author agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file crc32_sl_test.c
+//! @brief CRC32 - Host equivalence test and benchmark of the table driven CRC32 (crc32_sl.c).
+//!
+//!        Compares u32CRC32_Update with u32SSE_Crc32Dir (SSE_CRC32_CCITT_POLY) and with a bitwise reference:
+//!        - known answer of "123456789",
+//!        - random buffers, lengths, alignments and start values, in one piece and chained in two pieces,
+//!        - the DSM record sizes and a 64 kB ROM segment.
+//!        Then measures the throughput of all three over 64 kB buffers.
+//!        The test has to pass before u32SSE_Crc32Dir is replaced by u32CRC32_Update for CRCs that are stored or
+//!        compared with tool generated values (DSM, ROM segments).
+//!
+//!        Build on the host together with the SSE CRC source of the SSE library, for both slice widths:
+//!            gcc -O2 [-DCRC32_SLICE_BY=4U] -I<kb_types.h> -I<sse_crc.h> -I../../bsw01.int/include
+//!                crc32_sl_test.c ../source/crc32_sl.c <SSE library>/sse_crc.c
+//!        With CRC32_TEST_NO_SSE the SSE comparison is left out.
+//!        Exit code 0 if all checks passed.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "kb_types.h"                                           // Standard definitions
+#ifndef CRC32_TEST_NO_SSE
+#include "sse_crc.h"                                            // Current CRC calculation
+#endif
+#include "crc32_sl.h"                                           // Tested module
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Generator polynomial of the bitwise reference
+#define CRC32_TEST_POLY                  ((U32) 0x04C11DB7)
+
+//! CRC of "123456789": polynomial 0x04C11DB7, start value 0, no reflection, no final XOR
+#define CRC32_TEST_CHECK                 ((U32) 0x89A1897F)
+
+//! Size of the test buffer, one ROM segment
+#define CRC32_TEST_BUF_SIZE              0x10000U
+
+//! Number of random cases
+#define CRC32_TEST_RANDOM_CASES          20000U
+
+//! Maximum length of a random case
+#define CRC32_TEST_RANDOM_MAX_LEN        1100U
+
+//! Lengths in the range of the DSM records: Simple Root cause data with format version, Detail Root cause data
+#define CRC32_TEST_DSM_SIMPLE_LEN        ((U32) (4U + (256U * 4U)))
+#define CRC32_TEST_DSM_DETAIL_LEN        ((U32) 2048U)
+
+//! Passes over the test buffer per benchmark
+#define CRC32_TEST_BENCH_PASSES          64U
+
+//**************************************** Type definitions ( typedef ) ************************************************
+//! CRC function under test: start value, data, length
+typedef U32 (*T_CRC32_TEST_FCT) (U32 u32Crc, const U8* pu8Data, U32 u32Length);
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+static U8 au8CRC32_TestBuf[CRC32_TEST_BUF_SIZE + 8U];          // Test data, + 8 for the alignment offsets
+static U32 u32CRC32_TestErrors = 0U;                            // Number of failed checks
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+static U32 u32CRC32_TestBitwise (U32 u32Crc, const U8* pu8Data, U32 u32Length);
+#ifndef CRC32_TEST_NO_SSE
+static U32 u32CRC32_TestSse (U32 u32Crc, const U8* pu8Data, U32 u32Length);
+#endif
+static void vCRC32_TestCompare (const char* pcName, U32 u32Crc, const U8* pu8Data, U32 u32Length);
+static void vCRC32_TestBench (const char* pcName, T_CRC32_TEST_FCT pfCrc);
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+// Function main
+//**********************************************************************************************************************
+int main (void)
+{
+//************************************************ Function scope data *************************************************
+    static const U8 au8Check[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };   // Known answer data
+    U32 u32Case;                                                // Random case
+    U32 u32Off;                                                 // Alignment offset
+    U32 u32Len;                                                 // Length
+    U32 u32Split;                                               // Length of the first piece
+    U32 u32Start;                                               // Start value
+    U32 u32Crc;                                                 // CRC
+    U32 u32Idx;                                                 // Index
+
+//*************************************************** Function code ****************************************************
+    srand(1U);
+    for (u32Idx = 0U; u32Idx < (U32) sizeof(au8CRC32_TestBuf); u32Idx++)
+    {
+        au8CRC32_TestBuf[u32Idx] = (U8) rand();
+    }
+
+    // Known answer
+    u32Crc = u32CRC32_Update(CRC32_START, au8Check, (U32) sizeof(au8Check));
+    if (u32Crc != CRC32_TEST_CHECK)
+    {
+        (void) printf("FAIL known answer: 0x%08lX, expected 0x%08lX\n",
+                      (unsigned long) u32Crc, (unsigned long) CRC32_TEST_CHECK);
+        u32CRC32_TestErrors++;
+    }
+    vCRC32_TestCompare("known answer", CRC32_START, au8Check, (U32) sizeof(au8Check));
+
+    // Random buffers, alignments and start values, each also chained in two pieces
+    for (u32Case = 0U; u32Case < CRC32_TEST_RANDOM_CASES; u32Case++)
+    {
+        u32Off = (U32) rand() % 8U;
+        u32Len = (U32) rand() % (CRC32_TEST_RANDOM_MAX_LEN + 1U);
+        u32Start = ((u32Case % 4U) == 0U) ? CRC32_START : (((U32) rand() << 16) ^ (U32) rand());
+        vCRC32_TestCompare("random", u32Start, &au8CRC32_TestBuf[u32Off], u32Len);
+
+        u32Split = (u32Len == 0U) ? 0U : ((U32) rand() % u32Len);
+        u32Crc = u32CRC32_Update(u32Start, &au8CRC32_TestBuf[u32Off], u32Split);
+        u32Crc = u32CRC32_Update(u32Crc, &au8CRC32_TestBuf[u32Off + u32Split], u32Len - u32Split);
+        if (u32Crc != u32CRC32_TestBitwise(u32Start, &au8CRC32_TestBuf[u32Off], u32Len))
+        {
+            (void) printf("FAIL chained: offset %lu, length %lu, split %lu\n",
+                          (unsigned long) u32Off, (unsigned long) u32Len, (unsigned long) u32Split);
+            u32CRC32_TestErrors++;
+        }
+    }
+
+    // Sizes of the DSM records and of a ROM segment
+    vCRC32_TestCompare("DSM simple", CRC32_START, au8CRC32_TestBuf, CRC32_TEST_DSM_SIMPLE_LEN);
+    vCRC32_TestCompare("DSM detail", CRC32_START, au8CRC32_TestBuf, CRC32_TEST_DSM_DETAIL_LEN);
+    vCRC32_TestCompare("ROM segment", CRC32_START, au8CRC32_TestBuf, CRC32_TEST_BUF_SIZE);
+    (void) memset(au8CRC32_TestBuf, 0xFF, sizeof(au8CRC32_TestBuf));
+    vCRC32_TestCompare("erased ROM segment", CRC32_START, au8CRC32_TestBuf, CRC32_TEST_BUF_SIZE);
+
+    (void) printf("crc32_sl slice-by-%u: %lu check(s) failed\n",
+                  (unsigned int) CRC32_SLICE_BY, (unsigned long) u32CRC32_TestErrors);
+
+    // Throughput
+    vCRC32_TestBench("u32CRC32_Update", &u32CRC32_Update);
+#ifndef CRC32_TEST_NO_SSE
+    vCRC32_TestBench("u32SSE_Crc32Dir", &u32CRC32_TestSse);
+#endif
+    vCRC32_TestBench("bitwise", &u32CRC32_TestBitwise);
+
+    return ((u32CRC32_TestErrors == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+//** EndOfFunction main ************************************************************************************************
+
+// Function u32CRC32_TestBitwise
+//**********************************************************************************************************************
+//! @brief          Bitwise reference: polynomial 0x04C11DB7, most significant bit first, no final XOR.
+//!
+//! @param[in]      u32Crc    : Start value
+//! @param[in]      pu8Data   : Data
+//! @param[in]      u32Length : Number of bytes
+//!
+//! @return         CRC
+//!
+//! @remarks        -
+//**********************************************************************************************************************
+static U32 u32CRC32_TestBitwise (U32 u32Crc, const U8* pu8Data, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    U32 u32Reg = u32Crc;                                        // CRC register
+    U32 u32Pos;                                                 // Position in the data
+    U8  u8Bit;                                                  // Bit of the byte
+
+//*************************************************** Function code ****************************************************
+    for (u32Pos = 0U; u32Pos < u32Length; u32Pos++)
+    {
+        u32Reg ^= (U32) pu8Data[u32Pos] << 24;
+        for (u8Bit = 0U; u8Bit < 8U; u8Bit++)
+        {
+            u32Reg = ((u32Reg & 0x80000000U) != 0U) ? ((u32Reg << 1) ^ CRC32_TEST_POLY) : (u32Reg << 1);
+        }
+    }
+
+    return (u32Reg);
+}
+//** EndOfFunction u32CRC32_TestBitwise ********************************************************************************
+
+#ifndef CRC32_TEST_NO_SSE
+// Function u32CRC32_TestSse
+//**********************************************************************************************************************
+//! @brief          Current implementation, called like in DiagDsmNvMem.c.
+//!
+//! @param[in]      u32Crc    : Start value
+//! @param[in]      pu8Data   : Data
+//! @param[in]      u32Length : Number of bytes
+//!
+//! @return         CRC
+//!
+//! @remarks        -
+//**********************************************************************************************************************
+static U32 u32CRC32_TestSse (U32 u32Crc, const U8* pu8Data, U32 u32Length)
+{
+//*************************************************** Function code ****************************************************
+    return (u32SSE_Crc32Dir((U8 *) pu8Data, u32Length, u32Crc, SSE_CRC32_CCITT_POLY));
+}
+//** EndOfFunction u32CRC32_TestSse ************************************************************************************
+#endif
+
+// Function vCRC32_TestCompare
+//**********************************************************************************************************************
+//! @brief          Compares u32CRC32_Update with the bitwise reference and with u32SSE_Crc32Dir for one buffer.
+//!
+//! @param[in]      pcName    : Name of the check
+//! @param[in]      u32Crc    : Start value
+//! @param[in]      pu8Data   : Data
+//! @param[in]      u32Length : Number of bytes
+//!
+//! @return         -
+//!
+//! @remarks        Counts the failures in u32CRC32_TestErrors.
+//**********************************************************************************************************************
+static void vCRC32_TestCompare (const char* pcName, U32 u32Crc, const U8* pu8Data, U32 u32Length)
+{
+//************************************************ Function scope data *************************************************
+    U32 u32New;                                                 // CRC of the tested module
+    U32 u32Ref;                                                 // CRC of the bitwise reference
+
+//*************************************************** Function code ****************************************************
+    u32New = u32CRC32_Update(u32Crc, pu8Data, u32Length);
+    u32Ref = u32CRC32_TestBitwise(u32Crc, pu8Data, u32Length);
+    if (u32New != u32Ref)
+    {
+        (void) printf("FAIL %s reference: length %lu, start 0x%08lX: 0x%08lX, expected 0x%08lX\n", pcName,
+                      (unsigned long) u32Length, (unsigned long) u32Crc, (unsigned long) u32New,
+                      (unsigned long) u32Ref);
+        u32CRC32_TestErrors++;
+    }
+
+#ifndef CRC32_TEST_NO_SSE
+    u32Ref = u32CRC32_TestSse(u32Crc, pu8Data, u32Length);
+    if (u32New != u32Ref)
+    {
+        (void) printf("FAIL %s u32SSE_Crc32Dir: length %lu, start 0x%08lX: 0x%08lX, expected 0x%08lX\n", pcName,
+                      (unsigned long) u32Length, (unsigned long) u32Crc, (unsigned long) u32New,
+                      (unsigned long) u32Ref);
+        u32CRC32_TestErrors++;
+    }
+#endif
+}
+//** EndOfFunction vCRC32_TestCompare **********************************************************************************
+
+// Function vCRC32_TestBench
+//**********************************************************************************************************************
+//! @brief          Measures the throughput of a CRC function over the test buffer.
+//!
+//! @param[in]      pcName : Name of the function
+//! @param[in]      pfCrc  : CRC function
+//!
+//! @return         -
+//!
+//! @remarks        Prints MB/s and the time of one 64 kB ROM segment.
+//**********************************************************************************************************************
+static void vCRC32_TestBench (const char* pcName, T_CRC32_TEST_FCT pfCrc)
+{
+//************************************************ Function scope data *************************************************
+    volatile U32 u32Crc = CRC32_START;                          // Result, kept to avoid optimising the loop away
+    clock_t tStart;                                             // Start of the measurement
+    double dSec;                                                // Duration in seconds
+    U32 u32Pass;                                                // Pass over the buffer
+
+//*************************************************** Function code ****************************************************
+    tStart = clock();
+    for (u32Pass = 0U; u32Pass < CRC32_TEST_BENCH_PASSES; u32Pass++)
+    {
+        u32Crc = pfCrc(u32Crc, au8CRC32_TestBuf, CRC32_TEST_BUF_SIZE);
+    }
+    dSec = (double) (clock() - tStart) / (double) CLOCKS_PER_SEC;
+
+    if (dSec > 0.0)
+    {
+        (void) printf("%-16s %8.1f MB/s, %8.1f us per 64 kB segment\n", pcName,
+                      ((double) CRC32_TEST_BUF_SIZE * (double) CRC32_TEST_BENCH_PASSES) / (dSec * 1.0e6),
+                      (dSec * 1.0e6) / (double) CRC32_TEST_BENCH_PASSES);
+    }
+    else
+    {
+        (void) printf("%-16s below the clock resolution\n", pcName);
+    }
+}
+//** EndOfFunction vCRC32_TestBench ************************************************************************************
+
+// EndOfFile crc32_sl_test.c *******************************************************************************************
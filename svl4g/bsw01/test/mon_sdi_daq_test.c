@@ -0,0 +1,537 @@
+//**********************************************************************************************************************
+//
+//                                              mon_sdi_daq_test.c
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date 2026-10-19
+//! @author agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file mon_sdi_daq_test.c
+//! @brief MON - Host test of the data acquisition (mon_sdi_daq.c).
+//!
+//!        Records variables of a RAM window with stubbed time slices and time, and checks with MON_SDI_DAQ_STATE and
+//!        MON_SDI_DAQ_READ:
+//!        - validation of MON_SDI_DAQ_ARM (board state, length, sizes, alignment, ranges, period, trigger, post
+//!          trigger samples),
+//!        - no trigger, trigger above, below, equal and on change, the trigger position and the pre trigger
+//!          history after the ring buffer wrapped around,
+//!        - the end of a running recording by N = 0 and a rejected time slice.
+//!        mon_sdi_daq.c converts addresses with U32, so the window is mapped below 4 GB at MON_DAQ_TEST_ADDR.
+//!
+//!        Build on the host with the headers of the MON, BCL and OS libraries:
+//!            gcc -O2 -I<kb_types.h> -I<mon.h, sdi.h, os.h, bcm_strt.h> -I../../bsw01.int/include
+//!                mon_sdi_daq_test.c ../source/mon_sdi_daq.c ../source/mon_sdi_resp.c
+//!        Exit code 0 if all checks passed.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "kb_types.h"                                           // Standard definitions
+#include "mon_cpu04_genrl_sdi_i.h"                              // Tested commands
+#include "mon_cpu04.h"                                          // Readable address ranges
+#include "mon.h"                                                // MON SDI definitions
+#include "sdi.h"                                                // Error Codes
+#include "os.h"                                                 // Time slices, time
+#include "bcm_strt.h"                                           // Board state
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Address and size of the RAM window, below 4 GB
+#define MON_DAQ_TEST_ADDR                0x20000000UL
+#define MON_DAQ_TEST_SIZE                0x1000U
+
+//! Recorded variables in the window
+#define MON_DAQ_TEST_U32                 (MON_DAQ_TEST_ADDR + 0U)
+#define MON_DAQ_TEST_U16                 (MON_DAQ_TEST_ADDR + 4U)
+#define MON_DAQ_TEST_U8                  (MON_DAQ_TEST_ADDR + 6U)
+
+//! Trigger conditions and states of mon_sdi_daq.c
+#define MON_DAQ_TEST_NONE                ((U8) 0)
+#define MON_DAQ_TEST_ABOVE               ((U8) 1)
+#define MON_DAQ_TEST_BELOW               ((U8) 2)
+#define MON_DAQ_TEST_EQUAL               ((U8) 3)
+#define MON_DAQ_TEST_CHANGE              ((U8) 4)
+#define MON_DAQ_TEST_IDLE                ((U8) 0)
+#define MON_DAQ_TEST_ARMED               ((U8) 1)
+#define MON_DAQ_TEST_DONE                ((U8) 3)
+#define MON_DAQ_TEST_NO_TRIGGER          ((U16) 0xFFFF)
+
+//! Size of the sample buffer of mon_sdi_daq.c
+#define MON_DAQ_TEST_BUFF_SIZE           4096U
+
+//! Maximum number of samples read back
+#define MON_DAQ_TEST_MAX_SAMPLES         4096U
+
+//**************************************** Type definitions ( typedef ) ************************************************
+//! Recording state read by MON_SDI_DAQ_STATE
+typedef struct
+{
+    U8  u8State;                                                //!< State
+    U16 u16Count;                                               //!< Number of samples
+    U16 u16Trig;                                                //!< Index of the trigger sample
+    U8  u8SampleLen;                                            //!< Length of a sample
+} C_MON_DAQ_TEST_STATE;
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+//! RAM window, replaces cfg_mon.c
+const C_MON_RAM_AREA acMON_RamArea[1] =
+{
+    { (const U8*) MON_DAQ_TEST_ADDR, MON_DAQ_TEST_SIZE }
+};
+const U8 u8MON_RamAreas = 1U;
+
+//**************************************** Module global data segment ( static ) ***************************************
+static U32 u32MON_DaqTestNow = 100000U;                         // Time of the stub in ms
+static void (*pvMON_DaqTestSlice)(void) = KB_NULL_PTR;          // Activated 1 ms time slice
+static BOOLEAN boMON_DaqTestActivate = TRUE;                    // Result of boOS_ActivateFct
+static E_BCM_BOARD_STATE eMON_DaqTestState = eBCM_BS_TEST;      // Board state of the stub
+static U8 au8MON_DaqTestSamples[MON_DAQ_TEST_MAX_SAMPLES * 8U]; // Samples read back
+static U32 u32MON_DaqTestErrors = 0U;                           // Number of failed checks
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+static S16 s16MON_DaqTestArm (U16 u16Period, U16 u16Post, U8 u8TrigItem, U8 u8TrigCond, U32 u32Threshold,
+                              U8 u8Items, const U32* pu32Addr, const U8* pu8Size);
+static C_MON_DAQ_TEST_STATE cMON_DaqTestState (void);
+static U16 u16MON_DaqTestReadAll (U8 u8SampleLen);
+static U32 u32MON_DaqTestGet (U16 u16Sample, U8 u8SampleLen, U8 u8Pos, U8 u8Size);
+static void vMON_DaqTestTick (U32 u32Ms);
+static void vMON_DaqTestCheck (const char* pcName, BOOLEAN boOk);
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+// Stubs of the OS and BCL functions
+//**********************************************************************************************************************
+S16 s16OS_GetTimeMS (U32* pu32Time)
+{
+    *pu32Time = u32MON_DaqTestNow;
+    return (0);
+}
+
+BOOLEAN boOS_ActivateFct (void (*pvFct)(void), U8 u8Slice)
+{
+    if ((boMON_DaqTestActivate == TRUE) && (u8Slice == (U8) eOS_SLICE_1MS))
+    {
+        pvMON_DaqTestSlice = pvFct;
+    }
+    return (boMON_DaqTestActivate);
+}
+
+BOOLEAN boOS_DeActivateFct (void (*pvFct)(void), U8 u8Slice)
+{
+    if ((pvFct == pvMON_DaqTestSlice) && (u8Slice == (U8) eOS_SLICE_1MS))
+    {
+        pvMON_DaqTestSlice = KB_NULL_PTR;
+    }
+    return (TRUE);
+}
+
+E_BCM_BOARD_STATE eBCM_StrtGetBoardState (void)
+{
+    return (eMON_DaqTestState);
+}
+//** EndOfFunction stubs ***********************************************************************************************
+
+//**********************************************************************************************************************
+// Function main
+//**********************************************************************************************************************
+int main (void)
+{
+//************************************************ Function scope data *************************************************
+    static const U32 au32Addr[3] = { MON_DAQ_TEST_U32, MON_DAQ_TEST_U16, MON_DAQ_TEST_U8 };   // Variables
+    static const U8 au8Size[3] = { 4U, 2U, 1U };               // Sizes of the variables
+    U32 au32Many[17];                                           // Too many variables
+    U8 au8Many[17];                                             // Sizes of too many variables
+    U8 au8Cmd[MON_SDI_DAQ_ARM_LEN];                             // Command
+    U8 au8Resp[MON_MSGMAXLEN];                                  // Response
+    volatile U32* pu32Var;                                      // U32 variable
+    volatile U16* pu16Var;                                      // U16 variable
+    volatile U8* pu8Var;                                        // U8 variable
+    C_MON_DAQ_TEST_STATE cState;                                // Recording state
+    U16 u16Count;                                               // Samples read back
+    U16 u16Idx;                                                 // Index
+    BOOLEAN boOk;                                               // Result of a check
+
+//*************************************************** Function code ****************************************************
+    if (mmap((void*) MON_DAQ_TEST_ADDR, MON_DAQ_TEST_SIZE, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) != (void*) MON_DAQ_TEST_ADDR)
+    {
+        (void) printf("FAIL RAM window not mapped at 0x%08lX\n", (unsigned long) MON_DAQ_TEST_ADDR);
+        return (EXIT_FAILURE);
+    }
+    pu32Var = (volatile U32*) MON_DAQ_TEST_U32;
+    pu16Var = (volatile U16*) MON_DAQ_TEST_U16;
+    pu8Var = (volatile U8*) MON_DAQ_TEST_U8;
+
+    // Validation of MON_SDI_DAQ_ARM
+    eMON_DaqTestState = eBCM_BS_NORMAL;
+    vMON_DaqTestCheck("not in test mode", s16MON_DaqTestArm(1U, 1U, 0U, MON_DAQ_TEST_NONE, 0U, 1U, au32Addr, au8Size)
+                                          == MON_SDI_INVALID_COMMAND);
+    eMON_DaqTestState = eBCM_BS_TEST;
+    (void) memset(au8Cmd, 0, sizeof(au8Cmd));
+    au8Cmd[0] = (U8) MON_SDI_DAQ_ARM;
+    vMON_DaqTestCheck("short command", (s16MON_DaqArm(au8Cmd, (U16) (MON_SDI_DAQ_ARM_LEN - 1U), au8Resp,
+                                                      MON_MSGMAXLEN) == 2) &&
+                                       (au8Resp[1] == MON_SDI_INVALID_COMMAND));
+    au8Cmd[11] = 1U;
+    vMON_DaqTestCheck("variable missing", (s16MON_DaqArm(au8Cmd, (U16) MON_SDI_DAQ_ARM_LEN, au8Resp,
+                                                         MON_MSGMAXLEN) == 2) &&
+                                          (au8Resp[1] == MON_SDI_INVALID_COMMAND));
+    vMON_DaqTestCheck("size 3", s16MON_DaqTestArm(1U, 1U, 0U, MON_DAQ_TEST_NONE, 0U, 1U, au32Addr,
+                                                  (const U8*) "\x03") == MON_SDI_RANGE_ERROR);
+    au32Many[0] = MON_DAQ_TEST_ADDR + 2U;
+    vMON_DaqTestCheck("not aligned", s16MON_DaqTestArm(1U, 1U, 0U, MON_DAQ_TEST_NONE, 0U, 1U, au32Many, au8Size) ==
+                                     MON_SDI_RANGE_ERROR);
+    au32Many[0] = MON_DAQ_TEST_ADDR + MON_DAQ_TEST_SIZE - 2U;
+    vMON_DaqTestCheck("behind the window", s16MON_DaqTestArm(1U, 1U, 0U, MON_DAQ_TEST_NONE, 0U, 1U, au32Many,
+                                                             au8Size) == MON_SDI_RANGE_ERROR);
+    vMON_DaqTestCheck("period 0", s16MON_DaqTestArm(0U, 1U, 0U, MON_DAQ_TEST_NONE, 0U, 1U, au32Addr, au8Size) ==
+                                  MON_SDI_RANGE_ERROR);
+    vMON_DaqTestCheck("post 0", s16MON_DaqTestArm(1U, 0U, 0U, MON_DAQ_TEST_NONE, 0U, 1U, au32Addr, au8Size) ==
+                                MON_SDI_RANGE_ERROR);
+    vMON_DaqTestCheck("post too big", s16MON_DaqTestArm(1U, (U16) ((MON_DAQ_TEST_BUFF_SIZE / 8U) + 1U), 0U,
+                                                        MON_DAQ_TEST_NONE, 0U, 1U, au32Addr, au8Size) ==
+                                      MON_SDI_RANGE_ERROR);
+    vMON_DaqTestCheck("trigger variable", s16MON_DaqTestArm(1U, 1U, 1U, MON_DAQ_TEST_ABOVE, 0U, 1U, au32Addr,
+                                                            au8Size) == MON_SDI_RANGE_ERROR);
+    vMON_DaqTestCheck("trigger condition", s16MON_DaqTestArm(1U, 1U, 0U, 5U, 0U, 1U, au32Addr, au8Size) ==
+                                           MON_SDI_RANGE_ERROR);
+    for (u16Idx = 0U; u16Idx < 17U; u16Idx++)
+    {
+        au32Many[u16Idx] = MON_DAQ_TEST_U8;
+        au8Many[u16Idx] = 1U;
+    }
+    vMON_DaqTestCheck("9 variables", s16MON_DaqTestArm(1U, 1U, 0U, MON_DAQ_TEST_NONE, 0U, 9U, au32Many, au8Many) ==
+                                      MON_SDI_NO_ERROR);
+    vMON_DaqTestCheck("17 variables", s16MON_DaqTestArm(1U, 1U, 0U, MON_DAQ_TEST_NONE, 0U, 17U, au32Many, au8Many) ==
+                                      MON_SDI_RANGE_ERROR);
+    (void) s16MON_DaqTestArm(1U, 1U, 0U, MON_DAQ_TEST_NONE, 0U, 0U, au32Addr, au8Size);
+
+    // No trigger: the recording ends after the post trigger samples, period 2 ms
+    *pu32Var = 0U;
+    vMON_DaqTestCheck("arm none", s16MON_DaqTestArm(2U, 10U, 0U, MON_DAQ_TEST_NONE, 0U, 3U, au32Addr, au8Size) ==
+                                  MON_SDI_NO_ERROR);
+    cState = cMON_DaqTestState();
+    vMON_DaqTestCheck("armed", (cState.u8State == MON_DAQ_TEST_ARMED) && (cState.u8SampleLen == 11U));
+    au8Cmd[0] = (U8) MON_SDI_DAQ_READ;
+    au8Cmd[1] = 0U;
+    au8Cmd[2] = 0U;
+    vMON_DaqTestCheck("read while armed", (s16MON_DaqRead(au8Cmd, (U16) MON_SDI_DAQ_READ_LEN, au8Resp,
+                                                          MON_MSGMAXLEN) == 2) &&
+                                          (au8Resp[1] == MON_SDI_INVALID_COMMAND));
+    for (u16Idx = 0U; u16Idx < 40U; u16Idx++)
+    {
+        *pu32Var = u16Idx;
+        vMON_DaqTestTick(1U);
+    }
+    cState = cMON_DaqTestState();
+    u16Count = u16MON_DaqTestReadAll(11U);
+    boOk = ((cState.u8State == MON_DAQ_TEST_DONE) && (cState.u16Count == 10U) && (cState.u16Trig == 0U) &&
+            (u16Count == 10U) && (pvMON_DaqTestSlice == KB_NULL_PTR)) ? TRUE : FALSE;
+    for (u16Idx = 1U; (u16Idx < u16Count) && (boOk == TRUE); u16Idx++)
+    {
+        boOk = ((u32MON_DaqTestGet(u16Idx, 11U, 0U, 4U) == (u32MON_DaqTestGet(0U, 11U, 0U, 4U) + (2U * u16Idx))) &&
+                (u32MON_DaqTestGet(u16Idx, 11U, 4U, 4U) == (u32MON_DaqTestGet(0U, 11U, 4U, 4U) + (2U * u16Idx))))
+               ? TRUE : FALSE;
+    }
+    vMON_DaqTestCheck("none: period and values", boOk);
+
+    // Trigger above after the ring buffer wrapped: 512 samples, trigger sample at 512 - 100
+    vMON_DaqTestCheck("arm above", s16MON_DaqTestArm(1U, 100U, 0U, MON_DAQ_TEST_ABOVE, 1200U, 1U, au32Addr, au8Size)
+                                   == MON_SDI_NO_ERROR);
+    for (u16Idx = 0U; u16Idx < 2000U; u16Idx++)
+    {
+        *pu32Var = u16Idx;
+        vMON_DaqTestTick(1U);
+    }
+    cState = cMON_DaqTestState();
+    u16Count = u16MON_DaqTestReadAll(8U);
+    boOk = ((cState.u8State == MON_DAQ_TEST_DONE) && (cState.u16Count == 512U) && (cState.u16Trig == 412U) &&
+            (u16Count == 512U)) ? TRUE : FALSE;
+    for (u16Idx = 0U; (u16Idx < u16Count) && (boOk == TRUE); u16Idx++)
+    {
+        boOk = (u32MON_DaqTestGet(u16Idx, 8U, 4U, 4U) == (U32) (1201U - 412U + u16Idx)) ? TRUE : FALSE;
+    }
+    vMON_DaqTestCheck("above: trigger and history", boOk);
+
+    // Trigger below and equal on the U16 variable
+    *pu16Var = 500U;
+    (void) s16MON_DaqTestArm(1U, 5U, 0U, MON_DAQ_TEST_BELOW, 300U, 1U, &au32Addr[1], &au8Size[1]);
+    for (u16Idx = 0U; u16Idx < 50U; u16Idx++)
+    {
+        *pu16Var = (U16) (500U - (10U * u16Idx));
+        vMON_DaqTestTick(1U);
+    }
+    cState = cMON_DaqTestState();
+    (void) u16MON_DaqTestReadAll(6U);
+    vMON_DaqTestCheck("below", (cState.u16Trig < cState.u16Count) &&
+                               (u32MON_DaqTestGet(cState.u16Trig, 6U, 4U, 2U) == 290U) &&
+                               (u32MON_DaqTestGet((U16) (cState.u16Trig - 1U), 6U, 4U, 2U) == 300U));
+    (void) s16MON_DaqTestArm(1U, 5U, 0U, MON_DAQ_TEST_EQUAL, 420U, 1U, &au32Addr[1], &au8Size[1]);
+    for (u16Idx = 0U; u16Idx < 50U; u16Idx++)
+    {
+        *pu16Var = (U16) (500U - (10U * u16Idx));
+        vMON_DaqTestTick(1U);
+    }
+    cState = cMON_DaqTestState();
+    (void) u16MON_DaqTestReadAll(6U);
+    vMON_DaqTestCheck("equal", (cState.u8State == MON_DAQ_TEST_DONE) &&
+                               (u32MON_DaqTestGet(cState.u16Trig, 6U, 4U, 2U) == 420U));
+
+    // Trigger on change of the U8 variable, not on the first sample
+    *pu8Var = 7U;
+    (void) s16MON_DaqTestArm(1U, 3U, 0U, MON_DAQ_TEST_CHANGE, 0U, 1U, &au32Addr[2], &au8Size[2]);
+    vMON_DaqTestTick(30U);
+    cState = cMON_DaqTestState();
+    vMON_DaqTestCheck("change: no trigger", (cState.u8State == MON_DAQ_TEST_ARMED) && (cState.u16Count == 30U) &&
+                                            (cState.u16Trig == MON_DAQ_TEST_NO_TRIGGER));
+    *pu8Var = 8U;
+    vMON_DaqTestTick(10U);
+    cState = cMON_DaqTestState();
+    (void) u16MON_DaqTestReadAll(5U);
+    vMON_DaqTestCheck("change", (cState.u8State == MON_DAQ_TEST_DONE) && (cState.u16Count == 33U) &&
+                                (cState.u16Trig == 30U) && (u32MON_DaqTestGet(30U, 5U, 4U, 1U) == 8U) &&
+                                (u32MON_DaqTestGet(29U, 5U, 4U, 1U) == 7U));
+
+    // End of a running recording, the samples stay readable
+    (void) s16MON_DaqTestArm(1U, 3U, 0U, MON_DAQ_TEST_EQUAL, 99U, 1U, &au32Addr[2], &au8Size[2]);
+    vMON_DaqTestTick(20U);
+    vMON_DaqTestCheck("end", s16MON_DaqTestArm(1U, 1U, 0U, MON_DAQ_TEST_NONE, 0U, 0U, au32Addr, au8Size) ==
+                             MON_SDI_NO_ERROR);
+    cState = cMON_DaqTestState();
+    vMON_DaqTestCheck("ended", (cState.u8State == MON_DAQ_TEST_DONE) && (cState.u16Count == 20U) &&
+                               (cState.u16Trig == MON_DAQ_TEST_NO_TRIGGER) && (u16MON_DaqTestReadAll(5U) == 20U) &&
+                               (pvMON_DaqTestSlice == KB_NULL_PTR));
+
+    // Time slice not activated
+    boMON_DaqTestActivate = FALSE;
+    vMON_DaqTestCheck("no time slice", s16MON_DaqTestArm(1U, 1U, 0U, MON_DAQ_TEST_NONE, 0U, 1U, au32Addr, au8Size) ==
+                                       MON_SDI_INVALID_COMMAND);
+    vMON_DaqTestCheck("idle", cMON_DaqTestState().u8State == MON_DAQ_TEST_IDLE);
+    boMON_DaqTestActivate = TRUE;
+
+    (void) printf("mon_sdi_daq: %lu check(s) failed\n", (unsigned long) u32MON_DaqTestErrors);
+
+    return ((u32MON_DaqTestErrors == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+//** EndOfFunction main ************************************************************************************************
+
+// Function s16MON_DaqTestArm
+//**********************************************************************************************************************
+//! @brief          Sends MON_SDI_DAQ_ARM.
+//!
+//! @param[in]      u16Period    : Period in ms
+//! @param[in]      u16Post      : Post trigger samples
+//! @param[in]      u8TrigItem   : Trigger variable
+//! @param[in]      u8TrigCond   : Trigger condition
+//! @param[in]      u32Threshold : Trigger threshold
+//! @param[in]      u8Items      : Number of variables
+//! @param[in]      pu32Addr     : Addresses of the variables
+//! @param[in]      pu8Size      : Sizes of the variables
+//!
+//! @return         Status of the response, -1 for a response of a wrong length
+//**********************************************************************************************************************
+static S16 s16MON_DaqTestArm (U16 u16Period, U16 u16Post, U8 u8TrigItem, U8 u8TrigCond, U32 u32Threshold,
+                              U8 u8Items, const U32* pu32Addr, const U8* pu8Size)
+{
+//************************************************ Function scope data *************************************************
+    U8 au8Cmd[MON_SDI_DAQ_ARM_LEN + (17U * 5U)];                // Command
+    U8 au8Resp[MON_MSGMAXLEN];                                  // Response
+    U16 u16Len = MON_SDI_DAQ_ARM_LEN;                           // Length of the command
+    S16 s16Len;                                                 // Length of the response
+    U8 u8Cnt;                                                   // Variable
+
+//*************************************************** Function code ****************************************************
+    au8Cmd[0] = (U8) MON_SDI_DAQ_ARM;
+    au8Cmd[1] = (U8) (u16Period >> 8);
+    au8Cmd[2] = (U8) u16Period;
+    au8Cmd[3] = (U8) (u16Post >> 8);
+    au8Cmd[4] = (U8) u16Post;
+    au8Cmd[5] = u8TrigItem;
+    au8Cmd[6] = u8TrigCond;
+    au8Cmd[7] = (U8) (u32Threshold >> 24);
+    au8Cmd[8] = (U8) (u32Threshold >> 16);
+    au8Cmd[9] = (U8) (u32Threshold >> 8);
+    au8Cmd[10] = (U8) u32Threshold;
+    au8Cmd[11] = u8Items;
+    for (u8Cnt = 0U; u8Cnt < u8Items; u8Cnt++)
+    {
+        au8Cmd[u16Len] = (U8) (pu32Addr[u8Cnt] >> 24);
+        au8Cmd[u16Len + 1U] = (U8) (pu32Addr[u8Cnt] >> 16);
+        au8Cmd[u16Len + 2U] = (U8) (pu32Addr[u8Cnt] >> 8);
+        au8Cmd[u16Len + 3U] = (U8) pu32Addr[u8Cnt];
+        au8Cmd[u16Len + 4U] = pu8Size[u8Cnt];
+        u16Len = (U16) (u16Len + 5U);
+    }
+
+    s16Len = s16MON_DaqArm(au8Cmd, u16Len, au8Resp, MON_MSGMAXLEN);
+
+    return (((s16Len == 2) || (s16Len == 3)) ? (S16) au8Resp[1] : -1);
+}
+//** EndOfFunction s16MON_DaqTestArm ***********************************************************************************
+
+// Function cMON_DaqTestState
+//**********************************************************************************************************************
+//! @brief          Sends MON_SDI_DAQ_STATE.
+//!
+//! @return         Recording state, state 0xFF for an invalid response
+//**********************************************************************************************************************
+static C_MON_DAQ_TEST_STATE cMON_DaqTestState (void)
+{
+//************************************************ Function scope data *************************************************
+    U8 au8Cmd[MON_SDI_DAQ_STATE_LEN];                           // Command
+    U8 au8Resp[MON_MSGMAXLEN];                                  // Response
+    C_MON_DAQ_TEST_STATE cState = { 0xFFU, 0U, 0U, 0U };        // Function return variable
+
+//*************************************************** Function code ****************************************************
+    au8Cmd[0] = (U8) MON_SDI_DAQ_STATE;
+    if ((s16MON_DaqState(au8Cmd, (U16) sizeof(au8Cmd), au8Resp, MON_MSGMAXLEN) == 8) &&
+        (au8Resp[1] == MON_SDI_NO_ERROR))
+    {
+        cState.u8State = au8Resp[2];
+        cState.u16Count = (U16) (((U16) au8Resp[3] << 8) | au8Resp[4]);
+        cState.u16Trig = (U16) (((U16) au8Resp[5] << 8) | au8Resp[6]);
+        cState.u8SampleLen = au8Resp[7];
+    }
+
+    return (cState);
+}
+//** EndOfFunction cMON_DaqTestState ***********************************************************************************
+
+// Function u16MON_DaqTestReadAll
+//**********************************************************************************************************************
+//! @brief          Reads all samples with MON_SDI_DAQ_READ into au8MON_DaqTestSamples.
+//!
+//! @param[in]      u8SampleLen : Expected length of a sample
+//!
+//! @return         Number of samples read
+//**********************************************************************************************************************
+static U16 u16MON_DaqTestReadAll (U8 u8SampleLen)
+{
+//************************************************ Function scope data *************************************************
+    U8 au8Cmd[MON_SDI_DAQ_READ_LEN];                            // Command
+    U8 au8Resp[MON_MSGMAXLEN];                                  // Response
+    S16 s16Len;                                                 // Length of the response
+    U16 u16First = 0U;                                          // Function return variable
+    BOOLEAN boMore = TRUE;                                      // More samples to read
+
+//*************************************************** Function code ****************************************************
+    while ((boMore == TRUE) && (u16First < MON_DAQ_TEST_MAX_SAMPLES))
+    {
+        au8Cmd[0] = (U8) MON_SDI_DAQ_READ;
+        au8Cmd[1] = (U8) (u16First >> 8);
+        au8Cmd[2] = (U8) u16First;
+        s16Len = s16MON_DaqRead(au8Cmd, (U16) sizeof(au8Cmd), au8Resp, MON_MSGMAXLEN);
+        if ((s16Len < 6) || (au8Resp[1] != MON_SDI_NO_ERROR) || (au8Resp[4] != u8SampleLen) || (au8Resp[5] == 0U) ||
+            (s16Len != (6 + ((S16) au8Resp[5] * (S16) u8SampleLen))))
+        {
+            boMore = FALSE;
+        }
+        else
+        {
+            (void) memcpy(&au8MON_DaqTestSamples[(U32) u16First * u8SampleLen], &au8Resp[6],
+                          (size_t) au8Resp[5] * u8SampleLen);
+            u16First = (U16) (u16First + au8Resp[5]);
+        }
+    }
+
+    return (u16First);
+}
+//** EndOfFunction u16MON_DaqTestReadAll *******************************************************************************
+
+// Function u32MON_DaqTestGet
+//**********************************************************************************************************************
+//! @brief          Returns a big endian value of a sample read back.
+//!
+//! @param[in]      u16Sample   : Index of the sample
+//! @param[in]      u8SampleLen : Length of a sample
+//! @param[in]      u8Pos       : Position in the sample, 0 for the time
+//! @param[in]      u8Size      : Size of the value
+//!
+//! @return         Value
+//**********************************************************************************************************************
+static U32 u32MON_DaqTestGet (U16 u16Sample, U8 u8SampleLen, U8 u8Pos, U8 u8Size)
+{
+//************************************************ Function scope data *************************************************
+    const U8* pu8Val = &au8MON_DaqTestSamples[((U32) u16Sample * u8SampleLen) + u8Pos];   // Value
+    U32 u32Val = 0U;                                            // Function return variable
+    U8 u8Byte;                                                  // Byte of the value
+
+//*************************************************** Function code ****************************************************
+    for (u8Byte = 0U; u8Byte < u8Size; u8Byte++)
+    {
+        u32Val = (u32Val << 8) | pu8Val[u8Byte];
+    }
+
+    return (u32Val);
+}
+//** EndOfFunction u32MON_DaqTestGet ***********************************************************************************
+
+// Function vMON_DaqTestTick
+//**********************************************************************************************************************
+//! @brief          Advances the time and calls the activated 1 ms time slice.
+//!
+//! @param[in]      u32Ms : Number of ms
+//!
+//! @return         -
+//**********************************************************************************************************************
+static void vMON_DaqTestTick (U32 u32Ms)
+{
+//************************************************ Function scope data *************************************************
+    U32 u32Cnt;                                                 // ms
+
+//*************************************************** Function code ****************************************************
+    for (u32Cnt = 0U; u32Cnt < u32Ms; u32Cnt++)
+    {
+        u32MON_DaqTestNow++;
+        if (pvMON_DaqTestSlice != KB_NULL_PTR)
+        {
+            pvMON_DaqTestSlice();
+        }
+    }
+}
+//** EndOfFunction vMON_DaqTestTick ************************************************************************************
+
+// Function vMON_DaqTestCheck
+//**********************************************************************************************************************
+//! @brief          Counts a failed check.
+//!
+//! @param[in]      pcName : Name of the check
+//! @param[in]      boOk   : Result of the check
+//!
+//! @return         -
+//**********************************************************************************************************************
+static void vMON_DaqTestCheck (const char* pcName, BOOLEAN boOk)
+{
+//*************************************************** Function code ****************************************************
+    if (boOk == FALSE)
+    {
+        (void) printf("FAIL %s\n", pcName);
+        u32MON_DaqTestErrors++;
+    }
+}
+//** EndOfFunction vMON_DaqTestCheck ***********************************************************************************
+
+// EndOfFile mon_sdi_daq_test.c ****************************************************************************************
@@ -0,0 +1,398 @@
+//**********************************************************************************************************************
+//
+//                                              mon_sdi_dump_test.c
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date 2026-10-19
+//! @author agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file mon_sdi_dump_test.c
+//! @brief MON - Host test of the memory dump (mon_sdi_dump.c).
+//!
+//!        Dumps a RAM window with MON_SDI_DUMP_START / MON_SDI_DUMP_READ and decodes the frames like the tester:
+//!        - zero, random and slowly changing data, MON_DUMP_RAW and MON_DUMP_RLE, response sizes of 10 to 64 bytes,
+//!        - every 5th response lost and its frame read again,
+//!        - the decoded data and the CRC of the last frame compared with the window and u32CRC32_Update,
+//!        - board not in test mode, invalid ranges, modes, lengths and sequence numbers.
+//!        mon_sdi_dump.c converts addresses with U32, so the window is mapped below 4 GB at MON_DUMP_TEST_ADDR.
+//!
+//!        Build on the host with the headers of the MON and BCL libraries:
+//!            gcc -O2 -I<kb_types.h> -I<mon.h, sdi.h, os.h, bcm_strt.h> -I../../bsw01.int/include
+//!                mon_sdi_dump_test.c ../source/mon_sdi_dump.c ../source/mon_sdi_resp.c ../source/crc32_sl.c
+//!        Exit code 0 if all checks passed.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "kb_types.h"                                           // Standard definitions
+#include "mon_cpu04_genrl_sdi_i.h"                              // Tested commands
+#include "mon_cpu04.h"                                          // Readable address ranges
+#include "mon.h"                                                // MON SDI definitions
+#include "sdi.h"                                                // Error Codes
+#include "bcm_strt.h"                                           // Board state
+#include "crc32_sl.h"                                           // CRC of the dump
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Address and size of the RAM window, below 4 GB
+#define MON_DUMP_TEST_ADDR               0x20000000UL
+#define MON_DUMP_TEST_SIZE               0x4000U
+
+//! Length of the dumps
+#define MON_DUMP_TEST_LEN                3000U
+
+//! Every n-th response is lost
+#define MON_DUMP_TEST_LOST               5U
+
+//! Maximum number of frames of a dump
+#define MON_DUMP_TEST_MAX_FRAMES         2000U
+
+//! Modes and flags of mon_sdi_dump.c
+#define MON_DUMP_TEST_RAW                ((U8) 0)
+#define MON_DUMP_TEST_RLE                ((U8) 1)
+#define MON_DUMP_TEST_LAST               ((U8) 0x01)
+
+//**************************************** Type definitions ( typedef ) ************************************************
+
+//**************************************** Global data definitions *****************************************************
+
+//**************************************** Global constant definitions ( const ) ***************************************
+//! RAM window, replaces cfg_mon.c
+const C_MON_RAM_AREA acMON_RamArea[1] =
+{
+    { (const U8*) MON_DUMP_TEST_ADDR, MON_DUMP_TEST_SIZE }
+};
+const U8 u8MON_RamAreas = 1U;
+
+//**************************************** Module global data segment ( static ) ***************************************
+static U8* pu8MON_DumpTestRam;                                  // RAM window
+static U8 au8MON_DumpTestOut[MON_DUMP_TEST_LEN];                // Decoded data
+static E_BCM_BOARD_STATE eMON_DumpTestState = eBCM_BS_TEST;     // Board state of the stub
+static U32 u32MON_DumpTestErrors = 0U;                          // Number of failed checks
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+static S16 s16MON_DumpTestStart (U32 u32Addr, U32 u32Len, U8 u8Mode);
+static S16 s16MON_DumpTestRead (U16 u16Seq, U8* pu8Resp, U16 u16MaxResp);
+static void vMON_DumpTestCheck (const char* pcName, BOOLEAN boOk);
+static void vMON_DumpTestRun (const char* pcName, U8 u8Mode, U16 u16MaxResp);
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+// Function eBCM_StrtGetBoardState
+//**********************************************************************************************************************
+E_BCM_BOARD_STATE eBCM_StrtGetBoardState (void)
+{
+    return (eMON_DumpTestState);
+}
+//** EndOfFunction eBCM_StrtGetBoardState ******************************************************************************
+
+//**********************************************************************************************************************
+// Function main
+//**********************************************************************************************************************
+int main (void)
+{
+//************************************************ Function scope data *************************************************
+    static const U16 au16MaxResp[] = { 10U, 16U, 33U, 63U, MON_MSGMAXLEN };   // Response sizes
+    U8  au8Resp[MON_MSGMAXLEN];                                 // Response
+    U32 u32Idx;                                                 // Index
+    U8  u8Size;                                                 // Response size
+
+//*************************************************** Function code ****************************************************
+    pu8MON_DumpTestRam = (U8*) mmap((void*) MON_DUMP_TEST_ADDR, MON_DUMP_TEST_SIZE, PROT_READ | PROT_WRITE,
+                                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+    if (pu8MON_DumpTestRam != (U8*) MON_DUMP_TEST_ADDR)
+    {
+        (void) printf("FAIL RAM window not mapped at 0x%08lX\n", (unsigned long) MON_DUMP_TEST_ADDR);
+        return (EXIT_FAILURE);
+    }
+
+    // Read without dump, commands outside of test mode
+    vMON_DumpTestCheck("read without dump",
+                       (s16MON_DumpTestRead(0U, au8Resp, MON_MSGMAXLEN) == 2) &&
+                       (au8Resp[MON_SDI_INDEX_1] == MON_SDI_INVALID_COMMAND));
+    eMON_DumpTestState = eBCM_BS_NORMAL;
+    vMON_DumpTestCheck("start not in test mode",
+                       s16MON_DumpTestStart(MON_DUMP_TEST_ADDR, 16U, MON_DUMP_TEST_RAW) == MON_SDI_INVALID_COMMAND);
+    eMON_DumpTestState = eBCM_BS_TEST;
+
+    // Invalid ranges and modes
+    vMON_DumpTestCheck("length 0", s16MON_DumpTestStart(MON_DUMP_TEST_ADDR, 0U, MON_DUMP_TEST_RAW) ==
+                                   MON_SDI_RANGE_ERROR);
+    vMON_DumpTestCheck("before the window", s16MON_DumpTestStart(MON_DUMP_TEST_ADDR - 1U, 16U, MON_DUMP_TEST_RAW) ==
+                                            MON_SDI_RANGE_ERROR);
+    vMON_DumpTestCheck("behind the window",
+                       s16MON_DumpTestStart(MON_DUMP_TEST_ADDR + MON_DUMP_TEST_SIZE - 15U, 16U, MON_DUMP_TEST_RAW) ==
+                       MON_SDI_RANGE_ERROR);
+    vMON_DumpTestCheck("invalid mode", s16MON_DumpTestStart(MON_DUMP_TEST_ADDR, 16U, 2U) == MON_SDI_RANGE_ERROR);
+
+    // Sequence numbers
+    vMON_DumpTestCheck("start", s16MON_DumpTestStart(MON_DUMP_TEST_ADDR, 16U, MON_DUMP_TEST_RAW) == MON_SDI_NO_ERROR);
+    (void) s16MON_DumpTestRead(1U, au8Resp, MON_MSGMAXLEN);
+    vMON_DumpTestCheck("sequence 1 first", au8Resp[MON_SDI_INDEX_1] == MON_SDI_RANGE_ERROR);
+    (void) s16MON_DumpTestRead(0U, au8Resp, MON_MSGMAXLEN);
+    vMON_DumpTestCheck("sequence 0", au8Resp[MON_SDI_INDEX_1] == MON_SDI_NO_ERROR);
+    (void) s16MON_DumpTestRead(2U, au8Resp, MON_MSGMAXLEN);
+    vMON_DumpTestCheck("sequence 2 after 0", au8Resp[MON_SDI_INDEX_1] == MON_SDI_RANGE_ERROR);
+    eMON_DumpTestState = eBCM_BS_NORMAL;
+    (void) s16MON_DumpTestRead(1U, au8Resp, MON_MSGMAXLEN);
+    vMON_DumpTestCheck("read not in test mode", au8Resp[MON_SDI_INDEX_1] == MON_SDI_INVALID_COMMAND);
+    eMON_DumpTestState = eBCM_BS_TEST;
+
+    // Zero, random and slowly changing data
+    for (u8Size = 0U; u8Size < (U8) (sizeof(au16MaxResp) / sizeof(au16MaxResp[0])); u8Size++)
+    {
+        (void) memset(pu8MON_DumpTestRam, 0, MON_DUMP_TEST_SIZE);
+        vMON_DumpTestRun("zero raw", MON_DUMP_TEST_RAW, au16MaxResp[u8Size]);
+        vMON_DumpTestRun("zero rle", MON_DUMP_TEST_RLE, au16MaxResp[u8Size]);
+
+        srand(u8Size + 1U);
+        for (u32Idx = 0U; u32Idx < MON_DUMP_TEST_SIZE; u32Idx++)
+        {
+            pu8MON_DumpTestRam[u32Idx] = (U8) rand();
+        }
+        vMON_DumpTestRun("random raw", MON_DUMP_TEST_RAW, au16MaxResp[u8Size]);
+        vMON_DumpTestRun("random rle", MON_DUMP_TEST_RLE, au16MaxResp[u8Size]);
+
+        for (u32Idx = 0U; u32Idx < MON_DUMP_TEST_SIZE; u32Idx++)
+        {
+            pu8MON_DumpTestRam[u32Idx] = (U8) ((u32Idx / 37U) + ((((U32) rand() % 11U) == 0U) ? 1U : 0U));
+        }
+        vMON_DumpTestRun("changing raw", MON_DUMP_TEST_RAW, au16MaxResp[u8Size]);
+        vMON_DumpTestRun("changing rle", MON_DUMP_TEST_RLE, au16MaxResp[u8Size]);
+    }
+
+    (void) printf("mon_sdi_dump: %lu check(s) failed\n", (unsigned long) u32MON_DumpTestErrors);
+
+    return ((u32MON_DumpTestErrors == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+//** EndOfFunction main ************************************************************************************************
+
+// Function s16MON_DumpTestStart
+//**********************************************************************************************************************
+//! @brief          Sends MON_SDI_DUMP_START.
+//!
+//! @param[in]      u32Addr : Start address
+//! @param[in]      u32Len  : Length
+//! @param[in]      u8Mode  : Mode
+//!
+//! @return         Status of the response, -1 for a response of a wrong length
+//**********************************************************************************************************************
+static S16 s16MON_DumpTestStart (U32 u32Addr, U32 u32Len, U8 u8Mode)
+{
+//************************************************ Function scope data *************************************************
+    U8 au8Cmd[MON_SDI_DUMP_START_LEN];                          // Command
+    U8 au8Resp[MON_MSGMAXLEN];                                  // Response
+    S16 s16Status = -1;                                         // Function return variable
+
+//*************************************************** Function code ****************************************************
+    au8Cmd[0] = (U8) MON_SDI_DUMP_START;
+    au8Cmd[1] = (U8) (u32Addr >> 24);
+    au8Cmd[2] = (U8) (u32Addr >> 16);
+    au8Cmd[3] = (U8) (u32Addr >> 8);
+    au8Cmd[4] = (U8) u32Addr;
+    au8Cmd[5] = (U8) (u32Len >> 24);
+    au8Cmd[6] = (U8) (u32Len >> 16);
+    au8Cmd[7] = (U8) (u32Len >> 8);
+    au8Cmd[8] = (U8) u32Len;
+    au8Cmd[9] = u8Mode;
+
+    if (s16MON_DumpStart(au8Cmd, (U16) sizeof(au8Cmd), au8Resp, MON_MSGMAXLEN) == 2)
+    {
+        s16Status = (S16) au8Resp[MON_SDI_INDEX_1];
+    }
+
+    return (s16Status);
+}
+//** EndOfFunction s16MON_DumpTestStart ********************************************************************************
+
+// Function s16MON_DumpTestRead
+//**********************************************************************************************************************
+//! @brief          Sends MON_SDI_DUMP_READ.
+//!
+//! @param[in]      u16Seq     : Sequence number
+//! @param[out]     pu8Resp    : Response
+//! @param[in]      u16MaxResp : Size of the response
+//!
+//! @return         Length of the response
+//**********************************************************************************************************************
+static S16 s16MON_DumpTestRead (U16 u16Seq, U8* pu8Resp, U16 u16MaxResp)
+{
+//************************************************ Function scope data *************************************************
+    U8 au8Cmd[MON_SDI_DUMP_READ_LEN];                           // Command
+
+//*************************************************** Function code ****************************************************
+    au8Cmd[0] = (U8) MON_SDI_DUMP_READ;
+    au8Cmd[1] = (U8) (u16Seq >> 8);
+    au8Cmd[2] = (U8) u16Seq;
+
+    return (s16MON_DumpRead(au8Cmd, (U16) sizeof(au8Cmd), pu8Resp, u16MaxResp));
+}
+//** EndOfFunction s16MON_DumpTestRead *********************************************************************************
+
+// Function vMON_DumpTestCheck
+//**********************************************************************************************************************
+//! @brief          Counts a failed check.
+//!
+//! @param[in]      pcName : Name of the check
+//! @param[in]      boOk   : Result of the check
+//!
+//! @return         -
+//**********************************************************************************************************************
+static void vMON_DumpTestCheck (const char* pcName, BOOLEAN boOk)
+{
+//*************************************************** Function code ****************************************************
+    if (boOk == FALSE)
+    {
+        (void) printf("FAIL %s\n", pcName);
+        u32MON_DumpTestErrors++;
+    }
+}
+//** EndOfFunction vMON_DumpTestCheck **********************************************************************************
+
+// Function vMON_DumpTestRun
+//**********************************************************************************************************************
+//! @brief          Dumps MON_DUMP_TEST_LEN bytes of the window, decodes the frames and checks data and CRC.
+//!
+//! @param[in]      pcName     : Name of the check
+//! @param[in]      u8Mode     : Mode
+//! @param[in]      u16MaxResp : Size of the responses
+//!
+//! @return         -
+//!
+//! @remarks        Every MON_DUMP_TEST_LOST-th response is dropped and the frame read again.
+//**********************************************************************************************************************
+static void vMON_DumpTestRun (const char* pcName, U8 u8Mode, U16 u16MaxResp)
+{
+//************************************************ Function scope data *************************************************
+    U8  au8Resp[MON_MSGMAXLEN];                                 // Response
+    const U8* pu8Src = &pu8MON_DumpTestRam[1];                  // Dumped data, not aligned
+    S16 s16Len;                                                 // Length of the response
+    U16 u16Seq = 0U;                                            // Sequence number
+    U16 u16Pos;                                                 // Position in the response
+    U16 u16End;                                                 // End of the data in the response
+    U16 u16Cnt;                                                 // Bytes of a token
+    U32 u32Out = 0U;                                            // Decoded bytes
+    U32 u32Crc = 0U;                                            // CRC of the last frame
+    U32 u32Reads = 0U;                                          // Number of reads
+    BOOLEAN boLast = FALSE;                                     // Last frame received
+    BOOLEAN boOk = TRUE;                                        // Frames valid
+
+//*************************************************** Function code ****************************************************
+    boOk = (s16MON_DumpTestStart((U32) MON_DUMP_TEST_ADDR + 1U, MON_DUMP_TEST_LEN, u8Mode) == MON_SDI_NO_ERROR) ?
+           TRUE : FALSE;
+
+    while ((boOk == TRUE) && (boLast == FALSE) && (u32Reads < MON_DUMP_TEST_MAX_FRAMES))
+    {
+        u32Reads++;
+        s16Len = s16MON_DumpTestRead(u16Seq, au8Resp, u16MaxResp);
+        if ((s16Len < 5) || (s16Len > (S16) u16MaxResp) || (au8Resp[1] != MON_SDI_NO_ERROR) ||
+            (au8Resp[2] != (U8) (u16Seq >> 8)) || (au8Resp[3] != (U8) u16Seq))
+        {
+            boOk = FALSE;
+        }
+        else if ((u32Reads % MON_DUMP_TEST_LOST) == 0U)
+        {
+            // Response lost, the frame is read again
+        }
+        else
+        {
+            u16End = (U16) s16Len;
+            if ((au8Resp[4] & MON_DUMP_TEST_LAST) != 0U)
+            {
+                boLast = TRUE;
+                u16End = (U16) (u16End - 4U);
+                u32Crc = ((U32) au8Resp[u16End] << 24) | ((U32) au8Resp[u16End + 1U] << 16) |
+                         ((U32) au8Resp[u16End + 2U] << 8) | (U32) au8Resp[u16End + 3U];
+            }
+
+            for (u16Pos = 5U; (u16Pos < u16End) && (boOk == TRUE); u16Pos = (U16) (u16Pos + u16Cnt))
+            {
+                if (u8Mode == MON_DUMP_TEST_RAW)
+                {
+                    u16Cnt = (U16) (u16End - u16Pos);
+                    if ((u32Out + u16Cnt) > MON_DUMP_TEST_LEN)
+                    {
+                        boOk = FALSE;
+                    }
+                    else
+                    {
+                        (void) memcpy(&au8MON_DumpTestOut[u32Out], &au8Resp[u16Pos], u16Cnt);
+                        u32Out += u16Cnt;
+                    }
+                }
+                else if (au8Resp[u16Pos] < 0x80U)
+                {
+                    // Literal
+                    u16Cnt = (U16) (au8Resp[u16Pos] + 1U);
+                    if (((u16Pos + 1U + u16Cnt) > u16End) || ((u32Out + u16Cnt) > MON_DUMP_TEST_LEN))
+                    {
+                        boOk = FALSE;
+                    }
+                    else
+                    {
+                        (void) memcpy(&au8MON_DumpTestOut[u32Out], &au8Resp[u16Pos + 1U], u16Cnt);
+                        u32Out += u16Cnt;
+                    }
+                    u16Cnt = (U16) (u16Cnt + 1U);
+                }
+                else
+                {
+                    // Run
+                    u16Cnt = (U16) ((au8Resp[u16Pos] - 0x80U) + 3U);
+                    if (((u16Pos + 2U) > u16End) || ((u32Out + u16Cnt) > MON_DUMP_TEST_LEN))
+                    {
+                        boOk = FALSE;
+                    }
+                    else
+                    {
+                        (void) memset(&au8MON_DumpTestOut[u32Out], au8Resp[u16Pos + 1U], u16Cnt);
+                        u32Out += u16Cnt;
+                    }
+                    u16Cnt = 2U;
+                }
+            }
+            u16Seq++;
+        }
+    }
+
+    if ((boOk == FALSE) || (boLast == FALSE) || (u32Out != MON_DUMP_TEST_LEN) ||
+        (memcmp(au8MON_DumpTestOut, pu8Src, MON_DUMP_TEST_LEN) != 0) ||
+        (u32Crc != u32CRC32_Update(CRC32_START, pu8Src, MON_DUMP_TEST_LEN)))
+    {
+        (void) printf("FAIL %s, response %u: %lu of %u bytes after %u frames\n", pcName, (unsigned int) u16MaxResp,
+                      (unsigned long) u32Out, (unsigned int) MON_DUMP_TEST_LEN, (unsigned int) u16Seq);
+        u32MON_DumpTestErrors++;
+    }
+    else
+    {
+        // The frame after the last one returns the CRC again
+        s16Len = s16MON_DumpTestRead(u16Seq, au8Resp, u16MaxResp);
+        vMON_DumpTestCheck("CRC again", (s16Len == 9) && ((au8Resp[4] & MON_DUMP_TEST_LAST) != 0U) &&
+                                        (au8Resp[5] == (U8) (u32Crc >> 24)) && (au8Resp[8] == (U8) u32Crc));
+        (void) printf("%-13s response %2u: %4u frames\n", pcName, (unsigned int) u16MaxResp, (unsigned int) u16Seq);
+    }
+}
+//** EndOfFunction vMON_DumpTestRun ************************************************************************************
+
+// EndOfFile mon_sdi_dump_test.c ***************************************************************************************
@@ -0,0 +1,472 @@
+//**********************************************************************************************************************
+//
+//                                              mon_sdi_sub_test.c
+//
+//**********************************************************************************************************************
+//
+//                                       Copyrights(c) by KNORR-BREMSE,
+//                                        Rail Vehicle Systems, Munich
+//
+//! @project IBC
+//! @date 2026-10-19
+//! @author agent
+//!
+//**********************************************************************************************************************
+//!
+//! @file mon_sdi_sub_test.c
+//! @brief MON - Host test of the subscription to IO values (mon_sdi_sub.c).
+//!
+//!        Subscribes with stubbed drivers, time slices and time, and checks with MON_SDI_SUB_READ:
+//!        - validation of MON_SDI_SUBSCRIBE (board state, commands shorter than the fixed part, length, period,
+//!          number of channels, types, channels, frequency and PWM together, failed channel initialisation),
+//!        - the frame content of all channel types and the period,
+//!        - the lost frames of a full buffer and the draining of the buffer,
+//!        - the stop and restart of the PWM acquisition, the end on a board state change and by N = 0.
+//!        Every command is passed in a buffer of its exact length, so a read behind the command is found by
+//!        -fsanitize=address.
+//!
+//!        Build on the host with the headers of the MON, BCL and OS libraries:
+//!            gcc -O2 [-fsanitize=address] -I<kb_types.h> -I<mon.h, sdi.h, os.h, bcm_strt.h>
+//!                -I../../bsw01.int/include mon_sdi_sub_test.c ../source/mon_sdi_sub.c ../source/mon_sdi_resp.c
+//!        Exit code 0 if all checks passed.
+//!
+//**********************************************************************************************************************
+//
+// History
+// Date         Author         Changes
+// 2026-10-19   agent          Start
+//
+//**********************************************************************************************************************
+
+//**************************************** Compiler options ( #pragma ) ************************************************
+
+//**************************************** Header / include files ( #include ) *****************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "kb_types.h"                                           // Standard definitions
+#include "mon_cpu04_genrl_sdi_i.h"                              // Tested commands
+#include "mon_binio.h"                                          // Stubbed binary IO
+#include "mon_fin.h"                                            // Stubbed frequency inputs
+#include "mon_psdio.h"                                          // Stubbed PSD IO
+#include "mon_cpu04.h"                                          // Stubbed PWM inputs
+#include "mon.h"                                                // MON SDI definitions
+#include "sdi.h"                                                // Error Codes
+#include "os.h"                                                 // Time slices, time
+#include "bcm_strt.h"                                           // Board state
+
+//**************************************** Constant / macro definitions ( #define ) ************************************
+//! Channel types of mon_sdi_sub.c
+#define MON_SUB_TEST_DIGIO               ((U8) 0)
+#define MON_SUB_TEST_FREQ                ((U8) 1)
+#define MON_SUB_TEST_PWM                 ((U8) 2)
+#define MON_SUB_TEST_PSDIO               ((U8) 3)
+
+//! Binary IO port the stub cannot initialise
+#define MON_SUB_TEST_BAD_PORT            ((U8) 9)
+
+//! Frames the buffer of mon_sdi_sub.c holds with a frame of 10 bytes
+#define MON_SUB_TEST_FRAMES              101U
+
+//! Time of the stub at the start in ms
+#define MON_SUB_TEST_START               100000U
+
+//! Maximum length of a command
+#define MON_SUB_TEST_CMD_MAX             64U
+
+//**************************************** Type definitions ( typedef ) ************************************************
+//! Result of MON_SDI_SUB_READ
+typedef struct
+{
+    S16 s16Len;                                                 //!< Length of the response
+    U8  u8Status;                                               //!< Status
+    U16 u16Lost;                                                //!< Lost frames
+    U8  u8FrameLen;                                             //!< Length of a frame
+    U8  u8Frames;                                               //!< Number of frames
+} C_MON_SUB_TEST_READ;
+
+//**************************************** Global data definitions *****************************************************
+U8 u8MON_MaxFreqChnls = 2U;                                     // Frequency channels of the board
+
+//**************************************** Global constant definitions ( const ) ***************************************
+
+//**************************************** Module global data segment ( static ) ***************************************
+static U32 u32MON_SubTestNow = MON_SUB_TEST_START;              // Time of the stub in ms
+static void (*pvMON_SubTestSlice)(void) = KB_NULL_PTR;          // Activated 10 ms time slice
+static BOOLEAN boMON_SubTestActivate = TRUE;                    // Result of boOS_ActivateFct
+static E_BCM_BOARD_STATE eMON_SubTestState = eBCM_BS_TEST;      // Board state of the stub
+static U8 u8MON_SubTestPwmStop = 0U;                            // Users that stopped the PWM acquisition
+static U8 au8MON_SubTestResp[MON_MSGMAXLEN];                    // Last response of MON_SDI_SUB_READ
+static U32 u32MON_SubTestErrors = 0U;                           // Number of failed checks
+
+//**************************************** Module global constants ( static const ) ************************************
+
+//**************************************** Local func/proc prototypes ( static ) ***************************************
+static S16 s16MON_SubTestSubscribe (const U8* pu8Cmd, U16 u16Len);
+static C_MON_SUB_TEST_READ cMON_SubTestRead (U16 u16MaxResp);
+static U32 u32MON_SubTestTime (U8 u8Frame);
+static void vMON_SubTestTick (U32 u32Slices);
+static void vMON_SubTestCheck (const char* pcName, BOOLEAN boOk);
+
+//** EndOfHeader *******************************************************************************************************
+
+//**********************************************************************************************************************
+// Stubs of the OS, BCL and driver functions
+//**********************************************************************************************************************
+S16 s16OS_GetTimeMS (U32* pu32Time)
+{
+    *pu32Time = u32MON_SubTestNow;
+    return (0);
+}
+
+BOOLEAN boOS_ActivateFct (void (*pvFct)(void), U8 u8Slice)
+{
+    if ((boMON_SubTestActivate == TRUE) && (u8Slice == (U8) eOS_SLICE_10MS))
+    {
+        pvMON_SubTestSlice = pvFct;
+    }
+    return (boMON_SubTestActivate);
+}
+
+BOOLEAN boOS_DeActivateFct (void (*pvFct)(void), U8 u8Slice)
+{
+    if ((pvFct == pvMON_SubTestSlice) && (u8Slice == (U8) eOS_SLICE_10MS))
+    {
+        pvMON_SubTestSlice = KB_NULL_PTR;
+    }
+    return (TRUE);
+}
+
+E_BCM_BOARD_STATE eBCM_StrtGetBoardState (void)
+{
+    return (eMON_SubTestState);
+}
+
+BOOLEAN boMON_InitBinIoChannels (U8 u8HWPortNum, U8 u8PinMask, E_BINIO_DIR eBINIODir, U8 u8InitState)
+{
+    (void) u8PinMask;
+    (void) eBINIODir;
+    (void) u8InitState;
+    return ((u8HWPortNum != MON_SUB_TEST_BAD_PORT) ? TRUE : FALSE);
+}
+
+BOOLEAN boMON_GetBinIOChannels (U8 u8HWPortNum, U8* pu8InputMask, U8* pu8CurrentState)
+{
+    *pu8InputMask = 0xFFU;
+    *pu8CurrentState = (U8) (u8HWPortNum + (U8) (u32MON_SubTestNow / 10U));
+    return (TRUE);
+}
+
+BOOLEAN boMON_InitPSDIOChannels (U16 u16PinMask, E_PSDIO_DIR ePSDIODir, U16 u16InitState)
+{
+    (void) u16PinMask;
+    (void) ePSDIODir;
+    (void) u16InitState;
+    return (TRUE);
+}
+
+BOOLEAN boMON_GetPSDIOChannels (U16* pu16InputMask, U16* pu16CurrentState)
+{
+    *pu16InputMask = 0xFFFFU;
+    *pu16CurrentState = 0xBEEFU;
+    return (TRUE);
+}
+
+BOOLEAN boMON_InitFINCaptChannel (E_FIN_CHNL_NUM eFINChnlNum)
+{
+    (void) eFINChnlNum;
+    return (TRUE);
+}
+
+BOOLEAN boMON_GetFINCaptData (E_FIN_CHNL_NUM eFINChnlNum, C_FIN_MEASUREMENT_DATA* pcFINMeasurementData)
+{
+    pcFINMeasurementData->u32Frequency = 123449U + (U32) eFINChnlNum;   // 1234.49 Hz + channel, 1235 Hz for FIN 1
+    pcFINMeasurementData->boFreqUpToDate = TRUE;
+    return (TRUE);
+}
+
+BOOLEAN boMON_ReadPWM (U8 u8Channel, U32* pu32DutyCycle, BOOLEAN* pboUPToDateBit)
+{
+    *pu32DutyCycle = 250U + u8Channel;
+    *pboUPToDateBit = TRUE;
+    return (TRUE);
+}
+
+void vMON_PwmDemodStop (U8 u8User)
+{
+    u8MON_SubTestPwmStop |= u8User;
+}
+
+void vMON_PwmDemodRestart (U8 u8User)
+{
+    u8MON_SubTestPwmStop &= (U8) ~u8User;
+}
+
+BOOLEAN boMON_PwmDemodStopped (void)
+{
+    return ((u8MON_SubTestPwmStop != 0U) ? TRUE : FALSE);
+}
+//** EndOfFunction stubs ***********************************************************************************************
+
+//**********************************************************************************************************************
+// Function main
+//**********************************************************************************************************************
+int main (void)
+{
+//************************************************ Function scope data *************************************************
+    static const U8 au8Short[3] = { (U8) MON_SDI_SUBSCRIBE, 0U, 20U };                      // Fixed part missing
+    static const U8 au8Len[7] = { (U8) MON_SDI_SUBSCRIBE, 0U, 20U, 2U, 0U, 1U, 0xFFU };     // Channel missing
+    static const U8 au8Fast[7] = { (U8) MON_SDI_SUBSCRIBE, 0U, 9U, 1U, 0U, 1U, 0xFFU };     // Period too short
+    static const U8 au8Slow[7] = { (U8) MON_SDI_SUBSCRIBE, 0xEAU, 0x61U, 1U, 0U, 1U, 0xFFU };   // 60001 ms
+    static const U8 au8Type[7] = { (U8) MON_SDI_SUBSCRIBE, 0U, 20U, 1U, 4U, 0U, 0U };       // Unknown type
+    static const U8 au8Fin[7] = { (U8) MON_SDI_SUBSCRIBE, 0U, 20U, 1U, 1U, 2U, 0U };        // No such FIN
+    static const U8 au8Pwm[7] = { (U8) MON_SDI_SUBSCRIBE, 0U, 20U, 1U, 2U, 2U, 0U };        // No such PWM input
+    static const U8 au8FinPwm[10] = { (U8) MON_SDI_SUBSCRIBE, 0U, 20U, 2U, 1U, 0U, 0U, 2U, 0U, 0U };
+    static const U8 au8Bad[7] = { (U8) MON_SDI_SUBSCRIBE, 0U, 20U, 1U, 0U, MON_SUB_TEST_BAD_PORT, 0xFFU };
+    static const U8 au8All[13] = { (U8) MON_SDI_SUBSCRIBE, 0U, 20U, 3U, 0U, 1U, 0x0FU, 3U, 0xF0U, 0x0FU, 1U, 1U,
+                                   0U };                       // DIGIO, PSDIO, FIN: frame of 10 bytes
+    static const U8 au8Pwm1[7] = { (U8) MON_SDI_SUBSCRIBE, 0U, 10U, 1U, 2U, 1U, 0U };       // PWM input 1
+    static const U8 au8End[4] = { (U8) MON_SDI_SUBSCRIBE, 0U, 0U, 0U };                     // End
+    U8 au8Many[MON_SUB_TEST_CMD_MAX];                           // Too many channels
+    C_MON_SUB_TEST_READ cRead;                                  // Result of MON_SDI_SUB_READ
+    const U8* pu8Frame;                                         // Frame
+    U16 u16Len;                                                 // Length of a command
+    U32 u32Total;                                               // Frames read
+    U8 u8Cnt;                                                   // Counter
+    BOOLEAN boOk;                                               // Result of a check
+
+//*************************************************** Function code ****************************************************
+    // Validation of MON_SDI_SUBSCRIBE
+    vMON_SubTestCheck("read without subscription", cMON_SubTestRead(MON_MSGMAXLEN).u8Status ==
+                                                   MON_SDI_INVALID_COMMAND);
+    eMON_SubTestState = eBCM_BS_NORMAL;
+    vMON_SubTestCheck("not in test mode", s16MON_SubTestSubscribe(au8All, (U16) sizeof(au8All)) ==
+                                          MON_SDI_INVALID_COMMAND);
+    eMON_SubTestState = eBCM_BS_TEST;
+    for (u16Len = 1U; u16Len <= (U16) sizeof(au8Short); u16Len++)
+    {
+        vMON_SubTestCheck("fixed part missing", s16MON_SubTestSubscribe(au8Short, u16Len) == MON_SDI_INVALID_COMMAND);
+    }
+    vMON_SubTestCheck("channel missing", s16MON_SubTestSubscribe(au8Len, (U16) sizeof(au8Len)) ==
+                                         MON_SDI_INVALID_COMMAND);
+    vMON_SubTestCheck("period too short", s16MON_SubTestSubscribe(au8Fast, (U16) sizeof(au8Fast)) ==
+                                          MON_SDI_RANGE_ERROR);
+    vMON_SubTestCheck("period too long", s16MON_SubTestSubscribe(au8Slow, (U16) sizeof(au8Slow)) ==
+                                         MON_SDI_RANGE_ERROR);
+    (void) memset(au8Many, 0, sizeof(au8Many));
+    au8Many[0] = (U8) MON_SDI_SUBSCRIBE;
+    au8Many[2] = 20U;
+    au8Many[3] = 9U;
+    vMON_SubTestCheck("9 channels", s16MON_SubTestSubscribe(au8Many, (U16) (4U + (9U * 3U))) == MON_SDI_RANGE_ERROR);
+    vMON_SubTestCheck("unknown type", s16MON_SubTestSubscribe(au8Type, (U16) sizeof(au8Type)) == MON_SDI_RANGE_ERROR);
+    vMON_SubTestCheck("no such FIN", s16MON_SubTestSubscribe(au8Fin, (U16) sizeof(au8Fin)) == MON_SDI_CHANNEL_ERROR);
+    vMON_SubTestCheck("no such PWM", s16MON_SubTestSubscribe(au8Pwm, (U16) sizeof(au8Pwm)) == MON_SDI_CHANNEL_ERROR);
+    vMON_SubTestCheck("FIN and PWM", s16MON_SubTestSubscribe(au8FinPwm, (U16) sizeof(au8FinPwm)) ==
+                                     MON_SDI_CHANNEL_ERROR);
+    vMON_SubTestCheck("init failed", s16MON_SubTestSubscribe(au8Bad, (U16) sizeof(au8Bad)) == MON_SDI_CHANNEL_ERROR);
+    vMON_SubTestCheck("nothing running", (pvMON_SubTestSlice == KB_NULL_PTR) && (u8MON_SubTestPwmStop == 0U));
+
+    // Frame content and period
+    vMON_SubTestCheck("subscribe", s16MON_SubTestSubscribe(au8All, (U16) sizeof(au8All)) == MON_SDI_NO_ERROR);
+    vMON_SubTestCheck("PWM stopped for FIN", u8MON_SubTestPwmStop != 0U);
+    vMON_SubTestTick(10U);
+    cRead = cMON_SubTestRead(MON_MSGMAXLEN);
+    boOk = ((cRead.u8Status == MON_SDI_NO_ERROR) && (cRead.u16Lost == 0U) && (cRead.u8FrameLen == 10U) &&
+            (cRead.u8Frames == 5U)) ? TRUE : FALSE;
+    for (u8Cnt = 0U; (u8Cnt < cRead.u8Frames) && (boOk == TRUE); u8Cnt++)
+    {
+        pu8Frame = &au8MON_SubTestResp[6U + (10U * u8Cnt)];
+        boOk = ((u32MON_SubTestTime(u8Cnt) == (MON_SUB_TEST_START + 10U + (20U * u8Cnt))) &&
+                (pu8Frame[4] == (U8) ((1U + (u32MON_SubTestTime(u8Cnt) / 10U)) & 0x0FU)) &&
+                (pu8Frame[5] == 0x0EU) && (pu8Frame[6] == 0xE0U) &&
+                (pu8Frame[7] == 1U) && (pu8Frame[8] == 0x04U) && (pu8Frame[9] == 0xD3U)) ? TRUE : FALSE;
+    }
+    vMON_SubTestCheck("frames, the first in the first time slice", boOk);
+
+    // Full buffer: frames are lost until the tester reads, then the buffer is drained
+    vMON_SubTestTick(2U * (MON_SUB_TEST_FRAMES + 20U));
+    cRead = cMON_SubTestRead(MON_MSGMAXLEN);
+    u32Total = cRead.u8Frames;
+    vMON_SubTestCheck("lost", (cRead.u8Status == MON_SDI_NO_ERROR) && (cRead.u16Lost == 20U));
+    for (u8Cnt = 0U; (u8Cnt < 100U) && (cRead.u8Frames != 0U); u8Cnt++)
+    {
+        cRead = cMON_SubTestRead(MON_MSGMAXLEN);
+        u32Total += cRead.u8Frames;
+    }
+    vMON_SubTestCheck("drained", (u32Total == MON_SUB_TEST_FRAMES) && (cRead.u16Lost == 0U));
+
+    // Board state change: the subscription ends, the PWM acquisition is restarted
+    vMON_SubTestTick(4U);
+    eMON_SubTestState = eBCM_BS_NORMAL;
+    vMON_SubTestTick(1U);
+    eMON_SubTestState = eBCM_BS_TEST;
+    vMON_SubTestTick(4U);
+    cRead = cMON_SubTestRead(MON_MSGMAXLEN);
+    vMON_SubTestCheck("board state change", (pvMON_SubTestSlice == KB_NULL_PTR) && (u8MON_SubTestPwmStop == 0U) &&
+                                            (cRead.u8Status == MON_SDI_NO_ERROR) && (cRead.u8Frames == 2U));
+
+    // PWM input, not up to date while the PWM acquisition is stopped by another user
+    vMON_SubTestCheck("subscribe PWM", s16MON_SubTestSubscribe(au8Pwm1, (U16) sizeof(au8Pwm1)) == MON_SDI_NO_ERROR);
+    vMON_SubTestTick(1U);
+    vMON_PwmDemodStop(MON_PWM_DEMOD_READ_FREQ);
+    vMON_SubTestTick(1U);
+    vMON_PwmDemodRestart(MON_PWM_DEMOD_READ_FREQ);
+    cRead = cMON_SubTestRead(MON_MSGMAXLEN);
+    vMON_SubTestCheck("PWM", (cRead.u8Frames == 2U) && (au8MON_SubTestResp[10] == 1U) &&
+                             (au8MON_SubTestResp[12] == 251U) && (au8MON_SubTestResp[17] == 0U) &&
+                             (u8MON_SubTestPwmStop == 0U));
+
+    // End by N = 0, the frames are discarded
+    vMON_SubTestTick(3U);
+    vMON_SubTestCheck("end", s16MON_SubTestSubscribe(au8End, (U16) sizeof(au8End)) == MON_SDI_NO_ERROR);
+    vMON_SubTestCheck("ended", (pvMON_SubTestSlice == KB_NULL_PTR) &&
+                               (cMON_SubTestRead(MON_MSGMAXLEN).u8Status == MON_SDI_INVALID_COMMAND));
+
+    // Time slice not activated
+    boMON_SubTestActivate = FALSE;
+    vMON_SubTestCheck("no time slice", (s16MON_SubTestSubscribe(au8All, (U16) sizeof(au8All)) ==
+                                        MON_SDI_INVALID_COMMAND) && (u8MON_SubTestPwmStop == 0U));
+    boMON_SubTestActivate = TRUE;
+
+    (void) printf("mon_sdi_sub: %lu check(s) failed\n", (unsigned long) u32MON_SubTestErrors);
+
+    return ((u32MON_SubTestErrors == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+//** EndOfFunction main ************************************************************************************************
+
+// Function s16MON_SubTestSubscribe
+//**********************************************************************************************************************
+//! @brief          Sends MON_SDI_SUBSCRIBE in a buffer of the exact length of the command.
+//!
+//! @param[in]      pu8Cmd : Command
+//! @param[in]      u16Len : Length of the command
+//!
+//! @return         Status of the response, -1 for a response of a wrong length
+//**********************************************************************************************************************
+static S16 s16MON_SubTestSubscribe (const U8* pu8Cmd, U16 u16Len)
+{
+//************************************************ Function scope data *************************************************
+    U8* pu8Buf;                                                 // Command of the exact length
+    U8 au8Resp[MON_MSGMAXLEN];                                  // Response
+    S16 s16Len;                                                 // Length of the response
+
+//*************************************************** Function code ****************************************************
+    pu8Buf = (U8*) malloc(u16Len);
+    if (pu8Buf == KB_NULL_PTR)
+    {
+        return (-1);
+    }
+    (void) memcpy(pu8Buf, pu8Cmd, u16Len);
+    s16Len = s16MON_Subscribe(pu8Buf, u16Len, au8Resp, MON_MSGMAXLEN);
+    free(pu8Buf);
+
+    return (((s16Len == 2) || (s16Len == 3)) ? (S16) au8Resp[1] : -1);
+}
+//** EndOfFunction s16MON_SubTestSubscribe *****************************************************************************
+
+// Function cMON_SubTestRead
+//**********************************************************************************************************************
+//! @brief          Sends MON_SDI_SUB_READ, the response is kept in au8MON_SubTestResp.
+//!
+//! @param[in]      u16MaxResp : Size of the response
+//!
+//! @return         Result
+//**********************************************************************************************************************
+static C_MON_SUB_TEST_READ cMON_SubTestRead (U16 u16MaxResp)
+{
+//************************************************ Function scope data *************************************************
+    U8 au8Cmd[MON_SDI_SUB_READ_LEN];                            // Command
+    C_MON_SUB_TEST_READ cRead = { 0, 0xFFU, 0U, 0U, 0U };       // Function return variable
+
+//*************************************************** Function code ****************************************************
+    au8Cmd[0] = (U8) MON_SDI_SUB_READ;
+    (void) memset(au8MON_SubTestResp, 0, sizeof(au8MON_SubTestResp));
+    cRead.s16Len = s16MON_SubRead(au8Cmd, (U16) sizeof(au8Cmd), au8MON_SubTestResp, u16MaxResp);
+    if (cRead.s16Len >= 2)
+    {
+        cRead.u8Status = au8MON_SubTestResp[1];
+    }
+    if ((cRead.s16Len >= 6) &&
+        (cRead.s16Len == (6 + ((S16) au8MON_SubTestResp[5] * (S16) au8MON_SubTestResp[4]))))
+    {
+        cRead.u16Lost = (U16) (((U16) au8MON_SubTestResp[2] << 8) | au8MON_SubTestResp[3]);
+        cRead.u8FrameLen = au8MON_SubTestResp[4];
+        cRead.u8Frames = au8MON_SubTestResp[5];
+    }
+    else if (cRead.u8Status == MON_SDI_NO_ERROR)
+    {
+        cRead.u8Status = 0xFFU;
+    }
+    else
+    {
+        // Error response
+    }
+
+    return (cRead);
+}
+//** EndOfFunction cMON_SubTestRead ************************************************************************************
+
+// Function u32MON_SubTestTime
+//**********************************************************************************************************************
+//! @brief          Returns the time of a frame of the last response.
+//!
+//! @param[in]      u8Frame : Frame, frames of 10 bytes
+//!
+//! @return         Time in ms
+//**********************************************************************************************************************
+static U32 u32MON_SubTestTime (U8 u8Frame)
+{
+//************************************************ Function scope data *************************************************
+    const U8* pu8Frame = &au8MON_SubTestResp[6U + (10U * u8Frame)];  // Frame
+
+//*************************************************** Function code ****************************************************
+    return (((U32) pu8Frame[0] << 24) | ((U32) pu8Frame[1] << 16) | ((U32) pu8Frame[2] << 8) | (U32) pu8Frame[3]);
+}
+//** EndOfFunction u32MON_SubTestTime **********************************************************************************
+
+// Function vMON_SubTestTick
+//**********************************************************************************************************************
+//! @brief          Advances the time by 10 ms slices and calls the activated time slice.
+//!
+//! @param[in]      u32Slices : Number of 10 ms slices
+//!
+//! @return         -
+//**********************************************************************************************************************
+static void vMON_SubTestTick (U32 u32Slices)
+{
+//************************************************ Function scope data *************************************************
+    U32 u32Cnt;                                                 // Slice
+
+//*************************************************** Function code ****************************************************
+    for (u32Cnt = 0U; u32Cnt < u32Slices; u32Cnt++)
+    {
+        u32MON_SubTestNow += 10U;
+        if (pvMON_SubTestSlice != KB_NULL_PTR)
+        {
+            pvMON_SubTestSlice();
+        }
+    }
+}
+//** EndOfFunction vMON_SubTestTick ************************************************************************************
+
+// Function vMON_SubTestCheck
+//**********************************************************************************************************************
+//! @brief          Counts a failed check.
+//!
+//! @param[in]      pcName : Name of the check
+//! @param[in]      boOk   : Result of the check
+//!
+//! @return         -
+//**********************************************************************************************************************
+static void vMON_SubTestCheck (const char* pcName, BOOLEAN boOk)
+{
+//*************************************************** Function code ****************************************************
+    if (boOk == FALSE)
+    {
+        (void) printf("FAIL %s\n", pcName);
+        u32MON_SubTestErrors++;
+    }
+}
+//** EndOfFunction vMON_SubTestCheck ***********************************************************************************
+
+// EndOfFile mon_sdi_sub_test.c ****************************************************************************************